@@ -0,0 +1,90 @@
+#!/usr/bin/env node
+
+/**
+ * Batch Benchmark
+ *
+ * Compares N single POST /mcp/tool/{name} calls against one POST /mcp/batch with the same N calls,
+ * against a running Unreal Editor with the plugin enabled.
+ *
+ * Usage: node bench/batch-benchmark.js [--calls=100] [--runs=5] [--tool=get_level_actors]
+ *
+ * Environment Variables:
+ *   UNREAL_MCP_URL - Base URL for Unreal MCP server (default: http://localhost:3000)
+ *   MCP_REQUEST_TIMEOUT_MS - HTTP request timeout in milliseconds (default: 30000)
+ */
+
+import { executeUnrealTool, executeUnrealBatch, checkUnrealConnection } from "../lib.js";
+
+const baseUrl = process.env.UNREAL_MCP_URL || "http://localhost:3000";
+const timeoutMs = parseInt(process.env.MCP_REQUEST_TIMEOUT_MS, 10) || 30000;
+
+function getArg(name, fallback) {
+  const prefix = `--${name}=`;
+  const arg = process.argv.find((a) => a.startsWith(prefix));
+  return arg ? arg.substring(prefix.length) : fallback;
+}
+
+const numCalls = parseInt(getArg("calls", "100"), 10);
+const numRuns = parseInt(getArg("runs", "5"), 10);
+const toolName = getArg("tool", "get_level_actors");
+
+// Cheap read-only call so the benchmark measures request and dispatch overhead, not tool work
+const params = toolName === "get_level_actors" ? { limit: 1 } : {};
+
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)];
+}
+
+async function timeSingles() {
+  const start = performance.now();
+  for (let i = 0; i < numCalls; i++) {
+    const result = await executeUnrealTool(baseUrl, timeoutMs, toolName, params);
+    if (!result.success) {
+      throw new Error(`${toolName} failed: ${result.message}`);
+    }
+  }
+  return performance.now() - start;
+}
+
+async function timeBatch() {
+  const calls = Array.from({ length: numCalls }, () => ({ tool: toolName, params }));
+  const start = performance.now();
+  const result = await executeUnrealBatch(baseUrl, timeoutMs, calls, true);
+  if (!result.success) {
+    throw new Error(`batch failed: ${result.message}`);
+  }
+  return performance.now() - start;
+}
+
+async function main() {
+  const status = await checkUnrealConnection(baseUrl, timeoutMs);
+  if (!status.connected) {
+    console.error(`Unreal not connected at ${baseUrl} (${status.reason})`);
+    process.exit(1);
+  }
+
+  // Warm up both paths once
+  await timeSingles();
+  await timeBatch();
+
+  const singleTimes = [];
+  const batchTimes = [];
+  for (let run = 0; run < numRuns; run++) {
+    singleTimes.push(await timeSingles());
+    batchTimes.push(await timeBatch());
+  }
+
+  const single = median(singleTimes);
+  const batch = median(batchTimes);
+
+  console.log(`${toolName} x ${numCalls}, median of ${numRuns} runs`);
+  console.log(`  single calls: ${single.toFixed(1)} ms (${(single / numCalls).toFixed(2)} ms/call)`);
+  console.log(`  one batch:    ${batch.toFixed(1)} ms (${(batch / numCalls).toFixed(2)} ms/call)`);
+  console.log(`  speedup:      ${(single / batch).toFixed(1)}x`);
+}
+
+main().catch((error) => {
+  console.error(error.message);
+  process.exit(1);
+});
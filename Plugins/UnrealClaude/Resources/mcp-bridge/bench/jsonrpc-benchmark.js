@@ -0,0 +1,126 @@
+#!/usr/bin/env node
+
+/**
+ * JSON-RPC Transport Benchmark
+ *
+ * Compares tools/call round trips through this bridge (stdio, then REST to the editor) against
+ * the editor's native MCP endpoint (POST /mcp, streamable HTTP), using the SDK client for both,
+ * against a running Unreal Editor with the plugin enabled.
+ *
+ * The bridge is started with MCP_ASYNC_ENABLED=false so both paths run the tool the same way
+ * and the difference is the extra process hop.
+ *
+ * Usage: node bench/jsonrpc-benchmark.js [--calls=200] [--tool=get_level_actors]
+ *
+ * Environment Variables:
+ *   UNREAL_MCP_URL - Base URL for Unreal MCP server (default: http://localhost:3000)
+ *   MCP_REQUEST_TIMEOUT_MS - HTTP request timeout in milliseconds (default: 30000)
+ */
+
+import { fileURLToPath } from "node:url";
+import { Client } from "@modelcontextprotocol/sdk/client/index.js";
+import { StdioClientTransport } from "@modelcontextprotocol/sdk/client/stdio.js";
+import { StreamableHTTPClientTransport } from "@modelcontextprotocol/sdk/client/streamableHttp.js";
+import { checkUnrealConnection } from "../lib.js";
+
+const baseUrl = process.env.UNREAL_MCP_URL || "http://localhost:3000";
+const timeoutMs = parseInt(process.env.MCP_REQUEST_TIMEOUT_MS, 10) || 30000;
+
+function getArg(name, fallback) {
+  const prefix = `--${name}=`;
+  const arg = process.argv.find((a) => a.startsWith(prefix));
+  return arg ? arg.substring(prefix.length) : fallback;
+}
+
+const numCalls = parseInt(getArg("calls", "200"), 10);
+const toolName = getArg("tool", "get_level_actors");
+
+// Cheap read-only call so the benchmark measures transport overhead, not tool work
+const args = toolName === "get_level_actors" ? { limit: 1 } : {};
+
+function percentile(sortedValues, p) {
+  return sortedValues[Math.min(sortedValues.length - 1, Math.ceil(p * sortedValues.length) - 1)];
+}
+
+async function timeCalls(client, name) {
+  // Warm up the connection and the tool once
+  await client.callTool({ name, arguments: args });
+
+  const times = [];
+  for (let i = 0; i < numCalls; i++) {
+    const start = performance.now();
+    const result = await client.callTool({ name, arguments: args });
+    times.push(performance.now() - start);
+    if (result.isError) {
+      throw new Error(`${name} failed: ${result.content?.[0]?.text}`);
+    }
+  }
+
+  times.sort((a, b) => a - b);
+  return {
+    avg: times.reduce((sum, t) => sum + t, 0) / times.length,
+    p50: percentile(times, 0.5),
+    p95: percentile(times, 0.95),
+  };
+}
+
+async function benchBridge() {
+  const transport = new StdioClientTransport({
+    command: process.execPath,
+    args: [fileURLToPath(new URL("../index.js", import.meta.url))],
+    env: {
+      ...process.env,
+      UNREAL_MCP_URL: baseUrl,
+      MCP_ASYNC_ENABLED: "false",
+      MCP_STREAM_ENABLED: "false",
+    },
+    stderr: "ignore",
+  });
+
+  const client = new Client({ name: "jsonrpc-benchmark", version: "1.0.0" });
+  await client.connect(transport);
+  try {
+    return await timeCalls(client, `unreal_${toolName}`);
+  } finally {
+    await client.close();
+  }
+}
+
+async function benchNative() {
+  const transport = new StreamableHTTPClientTransport(new URL(`${baseUrl}/mcp`));
+
+  const client = new Client({ name: "jsonrpc-benchmark", version: "1.0.0" });
+  await client.connect(transport);
+  try {
+    return await timeCalls(client, toolName);
+  } finally {
+    await client.close();
+  }
+}
+
+function report(label, stats) {
+  console.log(`  ${label.padEnd(8)} avg ${stats.avg.toFixed(2)} ms  p50 ${stats.p50.toFixed(2)} ms  p95 ${stats.p95.toFixed(2)} ms`);
+}
+
+async function main() {
+  const status = await checkUnrealConnection(baseUrl, timeoutMs);
+  if (!status.connected) {
+    console.error(`Unreal not connected at ${baseUrl} (${status.reason})`);
+    process.exit(1);
+  }
+
+  console.log(`tools/call ${toolName} x ${numCalls}`);
+
+  const bridge = await benchBridge();
+  report("bridge", bridge);
+
+  const native = await benchNative();
+  report("native", native);
+
+  console.log(`  saved    ${(bridge.p50 - native.p50).toFixed(2)} ms per call at p50`);
+}
+
+main().catch((error) => {
+  console.error(error.message);
+  process.exit(1);
+});
@@ -0,0 +1,85 @@
+#!/usr/bin/env node
+
+/**
+ * Tools Listing Benchmark
+ *
+ * Times GET /mcp/tools against a running Unreal Editor with the plugin enabled, as full responses
+ * and as conditional requests answered with 304 Not Modified.
+ *
+ * Usage: node bench/list-tools-benchmark.js [--requests=200]
+ *
+ * Environment Variables:
+ *   UNREAL_MCP_URL - Base URL for Unreal MCP server (default: http://localhost:3000)
+ *   MCP_REQUEST_TIMEOUT_MS - HTTP request timeout in milliseconds (default: 30000)
+ */
+
+import { fetchWithTimeout, checkUnrealConnection } from "../lib.js";
+
+const baseUrl = process.env.UNREAL_MCP_URL || "http://localhost:3000";
+const timeoutMs = parseInt(process.env.MCP_REQUEST_TIMEOUT_MS, 10) || 30000;
+
+function getArg(name, fallback) {
+  const prefix = `--${name}=`;
+  const arg = process.argv.find((a) => a.startsWith(prefix));
+  return arg ? arg.substring(prefix.length) : fallback;
+}
+
+const numRequests = parseInt(getArg("requests", "200"), 10);
+
+function percentile(sortedValues, p) {
+  return sortedValues[Math.min(sortedValues.length - 1, Math.ceil(p * sortedValues.length) - 1)];
+}
+
+async function timeRequests(headers) {
+  const times = [];
+  let bytes = 0;
+  let status = 0;
+
+  for (let i = 0; i < numRequests; i++) {
+    const start = performance.now();
+    const response = await fetchWithTimeout(`${baseUrl}/mcp/tools`, { headers }, timeoutMs);
+    const body = await response.arrayBuffer();
+    times.push(performance.now() - start);
+    bytes += body.byteLength;
+    status = response.status;
+  }
+
+  times.sort((a, b) => a - b);
+  return {
+    status,
+    avg: times.reduce((sum, t) => sum + t, 0) / times.length,
+    p50: percentile(times, 0.5),
+    p95: percentile(times, 0.95),
+    bytesPerRequest: bytes / numRequests,
+  };
+}
+
+function report(label, stats) {
+  console.log(`  ${label.padEnd(12)} HTTP ${stats.status}  avg ${stats.avg.toFixed(2)} ms  p50 ${stats.p50.toFixed(2)} ms  p95 ${stats.p95.toFixed(2)} ms  ${Math.round(stats.bytesPerRequest)} B/request`);
+}
+
+async function main() {
+  const status = await checkUnrealConnection(baseUrl, timeoutMs);
+  if (!status.connected) {
+    console.error(`Unreal not connected at ${baseUrl} (${status.reason})`);
+    process.exit(1);
+  }
+
+  const first = await fetchWithTimeout(`${baseUrl}/mcp/tools`, {}, timeoutMs);
+  const etag = first.headers.get("etag");
+  await first.arrayBuffer();
+
+  console.log(`GET /mcp/tools x ${numRequests} (ETag ${etag || "none"})`);
+  report("full", await timeRequests({}));
+
+  if (etag) {
+    report("conditional", await timeRequests({ "If-None-Match": etag }));
+  } else {
+    console.log("  conditional  skipped, server sent no ETag");
+  }
+}
+
+main().catch((error) => {
+  console.error(error.message);
+  process.exit(1);
+});
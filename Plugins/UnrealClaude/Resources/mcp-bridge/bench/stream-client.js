@@ -0,0 +1,86 @@
+#!/usr/bin/env node
+
+/**
+ * Stream Test Client
+ *
+ * Calls a tool once as a server-sent event stream and once as a plain request, against a running
+ * Unreal Editor with the plugin enabled, and prints when each event arrived and the time to first byte.
+ *
+ * Usage: node bench/stream-client.js [--tool=capture_viewport] [--params='{"key": "value"}']
+ *
+ * Environment Variables:
+ *   UNREAL_MCP_URL - Base URL for Unreal MCP server (default: http://localhost:3000)
+ *   MCP_REQUEST_TIMEOUT_MS - HTTP request timeout in milliseconds (default: 30000)
+ */
+
+import { fetchWithTimeout, executeUnrealToolStreamed, checkUnrealConnection } from "../lib.js";
+
+const baseUrl = process.env.UNREAL_MCP_URL || "http://localhost:3000";
+const timeoutMs = parseInt(process.env.MCP_REQUEST_TIMEOUT_MS, 10) || 30000;
+
+function getArg(name, fallback) {
+  const prefix = `--${name}=`;
+  const arg = process.argv.find((a) => a.startsWith(prefix));
+  return arg ? arg.substring(prefix.length) : fallback;
+}
+
+const toolName = getArg("tool", "capture_viewport");
+const params = JSON.parse(getArg("params", "{}"));
+
+async function runStreamed() {
+  const start = performance.now();
+  let firstByteMs;
+
+  const result = await executeUnrealToolStreamed(baseUrl, timeoutMs, toolName, params, {
+    onEvent: (event) => {
+      const elapsed = performance.now() - start;
+      if (firstByteMs === undefined) firstByteMs = elapsed;
+
+      const detail = event.event === "progress"
+        ? `${event.data.progress}% ${event.data.message}`
+        : event.event === "result"
+          ? `${event.data.success ? "success" : "failed"}: ${event.data.message}`
+          : "";
+      console.log(`  ${elapsed.toFixed(1).padStart(9)} ms  #${event.id} ${event.event} ${detail}`);
+    },
+  });
+
+  return { firstByteMs, totalMs: performance.now() - start, success: result.success };
+}
+
+async function runPlain() {
+  const start = performance.now();
+  const response = await fetchWithTimeout(`${baseUrl}/mcp/tool/${toolName}`, {
+    method: "POST",
+    headers: { "Content-Type": "application/json" },
+    body: JSON.stringify(params),
+  }, timeoutMs);
+
+  // Headers arrive with the body, once the tool is done
+  const firstByteMs = performance.now() - start;
+  const result = await response.json();
+
+  return { firstByteMs, totalMs: performance.now() - start, success: result.success };
+}
+
+async function main() {
+  const status = await checkUnrealConnection(baseUrl, timeoutMs);
+  if (!status.connected) {
+    console.error(`Unreal not connected at ${baseUrl} (${status.reason})`);
+    process.exit(1);
+  }
+
+  console.log(`Streamed ${toolName}:`);
+  const streamed = await runStreamed();
+  const plain = await runPlain();
+
+  console.log("");
+  console.log(`                time to first byte    total`);
+  console.log(`  streamed      ${streamed.firstByteMs.toFixed(1).padStart(12)} ms   ${streamed.totalMs.toFixed(1).padStart(9)} ms  (${streamed.success ? "success" : "failed"})`);
+  console.log(`  plain         ${plain.firstByteMs.toFixed(1).padStart(12)} ms   ${plain.totalMs.toFixed(1).padStart(9)} ms  (${plain.success ? "success" : "failed"})`);
+}
+
+main().catch((error) => {
+  console.error(error.message);
+  process.exit(1);
+});
@@ -10,6 +10,7 @@
  *   UNREAL_MCP_URL - Base URL for Unreal MCP server (default: http://localhost:3000)
  *   MCP_REQUEST_TIMEOUT_MS - HTTP request timeout in milliseconds (default: 30000)
  *   INJECT_CONTEXT - Enable automatic context injection on tool calls (default: false)
+ *   MCP_STREAM_ENABLED - Receive tool progress as server-sent events instead of polling tasks (default: false)
  */
 
 import { Server } from "@modelcontextprotocol/sdk/server/index.js";
@@ -34,6 +35,9 @@ import {
   fetchUnrealTools as _fetchUnrealTools,
   executeUnrealTool as _executeUnrealTool,
   executeUnrealToolAsync as _executeUnrealToolAsync,
+  executeUnrealBatch as _executeUnrealBatch,
+  executeUnrealToolStreamed as _executeUnrealToolStreamed,
+  fetchUnrealBlob as _fetchUnrealBlob,
   checkUnrealConnection as _checkUnrealConnection,
   convertToMCPSchema,
   convertAnnotations,
@@ -45,6 +49,7 @@ const CONFIG = {
   requestTimeoutMs: parseInt(process.env.MCP_REQUEST_TIMEOUT_MS, 10) || 30000,
   injectContext: process.env.INJECT_CONTEXT === "true",
   asyncEnabled: process.env.MCP_ASYNC_ENABLED !== "false",
+  streamEnabled: process.env.MCP_STREAM_ENABLED === "true",
   asyncTimeoutMs: parseInt(process.env.MCP_ASYNC_TIMEOUT_MS, 10) || 300000,
   pollIntervalMs: parseInt(process.env.MCP_POLL_INTERVAL_MS, 10) || 2000,
 };
@@ -52,6 +57,8 @@ const CONFIG = {
 // Bind CONFIG values to library functions for convenience
 const fetchUnrealTools = () => _fetchUnrealTools(CONFIG.unrealMcpUrl, CONFIG.requestTimeoutMs);
 const executeUnrealTool = (toolName, args) => _executeUnrealTool(CONFIG.unrealMcpUrl, CONFIG.requestTimeoutMs, toolName, args);
+const executeUnrealBatch = (calls, stopOnError) => _executeUnrealBatch(CONFIG.unrealMcpUrl, CONFIG.requestTimeoutMs, calls, stopOnError);
+const fetchUnrealBlob = (handle) => _fetchUnrealBlob(CONFIG.unrealMcpUrl, CONFIG.requestTimeoutMs, handle);
 const checkUnrealConnection = () => _checkUnrealConnection(CONFIG.unrealMcpUrl, CONFIG.requestTimeoutMs);
 
 // Create the MCP server
@@ -139,6 +146,39 @@ server.setRequestHandler(ListToolsRequestSchema, async () => {
     },
   });
 
+  mcpTools.push({
+    name: "unreal_batch",
+    description: "[Unreal Editor] Run several Unreal tools in order with one request. Much faster than separate calls for repetitive edits like setting many properties. Tool names are given without the unreal_ prefix.",
+    inputSchema: {
+      type: "object",
+      properties: {
+        calls: {
+          type: "array",
+          description: "Tool calls to run in order, e.g. [{\"tool\": \"set_property\", \"params\": {...}}]",
+          items: {
+            type: "object",
+            properties: {
+              tool: { type: "string", description: "Tool name without the unreal_ prefix" },
+              params: { type: "object", description: "Tool parameters" },
+            },
+            required: ["tool"],
+          },
+        },
+        stop_on_error: {
+          type: "boolean",
+          description: "Skip the remaining calls after the first failure (default: false)",
+        },
+      },
+      required: ["calls"],
+    },
+    annotations: {
+      readOnlyHint: false,
+      destructiveHint: true,
+      idempotentHint: false,
+      openWorldHint: false,
+    },
+  });
+
   log.info("Tools listed", { count: mcpTools.length, connected: true });
   return { tools: mcpTools };
 });
@@ -285,6 +325,27 @@ server.setRequestHandler(CallToolRequestSchema, async (request) => {
     }
   }
 
+  // Handle batched tool calls
+  if (name === "unreal_batch") {
+    const { calls, stop_on_error: stopOnError } = args || {};
+    const result = await executeUnrealBatch(
+      (calls || []).map((call) => ({ ...call, tool: call.tool?.replace(/^unreal_/, "") })),
+      stopOnError === true
+    );
+
+    return {
+      content: [
+        {
+          type: "text",
+          text: result.results
+            ? `${result.message}\n\n${JSON.stringify(result.results)}`
+            : `Error: ${result.message || result.error}`,
+        },
+      ],
+      isError: !result.success,
+    };
+  }
+
   // Strip "unreal_" prefix to get actual tool name
   if (!name.startsWith("unreal_")) {
     return {
@@ -303,18 +364,29 @@ server.setRequestHandler(CallToolRequestSchema, async (request) => {
   // Tools excluded from auto-async: task_* tools are the async infrastructure itself
   const isTaskTool = toolName.startsWith("task_");
 
-  let result;
-  if (CONFIG.asyncEnabled && !isTaskTool) {
-    const progressToken = request.params._meta?.progressToken;
-    const onProgress = progressToken
-      ? ({ progress, total, message }) => {
-          server.notification({
-            method: "notifications/progress",
-            params: { progressToken, progress, total: total || 0, message },
-          });
-        }
-      : undefined;
+  const progressToken = request.params._meta?.progressToken;
+  const onProgress = progressToken
+    ? ({ progress, total, message }) => {
+        server.notification({
+          method: "notifications/progress",
+          params: { progressToken, progress, total: total || 0, message },
+        });
+      }
+    : undefined;
 
+  let result;
+  if (CONFIG.streamEnabled && !isTaskTool) {
+    result = await _executeUnrealToolStreamed(
+      CONFIG.unrealMcpUrl,
+      CONFIG.requestTimeoutMs,
+      toolName,
+      args,
+      {
+        onProgress,
+        streamTimeoutMs: CONFIG.asyncTimeoutMs,
+      }
+    );
+  } else if (CONFIG.asyncEnabled && !isTaskTool) {
     result = await _executeUnrealToolAsync(
       CONFIG.unrealMcpUrl,
       CONFIG.requestTimeoutMs,
@@ -342,13 +414,28 @@ server.setRequestHandler(CallToolRequestSchema, async (request) => {
     }
   }
 
+  const content = [
+    {
+      type: "text",
+      text: responseText,
+    },
+  ];
+
+  // Images come back as a blob handle, hand them to the client as image content
+  const imageBlob = result.success ? result.data?.image_blob : undefined;
+  if (imageBlob?.url) {
+    const blob = await fetchUnrealBlob(imageBlob);
+    if (blob) {
+      content.push({
+        type: "image",
+        data: blob.data.toString("base64"),
+        mimeType: blob.mimeType,
+      });
+    }
+  }
+
   return {
-    content: [
-      {
-        type: "text",
-        text: responseText,
-      },
-    ],
+    content,
     isError: !result.success,
   };
 });
@@ -367,6 +454,7 @@ async function main() {
     unrealUrl: CONFIG.unrealMcpUrl,
     timeoutMs: CONFIG.requestTimeoutMs,
     asyncEnabled: CONFIG.asyncEnabled,
+    streamEnabled: CONFIG.streamEnabled,
     asyncTimeoutMs: CONFIG.asyncTimeoutMs,
     pollIntervalMs: CONFIG.pollIntervalMs,
     contextInjection: CONFIG.injectContext,
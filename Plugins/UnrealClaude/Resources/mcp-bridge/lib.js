@@ -92,6 +92,69 @@ export async function executeUnrealTool(baseUrl, timeoutMs, toolName, args) {
   }
 }
 
+/**
+ * Execute several tools in order with a single request to the Unreal HTTP server
+ * @param {string} baseUrl - Unreal MCP server base URL
+ * @param {number} timeoutMs - request timeout in milliseconds
+ * @param {Array<{tool: string, params?: object}>} calls - tool calls, tool names without the "unreal_" prefix
+ * @param {boolean} stopOnError - skip the remaining calls after the first failure
+ */
+export async function executeUnrealBatch(baseUrl, timeoutMs, calls, stopOnError = false) {
+  const url = `${baseUrl}/mcp/batch`;
+  try {
+    const response = await fetchWithTimeout(url, {
+      method: "POST",
+      headers: {
+        "Content-Type": "application/json",
+      },
+      body: JSON.stringify({
+        calls: (calls || []).map((call) => ({ tool: call.tool, params: call.params || {} })),
+        stop_on_error: stopOnError,
+      }),
+    }, timeoutMs);
+
+    const data = await response.json();
+    log.debug("Batch executed", { calls: calls?.length ?? 0, success: data.success });
+    return data;
+  } catch (error) {
+    const errorMessage = error.name === "AbortError"
+      ? `Request timeout after ${timeoutMs}ms`
+      : error.message;
+    log.error("Batch execution failed", { error: errorMessage });
+    return {
+      success: false,
+      message: `Failed to execute batch: ${errorMessage}`,
+    };
+  }
+}
+
+/**
+ * Download a binary tool result, such as a capture_viewport image, from the Unreal blob store
+ * @param {string} baseUrl - Unreal MCP server base URL
+ * @param {number} timeoutMs - request timeout in milliseconds
+ * @param {{url: string, content_type?: string}} handle - blob handle from the tool result
+ * @returns {Promise<{data: Buffer, mimeType: string} | null>} the bytes, or null if the blob is gone
+ */
+export async function fetchUnrealBlob(baseUrl, timeoutMs, handle) {
+  try {
+    const response = await fetchWithTimeout(`${baseUrl}${handle.url}`, {}, timeoutMs);
+    if (!response.ok) {
+      throw new Error(`HTTP ${response.status}: ${response.statusText}`);
+    }
+
+    return {
+      data: Buffer.from(await response.arrayBuffer()),
+      mimeType: response.headers.get("content-type") || handle.content_type || "application/octet-stream",
+    };
+  } catch (error) {
+    const errorMessage = error.name === "AbortError"
+      ? `Request timeout after ${timeoutMs}ms`
+      : error.message;
+    log.error("Blob download failed", { url: handle.url, error: errorMessage });
+    return null;
+  }
+}
+
 /**
  * Check if Unreal Editor is running with the plugin
  * @param {string} baseUrl - Unreal MCP server base URL
@@ -259,6 +322,132 @@ export async function executeUnrealToolAsync(baseUrl, timeoutMs, toolName, args,
   };
 }
 
+/**
+ * Parse a text/event-stream body into events
+ * @param {string} text - event-stream body
+ * @returns {Array<{id: number|undefined, event: string, data: any}>}
+ */
+export function parseEventStream(text) {
+  const events = [];
+
+  for (const block of (text || "").split(/\r?\n\r?\n/)) {
+    let id;
+    let event = "message";
+    const dataLines = [];
+
+    for (const line of block.split(/\r?\n/)) {
+      // Lines starting with ":" are comments (keep-alives)
+      if (!line || line.startsWith(":")) continue;
+
+      const colon = line.indexOf(":");
+      const field = colon === -1 ? line : line.substring(0, colon);
+      const value = colon === -1 ? "" : line.substring(colon + 1).replace(/^ /, "");
+
+      if (field === "id") id = parseInt(value, 10);
+      else if (field === "event") event = value;
+      else if (field === "data") dataLines.push(value);
+    }
+
+    if (dataLines.length === 0) continue;
+
+    const raw = dataLines.join("\n");
+    let data;
+    try {
+      data = JSON.parse(raw);
+    } catch {
+      data = raw;
+    }
+    events.push({ id, event, data });
+  }
+
+  return events;
+}
+
+/**
+ * Execute a tool as a server-sent event stream, receiving progress while it runs.
+ * The plugin answers each request with the events so far and the client reconnects with
+ * Last-Event-ID until the result event arrives.
+ *
+ * @param {string} baseUrl - Unreal MCP server base URL
+ * @param {number} timeoutMs - per-request HTTP timeout in milliseconds (must exceed the server's 15s wait)
+ * @param {string} toolName - name of the tool to execute
+ * @param {object} args - tool arguments
+ * @param {object} [options]
+ * @param {function} [options.onProgress] - callback({progress, total, message, partial})
+ * @param {function} [options.onEvent] - callback(event) for every event, including stream and queued
+ * @param {number}   [options.streamTimeoutMs=300000] - overall stream timeout (5 min)
+ */
+export async function executeUnrealToolStreamed(baseUrl, timeoutMs, toolName, args, options = {}) {
+  const {
+    onProgress,
+    onEvent,
+    streamTimeoutMs = 300000,
+  } = options;
+
+  let url = `${baseUrl}/mcp/tool/${toolName}`;
+  let requestOptions = {
+    method: "POST",
+    headers: {
+      "Content-Type": "application/json",
+      Accept: "text/event-stream",
+    },
+    body: JSON.stringify(args || {}),
+  };
+  let lastEventId = -1;
+  const deadline = Date.now() + streamTimeoutMs;
+
+  try {
+    while (Date.now() < deadline) {
+      const response = await fetchWithTimeout(url, requestOptions, timeoutMs);
+
+      // Errors before the stream starts (and older plugins) answer with plain JSON
+      if (!(response.headers.get("content-type") || "").includes("text/event-stream")) {
+        return await response.json();
+      }
+
+      for (const event of parseEventStream(await response.text())) {
+        if (event.id !== undefined) lastEventId = event.id;
+        if (onEvent) onEvent(event);
+
+        if (event.event === "stream") {
+          url = `${baseUrl}${event.data.events_url}`;
+        } else if (event.event === "progress" && onProgress) {
+          onProgress({
+            progress: event.data.progress,
+            total: 100,
+            message: event.data.message,
+            partial: event.data.partial,
+          });
+        } else if (event.event === "result") {
+          log.debug("Stream completed", { tool: toolName, events: lastEventId + 1 });
+          return event.data;
+        }
+      }
+
+      requestOptions = {
+        headers: {
+          Accept: "text/event-stream",
+          "Last-Event-ID": String(lastEventId),
+        },
+      };
+    }
+  } catch (error) {
+    const errorMessage = error.name === "AbortError"
+      ? `Request timeout after ${timeoutMs}ms`
+      : error.message;
+    log.error("Streamed tool execution failed", { tool: toolName, error: errorMessage });
+    return {
+      success: false,
+      message: `Failed to execute tool: ${errorMessage}`,
+    };
+  }
+
+  return {
+    success: false,
+    message: `Stream timed out after ${streamTimeoutMs}ms`,
+  };
+}
+
 /**
  * Convert Unreal tool annotations to MCP annotations format
  * @param {object} unrealAnnotations - annotation object from Unreal
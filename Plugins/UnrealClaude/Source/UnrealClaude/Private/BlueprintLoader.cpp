@@ -2,6 +2,7 @@
 
 #include "BlueprintLoader.h"
 #include "MCP/MCPParamValidator.h"
+#include "MCP/MCPToolProgress.h"
 #include "UnrealClaudeModule.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Kismet2/KismetEditorUtilities.h"
@@ -120,6 +121,8 @@ FBlueprintCompileResult FBlueprintLoader::CompileBlueprintWithResult(UBlueprint*
 	// Mark as modified before compilation
 	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
 
+	FMCPToolProgressScope::Report(FMCPToolProgress(-1, FString::Printf(TEXT("Compiling Blueprint: %s"), *Blueprint->GetName())));
+
 	// Compile the Blueprint
 	FKismetEditorUtilities::CompileBlueprint(Blueprint);
 
@@ -236,6 +239,17 @@ FBlueprintCompileResult FBlueprintLoader::CompileBlueprintWithResult(UBlueprint*
 	UE_LOG(LogUnrealClaude, Log, TEXT("Blueprint '%s' compiled: %s (Errors: %d, Warnings: %d)"),
 		*Blueprint->GetName(), *Result.StatusString, Result.ErrorCount, Result.WarningCount);
 
+	// Let streamed calls see the compile outcome before the rest of the tool finishes
+	if (FMCPToolProgressScope::IsListening())
+	{
+		TSharedPtr<FJsonObject> CompileJson = MakeShared<FJsonObject>();
+		CompileJson->SetStringField(TEXT("blueprint"), Blueprint->GetName());
+		CompileJson->SetStringField(TEXT("status"), Result.StatusString);
+		CompileJson->SetNumberField(TEXT("errors"), Result.ErrorCount);
+		CompileJson->SetNumberField(TEXT("warnings"), Result.WarningCount);
+		FMCPToolProgressScope::Report(FMCPToolProgress(-1, FString::Printf(TEXT("Compiled Blueprint: %s"), *Blueprint->GetName()), CompileJson));
+	}
+
 	return Result;
 }
 
@@ -42,6 +42,26 @@ TSharedPtr<FJsonObject> FJsonUtils::Parse(const FString& JsonString)
 	return nullptr;
 }
 
+TSharedPtr<FJsonObject> FJsonUtils::ParseUtf8(TConstArrayView<uint8> Utf8Json, FString* OutError)
+{
+	const FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(Utf8Json.GetData()), Utf8Json.Num());
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonView);
+
+	if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+	{
+		return JsonObject;
+	}
+
+	if (OutError)
+	{
+		*OutError = Reader->GetErrorMessage();
+	}
+
+	return nullptr;
+}
+
 TSharedPtr<FJsonObject> FJsonUtils::CreateSuccessResponse(const FString& Message, TSharedPtr<FJsonObject> Data)
 {
 	TSharedPtr<FJsonObject> Response = MakeShared<FJsonObject>();
@@ -35,6 +35,15 @@ public:
 	 */
 	static TSharedPtr<FJsonObject> Parse(const FString& JsonString);
 
+	/**
+	 * Parse UTF-8 JSON bytes into a JSON object, reading them in place
+	 * Skips the null-terminated copy and TCHAR conversion Parse needs, which matters for large request bodies
+	 * @param Utf8Json - The UTF-8 encoded JSON, not null-terminated
+	 * @param OutError - Optional output for the reader's error message
+	 * @return The parsed JSON object, or nullptr on failure
+	 */
+	static TSharedPtr<FJsonObject> ParseUtf8(TConstArrayView<uint8> Utf8Json, FString* OutError = nullptr);
+
 	/**
 	 * Create a success response JSON object
 	 * @param Message - The success message
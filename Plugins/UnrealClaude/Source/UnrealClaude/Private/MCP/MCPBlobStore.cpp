@@ -0,0 +1,128 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPBlobStore.h"
+#include "UnrealClaudeModule.h"
+#include "Dom/JsonObject.h"
+
+FMCPBlobStore::FMCPBlobStore(int64 InMaxBytes)
+	: MaxBytes(InMaxBytes)
+{
+}
+
+FMCPBlobStore& FMCPBlobStore::Get()
+{
+	static FMCPBlobStore BlobStore;
+	return BlobStore;
+}
+
+TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> FMCPBlobStore::Publish(TArray<uint8>&& Data, const FString& ContentType, double LifetimeSeconds)
+{
+	if (Data.Num() > MaxBytes)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Blob of %d bytes is larger than the blob store (%lld bytes)"), Data.Num(), MaxBytes);
+		return nullptr;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+
+	TSharedRef<FMCPBlob, ESPMode::ThreadSafe> Blob = MakeShared<FMCPBlob, ESPMode::ThreadSafe>();
+	Blob->Id = FGuid::NewGuid();
+	Blob->ContentType = ContentType;
+	Blob->Data = MoveTemp(Data);
+	Blob->CreatedTime = Now;
+	Blob->ExpireTime = Now + LifetimeSeconds;
+
+	FScopeLock Lock(&BlobsLock);
+
+	RemoveExpired(Now);
+	EvictFor(Blob->Data.Num());
+
+	Blobs.Add(Blob->Id, Blob);
+	TotalBytes += Blob->Data.Num();
+
+	return Blob;
+}
+
+TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> FMCPBlobStore::Find(const FGuid& Id)
+{
+	FScopeLock Lock(&BlobsLock);
+
+	RemoveExpired(FPlatformTime::Seconds());
+
+	const TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe>* Blob = Blobs.Find(Id);
+	return Blob ? *Blob : nullptr;
+}
+
+bool FMCPBlobStore::Remove(const FGuid& Id)
+{
+	FScopeLock Lock(&BlobsLock);
+
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Blob;
+	if (!Blobs.RemoveAndCopyValue(Id, Blob))
+	{
+		return false;
+	}
+
+	TotalBytes -= Blob->Data.Num();
+	return true;
+}
+
+void FMCPBlobStore::RemoveExpired(double Now)
+{
+	FScopeLock Lock(&BlobsLock);
+
+	for (auto It = Blobs.CreateIterator(); It; ++It)
+	{
+		if (It.Value()->ExpireTime <= Now)
+		{
+			TotalBytes -= It.Value()->Data.Num();
+			It.RemoveCurrent();
+		}
+	}
+}
+
+int32 FMCPBlobStore::Num() const
+{
+	FScopeLock Lock(&BlobsLock);
+	return Blobs.Num();
+}
+
+int64 FMCPBlobStore::GetTotalBytes() const
+{
+	FScopeLock Lock(&BlobsLock);
+	return TotalBytes;
+}
+
+TSharedPtr<FJsonObject> FMCPBlobStore::MakeHandleJson(const FMCPBlob& Blob)
+{
+	TSharedPtr<FJsonObject> HandleJson = MakeShared<FJsonObject>();
+	HandleJson->SetStringField(TEXT("blob_id"), Blob.Id.ToString());
+	HandleJson->SetStringField(TEXT("url"), FString::Printf(TEXT("/mcp/blob/%s"), *Blob.Id.ToString()));
+	HandleJson->SetStringField(TEXT("content_type"), Blob.ContentType);
+	HandleJson->SetNumberField(TEXT("size"), Blob.Data.Num());
+	HandleJson->SetNumberField(TEXT("expires_in"), FMath::Max(0, FMath::CeilToInt(Blob.ExpireTime - FPlatformTime::Seconds())));
+	return HandleJson;
+}
+
+void FMCPBlobStore::EvictFor(int64 Bytes)
+{
+	// Only a handful of blobs are ever held, a linear search for the oldest is fine
+	while (TotalBytes + Bytes > MaxBytes && Blobs.Num() > 0)
+	{
+		const FMCPBlob* Oldest = nullptr;
+		for (const auto& Pair : Blobs)
+		{
+			if (!Oldest || Pair.Value->CreatedTime < Oldest->CreatedTime)
+			{
+				Oldest = Pair.Value.Get();
+			}
+		}
+
+		UE_LOG(LogUnrealClaude, Verbose, TEXT("Evicting blob %s (%d bytes) to stay under the blob store cap"),
+			*Oldest->Id.ToString(), Oldest->Data.Num());
+
+		const FGuid OldestId = Oldest->Id;
+		TotalBytes -= Oldest->Data.Num();
+		Blobs.Remove(OldestId);
+	}
+}
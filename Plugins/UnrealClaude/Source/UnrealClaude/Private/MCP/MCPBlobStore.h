@@ -0,0 +1,92 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UnrealClaudeConstants.h"
+
+class FJsonObject;
+
+/**
+ * A binary tool result held for clients to download
+ */
+struct FMCPBlob
+{
+	/** Blob identifier, part of its download url */
+	FGuid Id;
+
+	/** MIME type sent with the bytes */
+	FString ContentType;
+
+	/** The bytes */
+	TArray<uint8> Data;
+
+	/** When the blob was published (FPlatformTime::Seconds) */
+	double CreatedTime = 0.0;
+
+	/** When the blob stops being served (FPlatformTime::Seconds) */
+	double ExpireTime = 0.0;
+};
+
+/**
+ * Side channel for binary tool results such as viewport captures
+ *
+ * Tools publish bytes here and return the handle JSON in their result instead of base64 text.
+ * Clients download the raw bytes with GET /mcp/blob/{id}. Blobs expire after their lifetime,
+ * and the oldest are evicted when a new one would go over the memory cap.
+ */
+class FMCPBlobStore
+{
+public:
+	explicit FMCPBlobStore(int64 InMaxBytes = UnrealClaudeConstants::MCPServer::BlobStoreMaxBytes);
+
+	/** Get the store shared by the tools and the server */
+	static FMCPBlobStore& Get();
+
+	/**
+	 * Publish bytes for download
+	 * @param Data - The bytes, moved into the store
+	 * @param ContentType - MIME type to serve them with
+	 * @param LifetimeSeconds - How long the blob is served
+	 * @return The published blob, or nullptr if it's larger than the whole store
+	 */
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Publish(TArray<uint8>&& Data, const FString& ContentType,
+		double LifetimeSeconds = UnrealClaudeConstants::MCPServer::BlobLifetimeSeconds);
+
+	/** Find a blob that hasn't expired */
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Find(const FGuid& Id);
+
+	/** Drop a blob before it expires */
+	bool Remove(const FGuid& Id);
+
+	/** Drop the blobs that expired by Now */
+	void RemoveExpired(double Now);
+
+	/** Get the number of blobs held */
+	int32 Num() const;
+
+	/** Get the bytes held by all blobs */
+	int64 GetTotalBytes() const;
+
+	/**
+	 * Build the handle a tool returns for a blob
+	 * @return { blob_id, url, content_type, size, expires_in }
+	 */
+	static TSharedPtr<FJsonObject> MakeHandleJson(const FMCPBlob& Blob);
+
+private:
+	/** Evict the oldest blobs until Bytes more fit under the cap (lock held) */
+	void EvictFor(int64 Bytes);
+
+	/** Blobs by id */
+	TMap<FGuid, TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe>> Blobs;
+
+	/** Bytes held by all blobs */
+	int64 TotalBytes = 0;
+
+	/** Memory cap */
+	int64 MaxBytes;
+
+	/** Tools publish on the game thread, but keep the map safe for any caller */
+	mutable FCriticalSection BlobsLock;
+};
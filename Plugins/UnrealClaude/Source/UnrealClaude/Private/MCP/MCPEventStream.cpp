@@ -0,0 +1,161 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPEventStream.h"
+#include "MCPAsyncTask.h"
+#include "UnrealClaudeConstants.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+FMCPEventStream::FMCPEventStream(const FString& InToolName)
+	: StreamId(FGuid::NewGuid())
+	, ToolName(InToolName)
+{
+	// Event 0 tells the client where to reconnect for the rest
+	TSharedRef<FJsonObject> StreamJson = MakeShared<FJsonObject>();
+	StreamJson->SetStringField(TEXT("stream_id"), StreamId.ToString());
+	StreamJson->SetStringField(TEXT("tool"), ToolName);
+	StreamJson->SetStringField(TEXT("events_url"), FString::Printf(TEXT("/mcp/stream/%s"), *StreamId.ToString()));
+	PushEvent(TEXT("stream"), StreamJson);
+}
+
+void FMCPEventStream::PushEvent(const FString& Type, const TSharedRef<FJsonObject>& Data)
+{
+	if (bClosed)
+	{
+		return;
+	}
+
+	FMCPStreamEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Id = Events.Num() - 1;
+	Event.Type = Type;
+
+	// SSE data lines can't contain newlines, so always write condensed JSON
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Event.Data);
+	FJsonSerializer::Serialize(Data, Writer);
+
+	FlushWaiters();
+}
+
+void FMCPEventStream::PushProgress(const FMCPToolProgress& Progress)
+{
+	TSharedRef<FJsonObject> ProgressJson = MakeShared<FJsonObject>();
+	ProgressJson->SetNumberField(TEXT("progress"), Progress.Percent);
+	ProgressJson->SetStringField(TEXT("message"), Progress.Message);
+
+	if (Progress.PartialData.IsValid())
+	{
+		ProgressJson->SetObjectField(TEXT("partial"), Progress.PartialData);
+	}
+
+	PushEvent(TEXT("progress"), ProgressJson);
+}
+
+void FMCPEventStream::Close(const FMCPToolResult& Result)
+{
+	TSharedRef<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+	ResultJson->SetBoolField(TEXT("success"), Result.bSuccess);
+	ResultJson->SetStringField(TEXT("message"), Result.Message);
+
+	if (Result.Data.IsValid())
+	{
+		ResultJson->SetObjectField(TEXT("data"), Result.Data);
+	}
+
+	PushEvent(TEXT("result"), ResultJson);
+
+	bClosed = true;
+	ClosedTime = FPlatformTime::Seconds();
+	FollowedTask.Reset();
+}
+
+void FMCPEventStream::FollowTask(TSharedPtr<FMCPAsyncTask> Task)
+{
+	FollowedTask = Task;
+	LastTaskProgress = -1;
+	LastTaskProgressMessage.Reset();
+}
+
+void FMCPEventStream::Poll(int32 LastEventId, FRespondFunc Respond)
+{
+	TConstArrayView<FMCPStreamEvent> NewEvents = GetEventsAfter(LastEventId);
+
+	if (NewEvents.Num() > 0 || bClosed)
+	{
+		Respond(FormatEvents(NewEvents));
+		return;
+	}
+
+	Waiters.Add({ LastEventId, FPlatformTime::Seconds() + UnrealClaudeConstants::MCPServer::StreamWaitSeconds, MoveTemp(Respond) });
+}
+
+bool FMCPEventStream::Tick(double Now)
+{
+	if (FollowedTask.IsValid())
+	{
+		const int32 Progress = FollowedTask->Progress.Load();
+
+		if (Progress != LastTaskProgress || FollowedTask->ProgressMessage != LastTaskProgressMessage)
+		{
+			LastTaskProgress = Progress;
+			LastTaskProgressMessage = FollowedTask->ProgressMessage;
+			PushProgress(FMCPToolProgress(Progress, LastTaskProgressMessage));
+		}
+
+		if (FollowedTask->IsComplete())
+		{
+			Close(FollowedTask->Result);
+		}
+	}
+
+	// Nothing new in a while, send a comment so the client reconnects instead of timing out
+	for (int32 Index = Waiters.Num() - 1; Index >= 0; --Index)
+	{
+		if (Waiters[Index].Deadline <= Now)
+		{
+			FRespondFunc Respond = MoveTemp(Waiters[Index].Respond);
+			Waiters.RemoveAt(Index);
+			Respond(TEXT(": waiting\n\n"));
+		}
+	}
+
+	return !bClosed || Now - ClosedTime < UnrealClaudeConstants::MCPServer::StreamRetentionSeconds;
+}
+
+FString FMCPEventStream::FormatEvents(TConstArrayView<FMCPStreamEvent> InEvents)
+{
+	FString Body;
+
+	for (const FMCPStreamEvent& Event : InEvents)
+	{
+		Body += FString::Printf(TEXT("id: %d\nevent: %s\ndata: %s\n\n"), Event.Id, *Event.Type, *Event.Data);
+	}
+
+	return Body;
+}
+
+void FMCPEventStream::FlushWaiters()
+{
+	// Respond may re-enter through a new request, so detach the waiters first
+	TArray<FWaiter> ReadyWaiters = MoveTemp(Waiters);
+	Waiters.Reset();
+
+	for (FWaiter& Waiter : ReadyWaiters)
+	{
+		TConstArrayView<FMCPStreamEvent> NewEvents = GetEventsAfter(Waiter.LastEventId);
+
+		if (NewEvents.Num() > 0)
+		{
+			Waiter.Respond(FormatEvents(NewEvents));
+		}
+		else
+		{
+			Waiters.Add(MoveTemp(Waiter));
+		}
+	}
+}
+
+TConstArrayView<FMCPStreamEvent> FMCPEventStream::GetEventsAfter(int32 LastEventId) const
+{
+	const int32 FirstIndex = FMath::Clamp(LastEventId + 1, 0, Events.Num());
+	return TConstArrayView<FMCPStreamEvent>(Events).RightChop(FirstIndex);
+}
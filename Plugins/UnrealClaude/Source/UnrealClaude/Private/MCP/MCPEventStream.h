@@ -0,0 +1,123 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPToolRegistry.h"
+#include "MCPToolProgress.h"
+
+struct FMCPAsyncTask;
+
+/**
+ * A single event in a tool event stream
+ */
+struct FMCPStreamEvent
+{
+	/** Sequential event id, sent as the SSE id */
+	int32 Id = 0;
+
+	/** Event type: stream, progress, queued or result */
+	FString Type;
+
+	/** Event payload as single-line JSON */
+	FString Data;
+};
+
+/**
+ * Server-sent events for one streamed tool call
+ *
+ * The engine HTTP server can't write to a response after handing it over, so streams follow the
+ * SSE reconnect model: every request receives the events after its Last-Event-ID, waiting for the
+ * next one if there are none yet, and the client reconnects until the result event ends the stream.
+ * Progress reported by the tool arrives as it happens instead of on the next task_status poll.
+ *
+ * Game thread only, like the HTTP route handlers and the tools themselves.
+ */
+class FMCPEventStream : public TSharedFromThis<FMCPEventStream>
+{
+public:
+	/** Callback answering a waiting request with an event-stream body */
+	using FRespondFunc = TFunction<void(const FString& Body)>;
+
+	explicit FMCPEventStream(const FString& InToolName);
+
+	/** Get the stream id */
+	const FGuid& GetId() const { return StreamId; }
+
+	/** Get the name of the streamed tool */
+	const FString& GetToolName() const { return ToolName; }
+
+	/** Check if the result event has been sent */
+	bool IsClosed() const { return bClosed; }
+
+	/** Get all events so far */
+	const TArray<FMCPStreamEvent>& GetEvents() const { return Events; }
+
+	/** Add an event and answer the requests waiting for it */
+	void PushEvent(const FString& Type, const TSharedRef<FJsonObject>& Data);
+
+	/** Add a progress event, usable as an FMCPToolProgressSink */
+	void PushProgress(const FMCPToolProgress& Progress);
+
+	/** Add the result event and close the stream, answering every waiting request */
+	void Close(const FMCPToolResult& Result);
+
+	/** Keep the stream open until an async task finishes, forwarding its progress and result */
+	void FollowTask(TSharedPtr<FMCPAsyncTask> Task);
+
+	/**
+	 * Answer with the events after LastEventId, or hold the request until there is one
+	 * @param LastEventId - Id of the last event the client received, -1 for all events
+	 * @param Respond - Called with the event-stream body, possibly later from PushEvent or Tick
+	 */
+	void Poll(int32 LastEventId, FRespondFunc Respond);
+
+	/**
+	 * Check the followed task and answer requests that waited too long
+	 * @return false once the stream is closed and old enough to drop
+	 */
+	bool Tick(double Now);
+
+	/** Format events as a text/event-stream body */
+	static FString FormatEvents(TConstArrayView<FMCPStreamEvent> Events);
+
+private:
+	/** A request waiting for the next event */
+	struct FWaiter
+	{
+		int32 LastEventId;
+		double Deadline;
+		FRespondFunc Respond;
+	};
+
+	/** Answer the waiters that have new events */
+	void FlushWaiters();
+
+	/** Get the events after LastEventId */
+	TConstArrayView<FMCPStreamEvent> GetEventsAfter(int32 LastEventId) const;
+
+	/** Stream identifier */
+	FGuid StreamId;
+
+	/** Name of the streamed tool */
+	FString ToolName;
+
+	/** All events so far, ids match indices */
+	TArray<FMCPStreamEvent> Events;
+
+	/** Requests waiting for the next event */
+	TArray<FWaiter> Waiters;
+
+	/** Async task being followed, if any */
+	TSharedPtr<FMCPAsyncTask> FollowedTask;
+
+	/** Last forwarded task progress, to only send changes */
+	int32 LastTaskProgress = -1;
+	FString LastTaskProgressMessage;
+
+	/** Whether the result event has been sent */
+	bool bClosed = false;
+
+	/** When the result event was sent */
+	double ClosedTime = 0.0;
+};
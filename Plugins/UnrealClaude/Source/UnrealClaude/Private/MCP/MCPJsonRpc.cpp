@@ -0,0 +1,163 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPJsonRpc.h"
+#include "MCPBlobStore.h"
+#include "JsonUtils.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/Base64.h"
+
+const TArray<FString>& FMCPJsonRpc::GetSupportedProtocolVersions()
+{
+	static const TArray<FString> Versions = {
+		TEXT("2025-06-18"),
+		TEXT("2025-03-26"),
+		TEXT("2024-11-05")
+	};
+	return Versions;
+}
+
+FString FMCPJsonRpc::NegotiateProtocolVersion(const FString& RequestedVersion)
+{
+	const TArray<FString>& Versions = GetSupportedProtocolVersions();
+	return Versions.Contains(RequestedVersion) ? RequestedVersion : Versions[0];
+}
+
+TSharedRef<FJsonObject> FMCPJsonRpc::MakeResponse(const TSharedPtr<FJsonValue>& Id, const TSharedRef<FJsonObject>& Result)
+{
+	TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+	ResponseJson->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+	ResponseJson->SetField(TEXT("id"), Id.IsValid() ? Id : MakeShared<FJsonValueNull>());
+	ResponseJson->SetObjectField(TEXT("result"), Result);
+	return ResponseJson;
+}
+
+TSharedRef<FJsonObject> FMCPJsonRpc::MakeError(const TSharedPtr<FJsonValue>& Id, int32 Code, const FString& Message)
+{
+	TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+	ErrorJson->SetNumberField(TEXT("code"), Code);
+	ErrorJson->SetStringField(TEXT("message"), Message);
+
+	TSharedRef<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+	ResponseJson->SetStringField(TEXT("jsonrpc"), TEXT("2.0"));
+	ResponseJson->SetField(TEXT("id"), Id.IsValid() ? Id : MakeShared<FJsonValueNull>());
+	ResponseJson->SetObjectField(TEXT("error"), ErrorJson);
+	return ResponseJson;
+}
+
+TSharedRef<FJsonObject> FMCPJsonRpc::BuildInitializeResult(const TSharedPtr<FJsonObject>& Params)
+{
+	FString RequestedVersion;
+	FJsonUtils::GetStringField(Params, TEXT("protocolVersion"), RequestedVersion);
+
+	// Tools are registered at startup, so the listing never changes under a session
+	TSharedPtr<FJsonObject> ToolsCapability = MakeShared<FJsonObject>();
+	ToolsCapability->SetBoolField(TEXT("listChanged"), false);
+
+	TSharedPtr<FJsonObject> Capabilities = MakeShared<FJsonObject>();
+	Capabilities->SetObjectField(TEXT("tools"), ToolsCapability);
+
+	TSharedPtr<FJsonObject> ServerInfo = MakeShared<FJsonObject>();
+	ServerInfo->SetStringField(TEXT("name"), TEXT("unrealclaude"));
+	ServerInfo->SetStringField(TEXT("title"), TEXT("UnrealClaude"));
+	ServerInfo->SetStringField(TEXT("version"), TEXT("1.0.0"));
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("protocolVersion"), NegotiateProtocolVersion(RequestedVersion));
+	Result->SetObjectField(TEXT("capabilities"), Capabilities);
+	Result->SetObjectField(TEXT("serverInfo"), ServerInfo);
+	return Result;
+}
+
+TSharedRef<FJsonObject> FMCPJsonRpc::ToolInfoToJson(const FMCPToolInfo& Info)
+{
+	TSharedPtr<FJsonObject> Properties = MakeShared<FJsonObject>();
+	TArray<TSharedPtr<FJsonValue>> Required;
+
+	for (const FMCPToolParameter& Param : Info.Parameters)
+	{
+		// Same mapping as the bridge, unknown types are passed as strings
+		const bool bKnownType = Param.Type == TEXT("number") || Param.Type == TEXT("boolean")
+			|| Param.Type == TEXT("array") || Param.Type == TEXT("object");
+
+		TSharedPtr<FJsonObject> PropertyJson = MakeShared<FJsonObject>();
+		PropertyJson->SetStringField(TEXT("type"), bKnownType ? Param.Type : TEXT("string"));
+		PropertyJson->SetStringField(TEXT("description"), Param.Description);
+		if (!Param.DefaultValue.IsEmpty())
+		{
+			PropertyJson->SetStringField(TEXT("default"), Param.DefaultValue);
+		}
+		Properties->SetObjectField(Param.Name, PropertyJson);
+
+		if (Param.bRequired)
+		{
+			Required.Add(MakeShared<FJsonValueString>(Param.Name));
+		}
+	}
+
+	TSharedPtr<FJsonObject> InputSchema = MakeShared<FJsonObject>();
+	InputSchema->SetStringField(TEXT("type"), TEXT("object"));
+	InputSchema->SetObjectField(TEXT("properties"), Properties);
+	if (Required.Num() > 0)
+	{
+		InputSchema->SetArrayField(TEXT("required"), Required);
+	}
+
+	TSharedPtr<FJsonObject> AnnotationsJson = MakeShared<FJsonObject>();
+	AnnotationsJson->SetBoolField(TEXT("readOnlyHint"), Info.Annotations.bReadOnlyHint);
+	AnnotationsJson->SetBoolField(TEXT("destructiveHint"), Info.Annotations.bDestructiveHint);
+	AnnotationsJson->SetBoolField(TEXT("idempotentHint"), Info.Annotations.bIdempotentHint);
+	AnnotationsJson->SetBoolField(TEXT("openWorldHint"), Info.Annotations.bOpenWorldHint);
+
+	TSharedRef<FJsonObject> ToolJson = MakeShared<FJsonObject>();
+	ToolJson->SetStringField(TEXT("name"), Info.Name);
+	ToolJson->SetStringField(TEXT("description"), Info.Description);
+	ToolJson->SetObjectField(TEXT("inputSchema"), InputSchema);
+	ToolJson->SetObjectField(TEXT("annotations"), AnnotationsJson);
+	return ToolJson;
+}
+
+TSharedRef<FJsonObject> FMCPJsonRpc::BuildToolCallResult(const FMCPToolResult& Result)
+{
+	TArray<TSharedPtr<FJsonValue>> Content;
+
+	// Same text the bridge produces, so clients see identical results on either transport
+	FString Text;
+	if (Result.bSuccess)
+	{
+		Text = Result.Data.IsValid() ? Result.Message + TEXT("\n\n") + FJsonUtils::Stringify(Result.Data) : Result.Message;
+	}
+	else
+	{
+		Text = TEXT("Error: ") + Result.Message;
+	}
+
+	TSharedPtr<FJsonObject> TextJson = MakeShared<FJsonObject>();
+	TextJson->SetStringField(TEXT("type"), TEXT("text"));
+	TextJson->SetStringField(TEXT("text"), Text);
+	Content.Add(MakeShared<FJsonValueObject>(TextJson));
+
+	// The blob is right here, inline it rather than making the client fetch it
+	const TSharedPtr<FJsonObject>* BlobHandle = nullptr;
+	FString BlobIdString;
+	FGuid BlobId;
+	if (Result.bSuccess && Result.Data.IsValid()
+		&& Result.Data->TryGetObjectField(TEXT("image_blob"), BlobHandle)
+		&& (*BlobHandle)->TryGetStringField(TEXT("blob_id"), BlobIdString)
+		&& FGuid::Parse(BlobIdString, BlobId))
+	{
+		if (TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Blob = FMCPBlobStore::Get().Find(BlobId))
+		{
+			TSharedPtr<FJsonObject> ImageJson = MakeShared<FJsonObject>();
+			ImageJson->SetStringField(TEXT("type"), TEXT("image"));
+			ImageJson->SetStringField(TEXT("data"), FBase64::Encode(Blob->Data));
+			ImageJson->SetStringField(TEXT("mimeType"), Blob->ContentType);
+			Content.Add(MakeShared<FJsonValueObject>(ImageJson));
+		}
+	}
+
+	TSharedRef<FJsonObject> CallResult = MakeShared<FJsonObject>();
+	CallResult->SetArrayField(TEXT("content"), Content);
+	CallResult->SetBoolField(TEXT("isError"), !Result.bSuccess);
+	return CallResult;
+}
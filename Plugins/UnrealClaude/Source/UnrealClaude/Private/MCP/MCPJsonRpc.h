@@ -0,0 +1,55 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCPToolRegistry.h"
+
+class FJsonValue;
+
+/**
+ * JSON-RPC error codes used by the MCP endpoint
+ */
+namespace MCPJsonRpcErrors
+{
+	constexpr int32 ParseError = -32700;
+	constexpr int32 InvalidRequest = -32600;
+	constexpr int32 MethodNotFound = -32601;
+	constexpr int32 InvalidParams = -32602;
+	constexpr int32 InternalError = -32603;
+}
+
+/**
+ * Message building for the native MCP endpoint (POST /mcp, streamable HTTP transport)
+ *
+ * Lets MCP clients talk to the editor directly instead of through the Node bridge.
+ * Tool names, schemas and annotations match what the bridge derives from GET /mcp/tools,
+ * without its unreal_ prefix.
+ */
+class FMCPJsonRpc
+{
+public:
+	/** Protocol versions the endpoint speaks, newest first */
+	static const TArray<FString>& GetSupportedProtocolVersions();
+
+	/** Pick the version to answer initialize with: the client's if supported, else the newest */
+	static FString NegotiateProtocolVersion(const FString& RequestedVersion);
+
+	/** Build a JSON-RPC success response */
+	static TSharedRef<FJsonObject> MakeResponse(const TSharedPtr<FJsonValue>& Id, const TSharedRef<FJsonObject>& Result);
+
+	/** Build a JSON-RPC error response, Id may be null when the request couldn't be read */
+	static TSharedRef<FJsonObject> MakeError(const TSharedPtr<FJsonValue>& Id, int32 Code, const FString& Message);
+
+	/** Build the initialize result */
+	static TSharedRef<FJsonObject> BuildInitializeResult(const TSharedPtr<FJsonObject>& Params);
+
+	/** Convert a tool to its tools/list entry with inputSchema and annotations */
+	static TSharedRef<FJsonObject> ToolInfoToJson(const FMCPToolInfo& Info);
+
+	/**
+	 * Convert a tool result to a tools/call result
+	 * The message and data go in a text block, an image_blob handle also comes back as image content.
+	 */
+	static TSharedRef<FJsonObject> BuildToolCallResult(const FMCPToolResult& Result);
+};
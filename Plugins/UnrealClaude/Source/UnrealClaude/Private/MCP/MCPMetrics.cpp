@@ -0,0 +1,228 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPMetrics.h"
+#include "MCPTaskQueue.h"
+#include "HttpServerResponse.h"
+
+const double FMCPLatencyHistogram::BucketBounds[NumBuckets] = {
+	0.001, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0, 60.0
+};
+
+void FMCPLatencyHistogram::Observe(double Seconds)
+{
+	int32 Bucket = 0;
+	while (Bucket < NumBuckets && Seconds > BucketBounds[Bucket])
+	{
+		++Bucket;
+	}
+
+	BucketCounts[Bucket].fetch_add(1, std::memory_order_relaxed);
+	SumMicroseconds.fetch_add(static_cast<uint64>(FMath::Max(Seconds, 0.0) * 1000000.0), std::memory_order_relaxed);
+}
+
+uint64 FMCPLatencyHistogram::GetCount() const
+{
+	uint64 Count = 0;
+	for (const std::atomic<uint64>& BucketCount : BucketCounts)
+	{
+		Count += BucketCount.load(std::memory_order_relaxed);
+	}
+	return Count;
+}
+
+void FMCPLatencyHistogram::Write(FString& Out, const TCHAR* Name, const FString& Labels) const
+{
+	const FString LabelPrefix = Labels.IsEmpty() ? FString() : Labels + TEXT(",");
+
+	// Prometheus buckets are cumulative
+	uint64 Cumulative = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		Cumulative += BucketCounts[Bucket].load(std::memory_order_relaxed);
+		Out += FString::Printf(TEXT("%s_bucket{%sle=\"%g\"} %llu\n"), Name, *LabelPrefix, BucketBounds[Bucket], Cumulative);
+	}
+
+	Cumulative += BucketCounts[NumBuckets].load(std::memory_order_relaxed);
+	Out += FString::Printf(TEXT("%s_bucket{%sle=\"+Inf\"} %llu\n"), Name, *LabelPrefix, Cumulative);
+
+	const FString LabelSet = Labels.IsEmpty() ? FString() : FString::Printf(TEXT("{%s}"), *Labels);
+	Out += FString::Printf(TEXT("%s_sum%s %.6f\n"), Name, *LabelSet, SumMicroseconds.load(std::memory_order_relaxed) / 1000000.0);
+	Out += FString::Printf(TEXT("%s_count%s %llu\n"), Name, *LabelSet, Cumulative);
+}
+
+FMCPMetrics& FMCPMetrics::Get()
+{
+	static FMCPMetrics Metrics;
+	return Metrics;
+}
+
+void FMCPMetrics::RecordToolCall(const FString& ToolName, bool bSuccess, double Seconds)
+{
+	check(IsInGameThread());
+
+	TUniquePtr<FMCPToolMetrics>& Tool = ToolMetrics.FindOrAdd(ToolName);
+	if (!Tool.IsValid())
+	{
+		Tool = MakeUnique<FMCPToolMetrics>();
+	}
+
+	Tool->Calls.fetch_add(1, std::memory_order_relaxed);
+	if (!bSuccess)
+	{
+		Tool->Errors.fetch_add(1, std::memory_order_relaxed);
+	}
+	Tool->Duration.Observe(Seconds);
+}
+
+void FMCPMetrics::RecordCompression(uint64 OriginalBytes, uint64 SentBytes, double Seconds)
+{
+	if (SentBytes < OriginalBytes)
+	{
+		CompressedResponses.fetch_add(1, std::memory_order_relaxed);
+		CompressionBytesSaved.fetch_add(OriginalBytes - SentBytes, std::memory_order_relaxed);
+	}
+
+	CompressionMicroseconds.fetch_add(static_cast<uint64>(FMath::Max(Seconds, 0.0) * 1000000.0), std::memory_order_relaxed);
+}
+
+void FMCPMetrics::BeginRequest()
+{
+	InFlightRequests.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FMCPMetrics::EndRequest(int32 StatusCode)
+{
+	InFlightRequests.fetch_sub(1, std::memory_order_relaxed);
+
+	const int32 StatusClass = FMath::Clamp(StatusCode / 100, 1, 5);
+	ResponsesByClass[StatusClass - 1].fetch_add(1, std::memory_order_relaxed);
+}
+
+const FMCPToolMetrics* FMCPMetrics::FindTool(const FString& ToolName) const
+{
+	const TUniquePtr<FMCPToolMetrics>* Tool = ToolMetrics.Find(ToolName);
+	return Tool ? Tool->Get() : nullptr;
+}
+
+TUniquePtr<FHttpServerResponse> FMCPMetrics::CreateResponse(const FMCPTaskQueue* TaskQueue) const
+{
+	// Create appends ";charset=utf-8" itself, a second charset parameter makes scrapers reject the header
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Format(TaskQueue), TEXT("text/plain; version=0.0.4"));
+	Response->Code = EHttpServerResponseCodes::Ok;
+	return Response;
+}
+
+FString FMCPMetrics::Format(const FMCPTaskQueue* TaskQueue) const
+{
+	check(IsInGameThread());
+
+	FString Out;
+
+	// Sorted so consecutive scrapes diff cleanly
+	TArray<FString> ToolNames;
+	ToolMetrics.GetKeys(ToolNames);
+	ToolNames.Sort();
+
+	Out += TEXT("# HELP unrealclaude_mcp_tool_calls_total Tool calls executed, by tool.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_tool_calls_total counter\n");
+	for (const FString& ToolName : ToolNames)
+	{
+		Out += FString::Printf(TEXT("unrealclaude_mcp_tool_calls_total{tool=\"%s\"} %llu\n"),
+			*EscapeLabelValue(ToolName), ToolMetrics[ToolName]->Calls.load(std::memory_order_relaxed));
+	}
+
+	Out += TEXT("# HELP unrealclaude_mcp_tool_errors_total Tool calls that returned an error, by tool.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_tool_errors_total counter\n");
+	for (const FString& ToolName : ToolNames)
+	{
+		Out += FString::Printf(TEXT("unrealclaude_mcp_tool_errors_total{tool=\"%s\"} %llu\n"),
+			*EscapeLabelValue(ToolName), ToolMetrics[ToolName]->Errors.load(std::memory_order_relaxed));
+	}
+
+	Out += TEXT("# HELP unrealclaude_mcp_tool_duration_seconds Time spent executing tools on the game thread, by tool.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_tool_duration_seconds histogram\n");
+	for (const FString& ToolName : ToolNames)
+	{
+		ToolMetrics[ToolName]->Duration.Write(Out, TEXT("unrealclaude_mcp_tool_duration_seconds"),
+			FString::Printf(TEXT("tool=\"%s\""), *EscapeLabelValue(ToolName)));
+	}
+
+	Out += TEXT("# HELP unrealclaude_mcp_game_thread_wait_seconds Time work queued for the game thread waited before running.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_game_thread_wait_seconds histogram\n");
+	GameThreadWait.Write(Out, TEXT("unrealclaude_mcp_game_thread_wait_seconds"), FString());
+
+	Out += TEXT("# HELP unrealclaude_mcp_http_requests_in_flight Requests being handled.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_http_requests_in_flight gauge\n");
+	Out += FString::Printf(TEXT("unrealclaude_mcp_http_requests_in_flight %lld\n"), GetInFlightRequests());
+
+	Out += TEXT("# HELP unrealclaude_mcp_http_responses_total Responses sent, by status class.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_http_responses_total counter\n");
+	for (int32 StatusClass = 1; StatusClass <= 5; ++StatusClass)
+	{
+		Out += FString::Printf(TEXT("unrealclaude_mcp_http_responses_total{code=\"%dxx\"} %llu\n"),
+			StatusClass, ResponsesByClass[StatusClass - 1].load(std::memory_order_relaxed));
+	}
+
+	Out += TEXT("# HELP unrealclaude_mcp_compressed_responses_total Responses sent gzip or deflate compressed.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_compressed_responses_total counter\n");
+	Out += FString::Printf(TEXT("unrealclaude_mcp_compressed_responses_total %llu\n"), CompressedResponses.load(std::memory_order_relaxed));
+
+	Out += TEXT("# HELP unrealclaude_mcp_compression_saved_bytes_total Response body bytes saved by compression.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_compression_saved_bytes_total counter\n");
+	Out += FString::Printf(TEXT("unrealclaude_mcp_compression_saved_bytes_total %llu\n"), CompressionBytesSaved.load(std::memory_order_relaxed));
+
+	Out += TEXT("# HELP unrealclaude_mcp_compression_seconds_total CPU time spent compressing responses.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_compression_seconds_total counter\n");
+	Out += FString::Printf(TEXT("unrealclaude_mcp_compression_seconds_total %.6f\n"), CompressionMicroseconds.load(std::memory_order_relaxed) / 1000000.0);
+
+	if (TaskQueue)
+	{
+		int32 Pending = 0;
+		int32 Running = 0;
+		int32 Completed = 0;
+		TaskQueue->GetStats(Pending, Running, Completed);
+
+		Out += TEXT("# HELP unrealclaude_mcp_task_queue_tasks Tasks in the async task queue, by status.\n");
+		Out += TEXT("# TYPE unrealclaude_mcp_task_queue_tasks gauge\n");
+		Out += FString::Printf(TEXT("unrealclaude_mcp_task_queue_tasks{status=\"pending\"} %d\n"), Pending);
+		Out += FString::Printf(TEXT("unrealclaude_mcp_task_queue_tasks{status=\"running\"} %d\n"), Running);
+		Out += FString::Printf(TEXT("unrealclaude_mcp_task_queue_tasks{status=\"completed\"} %d\n"), Completed);
+
+		Out += TEXT("# HELP unrealclaude_mcp_task_queue_max_concurrent Tasks the queue runs at once.\n");
+		Out += TEXT("# TYPE unrealclaude_mcp_task_queue_max_concurrent gauge\n");
+		Out += FString::Printf(TEXT("unrealclaude_mcp_task_queue_max_concurrent %d\n"), TaskQueue->Config.MaxConcurrentTasks);
+	}
+
+	Out += TEXT("# HELP unrealclaude_mcp_task_queue_wait_seconds Time tasks waited in the queue before a worker started them.\n");
+	Out += TEXT("# TYPE unrealclaude_mcp_task_queue_wait_seconds histogram\n");
+	TaskQueueWait.Write(Out, TEXT("unrealclaude_mcp_task_queue_wait_seconds"), FString());
+
+	return Out;
+}
+
+FString FMCPMetrics::EscapeLabelValue(const FString& Value)
+{
+	FString Escaped;
+	Escaped.Reserve(Value.Len());
+
+	for (const TCHAR Char : Value)
+	{
+		switch (Char)
+		{
+		case TEXT('\\'):
+			Escaped += TEXT("\\\\");
+			break;
+		case TEXT('"'):
+			Escaped += TEXT("\\\"");
+			break;
+		case TEXT('\n'):
+			Escaped += TEXT("\\n");
+			break;
+		default:
+			Escaped.AppendChar(Char);
+			break;
+		}
+	}
+
+	return Escaped;
+}
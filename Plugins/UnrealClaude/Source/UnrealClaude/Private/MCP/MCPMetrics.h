@@ -0,0 +1,148 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+class FMCPTaskQueue;
+struct FHttpServerResponse;
+
+/**
+ * Latency histogram with fixed buckets
+ *
+ * Observing only bumps atomic counters, so any thread can record without taking a lock.
+ */
+class FMCPLatencyHistogram
+{
+public:
+	/** Number of finite buckets, +Inf comes on top */
+	static constexpr int32 NumBuckets = 14;
+
+	/** Upper bounds of the finite buckets in seconds */
+	static const double BucketBounds[NumBuckets];
+
+	/** Record one observation */
+	void Observe(double Seconds);
+
+	/** Get the number of observations */
+	uint64 GetCount() const;
+
+	/**
+	 * Append the histogram in Prometheus text format, without HELP/TYPE lines
+	 * @param Out - Text to append to
+	 * @param Name - Metric name, _bucket/_sum/_count are appended to it
+	 * @param Labels - Extra labels such as tool="spawn_actor", or empty
+	 */
+	void Write(FString& Out, const TCHAR* Name, const FString& Labels) const;
+
+private:
+	/** Observations per bucket, not cumulative, the last one is +Inf */
+	std::atomic<uint64> BucketCounts[NumBuckets + 1] = {};
+
+	/** Sum of all observations in microseconds */
+	std::atomic<uint64> SumMicroseconds = 0;
+};
+
+/**
+ * Call statistics for one tool
+ */
+struct FMCPToolMetrics
+{
+	/** Calls that ran the tool */
+	std::atomic<uint64> Calls = 0;
+
+	/** Calls that returned an error result */
+	std::atomic<uint64> Errors = 0;
+
+	/** Time spent in the tool's Execute */
+	FMCPLatencyHistogram Duration;
+};
+
+/**
+ * MCP server metrics, exposed on GET /mcp/metrics in Prometheus text format
+ *
+ * Counters are relaxed atomics, so recording never blocks and a scrape doesn't hold up requests.
+ * Per-tool entries are created on the game thread, where every tool executes and the metrics
+ * route handler runs, so the tool map itself needs no lock either.
+ */
+class FMCPMetrics
+{
+public:
+	/** Get the metrics shared by the server, the tool registry and the task queue */
+	static FMCPMetrics& Get();
+
+	/**
+	 * Record a finished tool call (game thread only)
+	 * @param ToolName - Name of a registered tool
+	 * @param bSuccess - Whether the tool returned a success result
+	 * @param Seconds - Time spent executing the tool
+	 */
+	void RecordToolCall(const FString& ToolName, bool bSuccess, double Seconds);
+
+	/** Record how long work queued for the game thread waited before it started */
+	void RecordGameThreadWait(double Seconds) { GameThreadWait.Observe(Seconds); }
+
+	/** Record how long a task waited in the task queue before it started */
+	void RecordTaskQueueWait(double Seconds) { TaskQueueWait.Observe(Seconds); }
+
+	/**
+	 * Record a response compression attempt
+	 * @param OriginalBytes - Body size before compression
+	 * @param SentBytes - Body size sent, equal to OriginalBytes if compression didn't pay off
+	 * @param Seconds - Time spent compressing
+	 */
+	void RecordCompression(uint64 OriginalBytes, uint64 SentBytes, double Seconds);
+
+	/** Count a request the server started handling */
+	void BeginRequest();
+
+	/** Count a response the server sent, by its status code */
+	void EndRequest(int32 StatusCode);
+
+	/** Get the number of requests being handled */
+	int64 GetInFlightRequests() const { return InFlightRequests.load(std::memory_order_relaxed); }
+
+	/** Get the statistics of a tool, or nullptr if it hasn't been called yet (game thread only) */
+	const FMCPToolMetrics* FindTool(const FString& ToolName) const;
+
+	/**
+	 * Format all metrics in Prometheus text format (game thread only)
+	 * @param TaskQueue - Task queue to report the tasks of, may be null
+	 */
+	FString Format(const FMCPTaskQueue* TaskQueue) const;
+
+	/**
+	 * Create the GET /mcp/metrics response (game thread only)
+	 * @param TaskQueue - Queue to report depth for, may be null
+	 */
+	TUniquePtr<FHttpServerResponse> CreateResponse(const FMCPTaskQueue* TaskQueue) const;
+
+	/** Escape a Prometheus label value */
+	static FString EscapeLabelValue(const FString& Value);
+
+private:
+	/** Statistics per tool name */
+	TMap<FString, TUniquePtr<FMCPToolMetrics>> ToolMetrics;
+
+	/** Wait between queueing work for the game thread and it running */
+	FMCPLatencyHistogram GameThreadWait;
+
+	/** Wait between submitting a task and a worker starting it */
+	FMCPLatencyHistogram TaskQueueWait;
+
+	/** Requests started but not answered yet */
+	std::atomic<int64> InFlightRequests = 0;
+
+	/** Responses sent by status class, 1xx to 5xx */
+	std::atomic<uint64> ResponsesByClass[5] = {};
+
+	/** Responses sent compressed */
+	std::atomic<uint64> CompressedResponses = 0;
+
+	/** Body bytes compression removed from responses */
+	std::atomic<uint64> CompressionBytesSaved = 0;
+
+	/** Time spent compressing, including attempts that didn't shrink the body */
+	std::atomic<uint64> CompressionMicroseconds = 0;
+};
@@ -0,0 +1,168 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPResponseCompression.h"
+#include "MCPMetrics.h"
+#include "UnrealClaudeConstants.h"
+#include "HttpServerResponse.h"
+#include "Misc/Compression.h"
+
+EMCPContentEncoding FMCPResponseCompression::Negotiate(const TArray<FString>* AcceptEncoding)
+{
+	if (!AcceptEncoding)
+	{
+		return EMCPContentEncoding::Identity;
+	}
+
+	// -1 means not mentioned, 0 means explicitly refused
+	float GzipQuality = -1.0f;
+	float DeflateQuality = -1.0f;
+	float WildcardQuality = -1.0f;
+
+	// Header values may hold several comma separated codings, each with an optional ;q=
+	for (const FString& HeaderValue : *AcceptEncoding)
+	{
+		TArray<FString> Codings;
+		HeaderValue.ParseIntoArray(Codings, TEXT(","));
+
+		for (const FString& Coding : Codings)
+		{
+			FString Name = Coding;
+			FString Params;
+			Coding.Split(TEXT(";"), &Name, &Params);
+			Name.TrimStartAndEndInline();
+
+			float Quality = 1.0f;
+			Params.TrimStartAndEndInline();
+			if (Params.StartsWith(TEXT("q="), ESearchCase::IgnoreCase))
+			{
+				LexFromString(Quality, *Params.RightChop(2));
+			}
+
+			if (Name.Equals(TEXT("gzip"), ESearchCase::IgnoreCase) || Name.Equals(TEXT("x-gzip"), ESearchCase::IgnoreCase))
+			{
+				GzipQuality = Quality;
+			}
+			else if (Name.Equals(TEXT("deflate"), ESearchCase::IgnoreCase))
+			{
+				DeflateQuality = Quality;
+			}
+			else if (Name == TEXT("*"))
+			{
+				WildcardQuality = Quality;
+			}
+		}
+	}
+
+	// The wildcard covers codings that weren't named
+	if (GzipQuality < 0.0f)
+	{
+		GzipQuality = WildcardQuality;
+	}
+	if (DeflateQuality < 0.0f)
+	{
+		DeflateQuality = WildcardQuality;
+	}
+
+	if (GzipQuality > 0.0f && GzipQuality >= DeflateQuality)
+	{
+		return EMCPContentEncoding::Gzip;
+	}
+
+	if (DeflateQuality > 0.0f)
+	{
+		return EMCPContentEncoding::Deflate;
+	}
+
+	return EMCPContentEncoding::Identity;
+}
+
+bool FMCPResponseCompression::CompressResponse(FHttpServerResponse& Response, EMCPContentEncoding Encoding)
+{
+	if (Response.Body.Num() < UnrealClaudeConstants::MCPServer::CompressionMinBytes || Response.Headers.Contains(TEXT("Content-Encoding")))
+	{
+		return false;
+	}
+
+	// Event streams are read as they arrive and are small, images are compressed already
+	if (const TArray<FString>* ContentType = Response.Headers.Find(TEXT("Content-Type")))
+	{
+		if (ContentType->Num() > 0 && ((*ContentType)[0].StartsWith(TEXT("text/event-stream")) || (*ContentType)[0].StartsWith(TEXT("image/"))))
+		{
+			return false;
+		}
+	}
+
+	// The body would differ for a client sending another Accept-Encoding
+	Response.Headers.Add(TEXT("Vary"), { TEXT("Accept-Encoding") });
+
+	if (Encoding == EMCPContentEncoding::Identity)
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<uint8> Compressed;
+	const bool bCompressed = CompressBody(Response.Body, Encoding, Compressed) && Compressed.Num() < Response.Body.Num();
+
+	FMCPMetrics::Get().RecordCompression(Response.Body.Num(), bCompressed ? Compressed.Num() : Response.Body.Num(), FPlatformTime::Seconds() - StartTime);
+
+	if (!bCompressed)
+	{
+		return false;
+	}
+
+	Response.Body = MoveTemp(Compressed);
+	Response.Headers.Add(TEXT("Content-Encoding"), { GetEncodingName(Encoding) });
+
+	// The compressed bytes are a different representation, so the ETag is only weakly valid for them
+	if (TArray<FString>* ETag = Response.Headers.Find(TEXT("ETag")))
+	{
+		for (FString& Tag : *ETag)
+		{
+			if (!Tag.StartsWith(TEXT("W/")))
+			{
+				Tag = TEXT("W/") + Tag;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FMCPResponseCompression::CompressBody(TConstArrayView<uint8> Body, EMCPContentEncoding Encoding, TArray<uint8>& OutCompressed)
+{
+	// HTTP deflate is the zlib format, not raw deflate
+	const FName Format = Encoding == EMCPContentEncoding::Gzip ? NAME_Gzip : NAME_Zlib;
+
+	if (Encoding == EMCPContentEncoding::Identity || Body.Num() == 0)
+	{
+		return false;
+	}
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(Format, Body.Num());
+	OutCompressed.SetNumUninitialized(CompressedSize);
+
+	// Runs on the game thread with the response, so favor speed over ratio
+	if (!FCompression::CompressMemory(Format, OutCompressed.GetData(), CompressedSize, Body.GetData(), Body.Num(), COMPRESS_BiasSpeed))
+	{
+		OutCompressed.Reset();
+		return false;
+	}
+
+	OutCompressed.SetNum(CompressedSize, EAllowShrinking::No);
+	return true;
+}
+
+const TCHAR* FMCPResponseCompression::GetEncodingName(EMCPContentEncoding Encoding)
+{
+	switch (Encoding)
+	{
+	case EMCPContentEncoding::Gzip:
+		return TEXT("gzip");
+	case EMCPContentEncoding::Deflate:
+		return TEXT("deflate");
+	default:
+		return TEXT("identity");
+	}
+}
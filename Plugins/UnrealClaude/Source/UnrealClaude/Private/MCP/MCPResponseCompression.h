@@ -0,0 +1,52 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FHttpServerResponse;
+
+/**
+ * Content encodings the MCP server can answer with
+ */
+enum class EMCPContentEncoding : uint8
+{
+	Identity,
+	Gzip,
+	Deflate
+};
+
+/**
+ * gzip/deflate compression of MCP server responses, negotiated through Accept-Encoding
+ *
+ * Large results (level actors, asset searches, output log, base64 viewport captures) compress well,
+ * small ones aren't worth the CPU time and stay as they are.
+ */
+class FMCPResponseCompression
+{
+public:
+	/**
+	 * Pick the encoding for a response from the request's Accept-Encoding header
+	 * @param AcceptEncoding - Header values, may be null when the client sent none
+	 * @return The accepted encoding with the highest q-value, gzip winning ties
+	 */
+	static EMCPContentEncoding Negotiate(const TArray<FString>* AcceptEncoding);
+
+	/**
+	 * Compress a response body in place when it's large enough and compression actually shrinks it
+	 * Sets Content-Encoding and Vary, weakens an ETag, and records the savings in the metrics.
+	 * @param Response - Response to compress
+	 * @param Encoding - Negotiated encoding, Identity only adds Vary
+	 * @return true if the body was replaced with its compressed form
+	 */
+	static bool CompressResponse(FHttpServerResponse& Response, EMCPContentEncoding Encoding);
+
+	/**
+	 * Compress bytes with gzip or zlib (HTTP deflate)
+	 * @return false for Identity or if compression failed
+	 */
+	static bool CompressBody(TConstArrayView<uint8> Body, EMCPContentEncoding Encoding, TArray<uint8>& OutCompressed);
+
+	/** Get the Content-Encoding token of an encoding */
+	static const TCHAR* GetEncodingName(EMCPContentEncoding Encoding);
+};
@@ -2,6 +2,8 @@
 
 #include "MCPTaskQueue.h"
 #include "MCPToolRegistry.h"
+#include "MCPToolProgress.h"
+#include "MCPMetrics.h"
 #include "UnrealClaudeModule.h"
 #include "Async/Async.h"
 
@@ -330,6 +332,7 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 	// Mark as running
 	Task->Status.Store(EMCPTaskStatus::Running);
 	Task->StartedTime = FDateTime::UtcNow();
+	FMCPMetrics::Get().RecordTaskQueueWait((Task->StartedTime - Task->SubmittedTime).GetTotalSeconds());
 
 	UE_LOG(LogUnrealClaude, Log, TEXT("Task started: %s (tool: %s)"), *Task->TaskId.ToString(), *Task->ToolName);
 
@@ -366,9 +369,24 @@ void FMCPTaskQueue::ExecuteTask(TSharedPtr<FMCPAsyncTask> Task)
 			[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
 		TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> bCompleted = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
 
-		AsyncTask(ENamedThreads::GameThread, [SharedResult, Tool, Params, CompletionEvent, bCompleted]()
+		const double DispatchTime = FPlatformTime::Seconds();
+
+		AsyncTask(ENamedThreads::GameThread, [SharedResult, Tool, Params, CompletionEvent, bCompleted, Task, DispatchTime]()
 		{
+			FMCPMetrics& Metrics = FMCPMetrics::Get();
+			Metrics.RecordGameThreadWait(FPlatformTime::Seconds() - DispatchTime);
+
+			// Surface the tool's progress reports through task_status and event streams
+			FMCPToolProgressScope ProgressScope(FMCPToolProgressSink::CreateLambda([Task](const FMCPToolProgress& Progress)
+			{
+				Task->Progress.Store(Progress.Percent);
+				Task->ProgressMessage = Progress.Message;
+			}));
+
+			const double StartTime = FPlatformTime::Seconds();
 			*SharedResult = Tool->Execute(Params);
+			Metrics.RecordToolCall(Task->ToolName, SharedResult->bSuccess, FPlatformTime::Seconds() - StartTime);
+
 			*bCompleted = true;
 			CompletionEvent->Trigger();
 		});
@@ -43,6 +43,36 @@ AActor* FMCPToolBase::FindActorByNameOrLabel(UWorld* World, const FString& NameO
 	return nullptr;
 }
 
+bool FMCPToolBase::ActorMatchesFilter(const AActor* Actor, const FString& ClassFilter, const FString& NameFilter, bool bIncludeHidden) const
+{
+	if (!Actor)
+	{
+		return false;
+	}
+
+	// Skip hidden actors if not requested
+	if (!bIncludeHidden && Actor->IsHidden())
+	{
+		return false;
+	}
+
+	// Apply class filter
+	if (!ClassFilter.IsEmpty() && !Actor->GetClass()->GetName().Contains(ClassFilter, ESearchCase::IgnoreCase))
+	{
+		return false;
+	}
+
+	// Apply name filter
+	if (!NameFilter.IsEmpty() &&
+		!Actor->GetName().Contains(NameFilter, ESearchCase::IgnoreCase) &&
+		!Actor->GetActorLabel().Contains(NameFilter, ESearchCase::IgnoreCase))
+	{
+		return false;
+	}
+
+	return true;
+}
+
 void FMCPToolBase::MarkWorldDirty(UWorld* World) const
 {
 	if (World)
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "MCPToolRegistry.h"
 #include "MCPParamValidator.h"
+#include "MCPToolProgress.h"
 #include "UnrealClaudeUtils.h"
 
 // Forward declarations
@@ -35,6 +36,27 @@ protected:
 	 */
 	AActor* FindActorByNameOrLabel(UWorld* World, const FString& NameOrLabel) const;
 
+	/**
+	 * Check an actor against the get_level_actors style filters
+	 * @param Actor - The actor to check
+	 * @param ClassFilter - Substring of the actor class name, or empty to match any class
+	 * @param NameFilter - Substring of the actor name or label, or empty to match any name
+	 * @param bIncludeHidden - Whether hidden actors can match
+	 * @return true if the actor passes all filters
+	 */
+	bool ActorMatchesFilter(const AActor* Actor, const FString& ClassFilter, const FString& NameFilter, bool bIncludeHidden) const;
+
+	/**
+	 * Report progress to the client while the tool runs (no-op unless the call is streamed or queued)
+	 * @param Percent - Progress percentage (0-100), -1 if unknown
+	 * @param Message - Description of the current step
+	 * @param PartialData - Optional partial result
+	 */
+	void ReportProgress(int32 Percent, const FString& Message, TSharedPtr<FJsonObject> PartialData = nullptr) const
+	{
+		FMCPToolProgressScope::Report(FMCPToolProgress(Percent, Message, PartialData));
+	}
+
 	/**
 	 * Mark the world as dirty after modifications
 	 * @param World - The world to mark dirty
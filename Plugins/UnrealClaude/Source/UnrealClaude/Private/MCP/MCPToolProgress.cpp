@@ -0,0 +1,29 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPToolProgress.h"
+
+FMCPToolProgressScope* FMCPToolProgressScope::Current = nullptr;
+
+FMCPToolProgressScope::FMCPToolProgressScope(FMCPToolProgressSink InSink)
+	: Sink(MoveTemp(InSink))
+	, Previous(Current)
+{
+	check(IsInGameThread());
+	Current = this;
+}
+
+FMCPToolProgressScope::~FMCPToolProgressScope()
+{
+	check(Current == this);
+	Current = Previous;
+}
+
+void FMCPToolProgressScope::Report(const FMCPToolProgress& Progress)
+{
+	if (!IsInGameThread() || !Current)
+	{
+		return;
+	}
+
+	Current->Sink.ExecuteIfBound(Progress);
+}
@@ -0,0 +1,65 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Progress update reported by a tool while it runs
+ */
+struct FMCPToolProgress
+{
+	/** Progress percentage (0-100), -1 if unknown */
+	int32 Percent = -1;
+
+	/** Human-readable description of the current step */
+	FString Message;
+
+	/** Optional partial result available before the tool finishes */
+	TSharedPtr<FJsonObject> PartialData;
+
+	FMCPToolProgress() = default;
+
+	FMCPToolProgress(int32 InPercent, const FString& InMessage, TSharedPtr<FJsonObject> InPartialData = nullptr)
+		: Percent(InPercent)
+		, Message(InMessage)
+		, PartialData(InPartialData)
+	{}
+};
+
+/** Receives progress updates from the tool being executed */
+DECLARE_DELEGATE_OneParam(FMCPToolProgressSink, const FMCPToolProgress&);
+
+/**
+ * Routes progress reports to whoever is running the tool
+ *
+ * The caller installs a sink for the duration of the tool call, and the tool (or code it calls into)
+ * reports through Report(). Reports go to the innermost scope and are dropped when nobody is listening.
+ * Tools run on the game thread, so scopes and reports are game thread only.
+ */
+class FMCPToolProgressScope
+{
+public:
+	explicit FMCPToolProgressScope(FMCPToolProgressSink InSink);
+	~FMCPToolProgressScope();
+
+	FMCPToolProgressScope(const FMCPToolProgressScope&) = delete;
+	FMCPToolProgressScope& operator=(const FMCPToolProgressScope&) = delete;
+
+	/** Report progress to the innermost scope, if any */
+	static void Report(const FMCPToolProgress& Progress);
+
+	/** Check if anyone is listening for progress (to skip building expensive partial results) */
+	static bool IsListening() { return Current != nullptr; }
+
+private:
+	/** Sink for this scope */
+	FMCPToolProgressSink Sink;
+
+	/** Enclosing scope, restored when this one ends */
+	FMCPToolProgressScope* Previous;
+
+	/** Innermost scope */
+	static FMCPToolProgressScope* Current;
+};
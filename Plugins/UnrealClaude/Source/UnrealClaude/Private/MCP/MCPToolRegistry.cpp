@@ -2,6 +2,7 @@
 
 #include "MCPToolRegistry.h"
 #include "MCPTaskQueue.h"
+#include "MCPMetrics.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeConstants.h"
 
@@ -11,6 +12,7 @@
 #include "Tools/MCPTool_SetProperty.h"
 #include "Tools/MCPTool_RunConsoleCommand.h"
 #include "Tools/MCPTool_DeleteActors.h"
+#include "Tools/MCPTool_MergeStaticActors.h"
 #include "Tools/MCPTool_MoveActor.h"
 #include "Tools/MCPTool_GetOutputLog.h"
 #include "Tools/MCPTool_ExecuteScript.h"
@@ -74,6 +76,7 @@ void FMCPToolRegistry::RegisterBuiltinTools()
 	RegisterTool(MakeShared<FMCPTool_SetProperty>());
 	RegisterTool(MakeShared<FMCPTool_RunConsoleCommand>());
 	RegisterTool(MakeShared<FMCPTool_DeleteActors>());
+	RegisterTool(MakeShared<FMCPTool_MergeStaticActors>());
 	RegisterTool(MakeShared<FMCPTool_MoveActor>());
 	RegisterTool(MakeShared<FMCPTool_GetOutputLog>());
 
@@ -153,6 +156,7 @@ void FMCPToolRegistry::RegisterTool(TSharedPtr<IMCPTool> Tool)
 	}
 
 	Tools.Add(Info.Name, Tool);
+	InvalidateToolCache();
 	UE_LOG(LogUnrealClaude, Log, TEXT("  Registered tool: %s"), *Info.Name);
 }
 
@@ -169,9 +173,10 @@ void FMCPToolRegistry::InvalidateToolCache()
 {
 	bCacheValid = false;
 	CachedToolInfo.Empty();
+	++ToolsVersion;
 }
 
-TArray<FMCPToolInfo> FMCPToolRegistry::GetAllTools() const
+const TArray<FMCPToolInfo>& FMCPToolRegistry::GetAllTools() const
 {
 	// Return cached result if valid
 	if (bCacheValid)
@@ -195,52 +200,93 @@ TArray<FMCPToolInfo> FMCPToolRegistry::GetAllTools() const
 
 FMCPToolResult FMCPToolRegistry::ExecuteTool(const FString& ToolName, const TSharedRef<FJsonObject>& Params)
 {
-	TSharedPtr<IMCPTool>* FoundTool = Tools.Find(ToolName);
-	if (!FoundTool || !FoundTool->IsValid())
+	// Execute on game thread to ensure safe access to engine objects
+	if (IsInGameThread())
 	{
-		return FMCPToolResult::Error(FString::Printf(TEXT("Tool '%s' not found"), *ToolName));
+		return ExecuteToolOnGameThread(ToolName, Params);
 	}
 
-	UE_LOG(LogUnrealClaude, Log, TEXT("Executing MCP tool: %s"), *ToolName);
+	// Use shared pointers for all state to avoid use-after-free if timeout occurs
+	TSharedPtr<FMCPToolResult, ESPMode::ThreadSafe> SharedResult = MakeShared<FMCPToolResult, ESPMode::ThreadSafe>();
 
-	// Execute on game thread to ensure safe access to engine objects
-	FMCPToolResult Result;
+	const bool bCompleted = DispatchToGameThreadAndWait([this, SharedResult, ToolName, Params]()
+	{
+		*SharedResult = ExecuteToolOnGameThread(ToolName, Params);
+	});
 
-	if (IsInGameThread())
+	if (!bCompleted)
 	{
-		Result = (*FoundTool)->Execute(Params);
+		const uint32 TimeoutMs = UnrealClaudeConstants::MCPServer::GameThreadTimeoutMs;
+		UE_LOG(LogUnrealClaude, Error, TEXT("Tool '%s' execution timed out after %d ms"), *ToolName, TimeoutMs);
+		return FMCPToolResult::Error(FString::Printf(TEXT("Tool execution timed out after %d seconds"), TimeoutMs / 1000));
 	}
-	else
+
+	// Copy result from shared storage
+	return *SharedResult;
+}
+
+TArray<FMCPToolResult> FMCPToolRegistry::ExecuteBatch(const TArray<FMCPToolCall>& Calls, bool bStopOnError)
+{
+	// Runs every call back to back, so the batch costs a single game thread dispatch
+	auto RunCalls = [this, Calls, bStopOnError]()
 	{
-		// If called from non-game thread, dispatch to game thread and wait with timeout
-		// Use shared pointers for all state to avoid use-after-free if timeout occurs
-		TSharedPtr<FMCPToolResult> SharedResult = MakeShared<FMCPToolResult>();
-		TSharedPtr<FEvent, ESPMode::ThreadSafe> CompletionEvent = MakeShareable(FPlatformProcess::GetSynchEventFromPool(),
-			[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
-		TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> bTaskCompleted = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
+		TArray<FMCPToolResult> Results;
+		Results.Reserve(Calls.Num());
 
-		// Capture shared pointers by value so lambda keeps them alive
-		AsyncTask(ENamedThreads::GameThread, [SharedResult, FoundTool, Params, CompletionEvent, bTaskCompleted]()
+		for (const FMCPToolCall& Call : Calls)
 		{
-			*SharedResult = (*FoundTool)->Execute(Params);
-			*bTaskCompleted = true;
-			CompletionEvent->Trigger();
-		});
+			Results.Add(ExecuteToolOnGameThread(Call.ToolName, Call.Params));
+
+			if (bStopOnError && !Results.Last().bSuccess)
+			{
+				break;
+			}
+		}
+
+		return Results;
+	};
+
+	if (IsInGameThread())
+	{
+		return RunCalls();
+	}
+
+	TSharedPtr<TArray<FMCPToolResult>, ESPMode::ThreadSafe> SharedResults = MakeShared<TArray<FMCPToolResult>, ESPMode::ThreadSafe>();
+
+	const bool bCompleted = DispatchToGameThreadAndWait([SharedResults, RunCalls]()
+	{
+		*SharedResults = RunCalls();
+	});
 
-		// Wait with timeout to prevent indefinite hangs
+	if (!bCompleted)
+	{
 		const uint32 TimeoutMs = UnrealClaudeConstants::MCPServer::GameThreadTimeoutMs;
-		const bool bSignaled = CompletionEvent->Wait(TimeoutMs);
+		UE_LOG(LogUnrealClaude, Error, TEXT("Batch of %d tool calls timed out after %d ms"), Calls.Num(), TimeoutMs);
 
-		if (!bSignaled || !(*bTaskCompleted))
-		{
-			UE_LOG(LogUnrealClaude, Error, TEXT("Tool '%s' execution timed out after %d ms"), *ToolName, TimeoutMs);
-			return FMCPToolResult::Error(FString::Printf(TEXT("Tool execution timed out after %d seconds"), TimeoutMs / 1000));
-		}
+		TArray<FMCPToolResult> Results;
+		Results.Add(FMCPToolResult::Error(FString::Printf(TEXT("Batch execution timed out after %d seconds"), TimeoutMs / 1000)));
+		return Results;
+	}
+
+	return *SharedResults;
+}
 
-		// Copy result from shared storage
-		Result = *SharedResult;
+FMCPToolResult FMCPToolRegistry::ExecuteToolOnGameThread(const FString& ToolName, const TSharedRef<FJsonObject>& Params)
+{
+	check(IsInGameThread());
+
+	TSharedPtr<IMCPTool>* FoundTool = Tools.Find(ToolName);
+	if (!FoundTool || !FoundTool->IsValid())
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Tool '%s' not found"), *ToolName));
 	}
 
+	UE_LOG(LogUnrealClaude, Log, TEXT("Executing MCP tool: %s"), *ToolName);
+
+	const double StartTime = FPlatformTime::Seconds();
+	FMCPToolResult Result = (*FoundTool)->Execute(Params);
+	FMCPMetrics::Get().RecordToolCall(ToolName, Result.bSuccess, FPlatformTime::Seconds() - StartTime);
+
 	UE_LOG(LogUnrealClaude, Log, TEXT("Tool '%s' execution %s: %s"),
 		*ToolName,
 		Result.bSuccess ? TEXT("succeeded") : TEXT("failed"),
@@ -249,6 +295,29 @@ FMCPToolResult FMCPToolRegistry::ExecuteTool(const FString& ToolName, const TSha
 	return Result;
 }
 
+bool FMCPToolRegistry::DispatchToGameThreadAndWait(TUniqueFunction<void()>&& Work)
+{
+	TSharedPtr<FEvent, ESPMode::ThreadSafe> CompletionEvent = MakeShareable(FPlatformProcess::GetSynchEventFromPool(),
+		[](FEvent* Event) { FPlatformProcess::ReturnSynchEventToPool(Event); });
+	TSharedPtr<TAtomic<bool>, ESPMode::ThreadSafe> bTaskCompleted = MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false);
+
+	const double DispatchTime = FPlatformTime::Seconds();
+
+	// Capture shared pointers by value so lambda keeps them alive
+	AsyncTask(ENamedThreads::GameThread, [Work = MoveTemp(Work), CompletionEvent, bTaskCompleted, DispatchTime]()
+	{
+		FMCPMetrics::Get().RecordGameThreadWait(FPlatformTime::Seconds() - DispatchTime);
+		Work();
+		*bTaskCompleted = true;
+		CompletionEvent->Trigger();
+	});
+
+	// Wait with timeout to prevent indefinite hangs
+	const bool bSignaled = CompletionEvent->Wait(UnrealClaudeConstants::MCPServer::GameThreadTimeoutMs);
+
+	return bSignaled && *bTaskCompleted;
+}
+
 bool FMCPToolRegistry::HasTool(const FString& ToolName) const
 {
 	return Tools.Contains(ToolName);
@@ -156,6 +156,18 @@ struct FMCPToolResult
 	}
 };
 
+/**
+ * A single tool call in a batch
+ */
+struct FMCPToolCall
+{
+	/** Name of the tool to execute */
+	FString ToolName;
+
+	/** Parameters to execute the tool with */
+	TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+};
+
 /**
  * Base class for MCP tools
  */
@@ -187,11 +199,21 @@ public:
 	void UnregisterTool(const FString& ToolName);
 
 	/** Get all registered tools */
-	TArray<FMCPToolInfo> GetAllTools() const;
+	const TArray<FMCPToolInfo>& GetAllTools() const;
+
+	/** Get a counter that changes whenever tools are registered or unregistered */
+	uint32 GetToolsVersion() const { return ToolsVersion; }
 
 	/** Execute a tool by name */
 	FMCPToolResult ExecuteTool(const FString& ToolName, const TSharedRef<FJsonObject>& Params);
 
+	/**
+	 * Execute tools in order with a single game thread dispatch.
+	 * Returns one result per executed call. With bStopOnError, execution stops after the first failure
+	 * and the remaining calls get no result.
+	 */
+	TArray<FMCPToolResult> ExecuteBatch(const TArray<FMCPToolCall>& Calls, bool bStopOnError);
+
 	/** Check if a tool exists */
 	bool HasTool(const FString& ToolName) const;
 
@@ -215,6 +237,12 @@ private:
 	/** Register all built-in tools */
 	void RegisterBuiltinTools();
 
+	/** Execute a tool, must be called on the game thread */
+	FMCPToolResult ExecuteToolOnGameThread(const FString& ToolName, const TSharedRef<FJsonObject>& Params);
+
+	/** Run work on the game thread and wait for it. Returns false if it timed out */
+	static bool DispatchToGameThreadAndWait(TUniqueFunction<void()>&& Work);
+
 	/** Invalidate cached tool list */
 	void InvalidateToolCache();
 
@@ -227,6 +255,9 @@ private:
 	/** Whether the cached tool list is valid */
 	mutable bool bCacheValid = false;
 
+	/** Bumped on every registry change so callers can cache what they derive from the tool list */
+	uint32 ToolsVersion = 0;
+
 	/** Async task queue for long-running operations */
 	TSharedPtr<FMCPTaskQueue> TaskQueue;
 };
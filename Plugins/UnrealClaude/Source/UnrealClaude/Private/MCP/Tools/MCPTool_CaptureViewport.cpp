@@ -2,6 +2,7 @@
 
 #include "MCPTool_CaptureViewport.h"
 #include "UnrealClaudeModule.h"
+#include "MCP/MCPBlobStore.h"
 #include "Editor.h"
 #include "LevelEditor.h"
 #include "SLevelViewport.h"
@@ -69,6 +70,8 @@ FMCPToolResult FMCPTool_CaptureViewport::Execute(const TSharedRef<FJsonObject>&
 		return FMCPToolResult::Error(TEXT("Viewport has invalid size."));
 	}
 
+	ReportProgress(10, FString::Printf(TEXT("Reading %s viewport pixels (%dx%d)"), *ViewportType, ViewportSize.X, ViewportSize.Y));
+
 	// Read pixels from viewport
 	TArray<FColor> Pixels;
 	if (!Viewport->ReadPixels(Pixels))
@@ -83,6 +86,8 @@ FMCPToolResult FMCPTool_CaptureViewport::Execute(const TSharedRef<FJsonObject>&
 		return FMCPToolResult::Error(TEXT("Pixel array size mismatch."));
 	}
 
+	ReportProgress(50, TEXT("Encoding JPEG"));
+
 	// Resize to target resolution
 	TArray<FColor> ResizedPixels;
 	ResizePixels(Pixels, ViewportSize.X, ViewportSize.Y, ResizedPixels, TargetWidth, TargetHeight);
@@ -110,12 +115,27 @@ FMCPToolResult FMCPTool_CaptureViewport::Execute(const TSharedRef<FJsonObject>&
 		return FMCPToolResult::Error(TEXT("Failed to compress image to JPEG."));
 	}
 
-	// Encode to base64
-	const FString Base64Image = FBase64::Encode(CompressedData.GetData(), CompressedData.Num());
+	const int64 JPEGSize = CompressedData.Num();
 
 	// Build result JSON
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
-	ResultData->SetStringField(TEXT("image_base64"), Base64Image);
+
+	// Publish the raw bytes rather than inflating them by a third as base64 JSON text
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Blob;
+	if (!ExtractOptionalBool(Params, TEXT("inline_base64")))
+	{
+		Blob = FMCPBlobStore::Get().Publish(TArray<uint8>(CompressedData.GetData(), CompressedData.Num()), TEXT("image/jpeg"));
+	}
+
+	if (Blob.IsValid())
+	{
+		ResultData->SetObjectField(TEXT("image_blob"), FMCPBlobStore::MakeHandleJson(*Blob));
+	}
+	else
+	{
+		ResultData->SetStringField(TEXT("image_base64"), FBase64::Encode(CompressedData.GetData(), CompressedData.Num()));
+	}
+
 	ResultData->SetNumberField(TEXT("width"), TargetWidth);
 	ResultData->SetNumberField(TEXT("height"), TargetHeight);
 	ResultData->SetStringField(TEXT("format"), TEXT("jpeg"));
@@ -124,8 +144,8 @@ FMCPToolResult FMCPTool_CaptureViewport::Execute(const TSharedRef<FJsonObject>&
 	ResultData->SetNumberField(TEXT("original_width"), ViewportSize.X);
 	ResultData->SetNumberField(TEXT("original_height"), ViewportSize.Y);
 
-	UE_LOG(LogUnrealClaude, Log, TEXT("Captured %s viewport: %dx%d -> %dx%d JPEG (%d bytes base64)"),
-		*ViewportType, ViewportSize.X, ViewportSize.Y, TargetWidth, TargetHeight, Base64Image.Len());
+	UE_LOG(LogUnrealClaude, Log, TEXT("Captured %s viewport: %dx%d -> %dx%d JPEG (%lld bytes, %s)"),
+		*ViewportType, ViewportSize.X, ViewportSize.Y, TargetWidth, TargetHeight, JPEGSize, Blob.IsValid() ? TEXT("blob") : TEXT("base64"));
 
 	return FMCPToolResult::Success(
 		FString::Printf(TEXT("Captured %s viewport: %dx%d JPEG"), *ViewportType, TargetWidth, TargetHeight),
@@ -7,7 +7,7 @@
 
 /**
  * MCP Tool: Capture a screenshot of the active viewport
- * Returns base64-encoded JPEG (1024x576, quality 70)
+ * Publishes a JPEG (1024x576, quality 70) to the blob store, or returns it base64-encoded on request
  * Captures PIE viewport if running, otherwise active editor viewport
  */
 class FMCPTool_CaptureViewport : public FMCPToolBase
@@ -21,15 +21,18 @@ public:
 			"Capture a screenshot of the active viewport.\n\n"
 			"Captures the current view from either Play-In-Editor (if running) or the active editor viewport. "
 			"Useful for visual verification of scene changes.\n\n"
-			"Output: 1024x576 JPEG image encoded as base64 string.\n\n"
+			"Output: 1024x576 JPEG image, downloadable as raw bytes from GET /mcp/blob/{id} for a few minutes.\n\n"
 			"Use cases:\n"
 			"- Verify actor placement after spawning/moving\n"
 			"- Check lighting changes\n"
 			"- Document scene state\n"
 			"- Debug visual issues\n\n"
-			"Returns: Base64-encoded JPEG image data."
+			"Returns: 'image_blob' handle (blob_id, url, content_type, size, expires_in), "
+			"or 'image_base64' when inline_base64 is true."
 		);
-		Info.Parameters = {};
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("inline_base64"), TEXT("boolean"), TEXT("Return the JPEG base64-encoded in the result instead of as a blob (default: false)"), false, TEXT("false"))
+		};
 		Info.Annotations = FMCPToolAnnotations::ReadOnly();
 		return Info;
 	}
@@ -111,6 +111,10 @@ FMCPToolResult FMCPTool_ExecuteScript::ExecuteSync(const TSharedRef<FJsonObject>
 
 	UE_LOG(LogUnrealClaude, Log, TEXT("Executing %s script: %s"), *ScriptTypeStr, *Description);
 
+	ReportProgress(10, ScriptTypeStr.ToLower() == TEXT("cpp")
+		? FString::Printf(TEXT("Compiling script: %s"), *Description)
+		: FString::Printf(TEXT("Running %s script: %s"), *ScriptTypeStr, *Description));
+
 	// Execute script via manager
 	FScriptExecutionResult Result = FScriptExecutionManager::Get().ExecuteScript(
 		ScriptType,
@@ -118,6 +122,8 @@ FMCPToolResult FMCPTool_ExecuteScript::ExecuteSync(const TSharedRef<FJsonObject>
 		Description
 	);
 
+	ReportProgress(90, Result.bSuccess ? TEXT("Script finished") : TEXT("Script failed"));
+
 	// Build result data
 	TSharedPtr<FJsonObject> ResultData = MakeShared<FJsonObject>();
 	ResultData->SetStringField(TEXT("script_type"), ScriptTypeStr);
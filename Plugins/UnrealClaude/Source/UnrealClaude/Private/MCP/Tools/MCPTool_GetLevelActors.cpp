@@ -59,39 +59,11 @@ FMCPToolResult FMCPTool_GetLevelActors::Execute(const TSharedRef<FJsonObject>& P
 	for (TActorIterator<AActor> It(World); It; ++It)
 	{
 		AActor* Actor = *It;
-		if (!Actor)
+		if (!ActorMatchesFilter(Actor, ClassFilter, NameFilter, bIncludeHidden))
 		{
 			continue;
 		}
 
-		// Skip hidden actors if not requested
-		if (!bIncludeHidden && Actor->IsHidden())
-		{
-			continue;
-		}
-
-		// Apply class filter
-		if (!ClassFilter.IsEmpty())
-		{
-			FString ActorClassName = Actor->GetClass()->GetName();
-			if (!ActorClassName.Contains(ClassFilter, ESearchCase::IgnoreCase))
-			{
-				continue;
-			}
-		}
-
-		// Apply name filter
-		if (!NameFilter.IsEmpty())
-		{
-			FString ActorName = Actor->GetName();
-			FString ActorLabel = Actor->GetActorLabel();
-			if (!ActorName.Contains(NameFilter, ESearchCase::IgnoreCase) &&
-				!ActorLabel.Contains(NameFilter, ESearchCase::IgnoreCase))
-			{
-				continue;
-			}
-		}
-
 		TotalMatching++;
 
 		// Apply offset - skip until we reach the offset
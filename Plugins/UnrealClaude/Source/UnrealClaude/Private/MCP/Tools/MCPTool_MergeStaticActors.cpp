@@ -0,0 +1,395 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#include "MCPTool_MergeStaticActors.h"
+#include "MCP/MCPParamValidator.h"
+#include "UnrealClaudeModule.h"
+#include "Editor.h"
+#include "Engine/World.h"
+#include "Engine/Selection.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/MeshMerging.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+#include "EngineUtils.h"
+#include "ScopedTransaction.h"
+#include "IMeshMergeUtilities.h"
+#include "MeshMergeModule.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+	/** Draw calls a static mesh costs on its own, one per LOD0 section */
+	int32 GetMeshDrawCalls(const UStaticMesh* Mesh)
+	{
+		return Mesh && Mesh->GetNumLODs() > 0 ? FMath::Max(Mesh->GetNumSections(0), 1) : 0;
+	}
+
+	/** Key for components that can share one HISM: same mesh, same materials */
+	FString GetInstanceGroupKey(const UStaticMeshComponent* Component)
+	{
+		FString Key = Component->GetStaticMesh()->GetPathName();
+		for (int32 i = 0; i < Component->GetNumMaterials(); ++i)
+		{
+			const UMaterialInterface* Material = Component->GetMaterial(i);
+			Key += TEXT("|");
+			Key += Material ? Material->GetPathName() : TEXT("None");
+		}
+		return Key;
+	}
+}
+
+FMCPToolResult FMCPTool_MergeStaticActors::Execute(const TSharedRef<FJsonObject>& Params)
+{
+	// Validate editor context using base class
+	UWorld* World = nullptr;
+	if (auto Error = ValidateEditorContext(World))
+	{
+		return Error.GetValue();
+	}
+
+	// Parse parameters
+	FString ClassFilter = ExtractOptionalString(Params, TEXT("class_filter"));
+	FString NameFilter = ExtractOptionalString(Params, TEXT("name_filter"));
+	bool bIncludeHidden = ExtractOptionalBool(Params, TEXT("include_hidden"), false);
+	bool bUseSelection = ExtractOptionalBool(Params, TEXT("use_selection"), false);
+	FString Mode = ExtractOptionalString(Params, TEXT("mode"), TEXT("instanced"));
+	FString MergedLabel = ExtractOptionalString(Params, TEXT("merged_actor_label"), TEXT("MergedStaticActors"));
+	FString AssetPath = ExtractOptionalString(Params, TEXT("asset_path"), TEXT("/Game/Merged/"));
+
+	FString ValidationError;
+	if (!ClassFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(ClassFilter, TEXT("class_filter"), 256, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	if (!NameFilter.IsEmpty() && !FMCPParamValidator::ValidateStringLength(NameFilter, TEXT("name_filter"), 256, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+	if (!FMCPParamValidator::ValidateActorName(MergedLabel, ValidationError))
+	{
+		return FMCPToolResult::Error(ValidationError);
+	}
+
+	const bool bMeshMode = Mode.Equals(TEXT("mesh"), ESearchCase::IgnoreCase);
+	if (!bMeshMode && !Mode.Equals(TEXT("instanced"), ESearchCase::IgnoreCase))
+	{
+		return FMCPToolResult::Error(FString::Printf(TEXT("Invalid mode '%s'. Use 'instanced' or 'mesh'."), *Mode));
+	}
+
+	if (bMeshMode)
+	{
+		TOptional<FMCPToolResult> PathError;
+		if (!ValidateBlueprintPathParam(AssetPath, PathError))
+		{
+			return PathError.GetValue();
+		}
+	}
+
+	// Collect candidate actors
+	TArray<AActor*> Candidates;
+	TArray<FString> NotFoundNames;
+
+	const TArray<TSharedPtr<FJsonValue>>* ActorNamesArray;
+	const bool bHasNames = Params->TryGetArrayField(TEXT("actor_names"), ActorNamesArray) && ActorNamesArray->Num() > 0;
+	if (bHasNames)
+	{
+		for (const TSharedPtr<FJsonValue>& NameValue : *ActorNamesArray)
+		{
+			FString ActorName;
+			if (NameValue->TryGetString(ActorName))
+			{
+				if (!FMCPParamValidator::ValidateActorName(ActorName, ValidationError))
+				{
+					return FMCPToolResult::Error(ValidationError);
+				}
+
+				if (AActor* Actor = FindActorByNameOrLabel(World, ActorName))
+				{
+					Candidates.AddUnique(Actor);
+				}
+				else
+				{
+					NotFoundNames.Add(ActorName);
+				}
+			}
+		}
+	}
+
+	if (!ClassFilter.IsEmpty() || !NameFilter.IsEmpty())
+	{
+		for (TActorIterator<AActor> It(World); It; ++It)
+		{
+			if (ActorMatchesFilter(*It, ClassFilter, NameFilter, bIncludeHidden))
+			{
+				Candidates.AddUnique(*It);
+			}
+		}
+	}
+
+	if (bUseSelection)
+	{
+		for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+		{
+			if (AActor* Actor = Cast<AActor>(*It))
+			{
+				Candidates.AddUnique(Actor);
+			}
+		}
+	}
+
+	if (!bHasNames && ClassFilter.IsEmpty() && NameFilter.IsEmpty() && !bUseSelection)
+	{
+		return FMCPToolResult::Error(TEXT("No actors specified. Provide actor_names, class_filter, name_filter, or use_selection."));
+	}
+
+	// Keep only actors whose whole content can go into the merged actor
+	TArray<AActor*> ActorsToMerge;
+	TArray<UStaticMeshComponent*> Components;
+	TArray<TSharedPtr<FJsonValue>> SkippedArray;
+
+	for (AActor* Actor : Candidates)
+	{
+		TArray<UStaticMeshComponent*> ActorComponents;
+		FString Reason;
+		if (GetMergeableComponents(Actor, ActorComponents, Reason))
+		{
+			ActorsToMerge.Add(Actor);
+			Components.Append(ActorComponents);
+		}
+		else
+		{
+			TSharedPtr<FJsonObject> SkippedJson = MakeShared<FJsonObject>();
+			SkippedJson->SetStringField(TEXT("name"), Actor->GetName());
+			SkippedJson->SetStringField(TEXT("reason"), Reason);
+			SkippedArray.Add(MakeShared<FJsonValueObject>(SkippedJson));
+		}
+	}
+
+	if (ActorsToMerge.Num() < 2)
+	{
+		return FMCPToolResult::Error(FString::Printf(
+			TEXT("Need at least 2 mergeable actors, found %d (%d candidates, %d skipped, %d not found)"),
+			ActorsToMerge.Num(), Candidates.Num(), SkippedArray.Num(), NotFoundNames.Num()));
+	}
+
+	int32 DrawCallsBefore = 0;
+	for (const UStaticMeshComponent* Component : Components)
+	{
+		DrawCallsBefore += GetMeshDrawCalls(Component->GetStaticMesh());
+	}
+
+	// Spawn the merged actor and remove the originals as one undo step
+	FScopedTransaction Transaction(NSLOCTEXT("UnrealClaude", "MergeStaticActors", "Merge Static Actors"));
+
+	int32 DrawCallsAfter = 0;
+	FString MergeError;
+	AActor* MergedActor = bMeshMode
+		? MergeToMesh(World, Components, AssetPath / MergedLabel, DrawCallsAfter, MergeError)
+		: MergeToInstanced(World, Components, DrawCallsAfter, MergeError);
+
+	if (!MergedActor)
+	{
+		Transaction.Cancel();
+		return FMCPToolResult::Error(MergeError);
+	}
+
+	MergedActor->SetActorLabel(MergedLabel);
+
+	TArray<FString> MergedNames;
+	for (AActor* Actor : ActorsToMerge)
+	{
+		MergedNames.Add(Actor->GetName());
+		World->EditorDestroyActor(Actor, true);
+	}
+
+	// Mark dirty using base class helper
+	MarkWorldDirty(World);
+
+	UE_LOG(LogUnrealClaude, Log, TEXT("Merged %d actors into %s (%s), draw calls %d -> %d"),
+		ActorsToMerge.Num(), *MergedActor->GetName(), *Mode, DrawCallsBefore, DrawCallsAfter);
+
+	// Build result
+	TSharedPtr<FJsonObject> ResultData = BuildActorInfoJson(MergedActor);
+	ResultData->SetStringField(TEXT("mode"), bMeshMode ? TEXT("mesh") : TEXT("instanced"));
+	ResultData->SetArrayField(TEXT("merged"), StringArrayToJsonArray(MergedNames));
+	ResultData->SetNumberField(TEXT("actorsBefore"), ActorsToMerge.Num());
+	ResultData->SetNumberField(TEXT("actorsAfter"), 1);
+	ResultData->SetNumberField(TEXT("drawCallsBefore"), DrawCallsBefore);
+	ResultData->SetNumberField(TEXT("drawCallsAfter"), DrawCallsAfter);
+
+	if (SkippedArray.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("skipped"), SkippedArray);
+	}
+	if (NotFoundNames.Num() > 0)
+	{
+		ResultData->SetArrayField(TEXT("notFound"), StringArrayToJsonArray(NotFoundNames));
+	}
+
+	return FMCPToolResult::Success(
+		FString::Printf(TEXT("Merged %d actors into '%s': actors %d -> 1, draw calls %d -> %d"),
+			ActorsToMerge.Num(), *MergedLabel, ActorsToMerge.Num(), DrawCallsBefore, DrawCallsAfter),
+		ResultData
+	);
+}
+
+bool FMCPTool_MergeStaticActors::GetMergeableComponents(AActor* Actor, TArray<UStaticMeshComponent*>& OutComponents, FString& OutReason) const
+{
+	if (!Actor || !IsValid(Actor))
+	{
+		OutReason = TEXT("Invalid actor");
+		return false;
+	}
+
+	if (Actor->GetRootComponent() && Actor->GetRootComponent()->Mobility == EComponentMobility::Movable)
+	{
+		OutReason = TEXT("Actor is movable");
+		return false;
+	}
+
+	TArray<UPrimitiveComponent*> PrimitiveComponents;
+	Actor->GetComponents(PrimitiveComponents);
+
+	for (UPrimitiveComponent* Primitive : PrimitiveComponents)
+	{
+		// Editor-only helpers like billboards don't render in game
+		if (Primitive->IsEditorOnly())
+		{
+			continue;
+		}
+
+		UStaticMeshComponent* MeshComponent = Cast<UStaticMeshComponent>(Primitive);
+		if (!MeshComponent || Primitive->IsA<UInstancedStaticMeshComponent>())
+		{
+			OutReason = FString::Printf(TEXT("Has a %s component"), *Primitive->GetClass()->GetName());
+			return false;
+		}
+
+		if (MeshComponent->GetStaticMesh())
+		{
+			OutComponents.Add(MeshComponent);
+		}
+	}
+
+	if (OutComponents.Num() == 0)
+	{
+		OutReason = TEXT("No static meshes");
+		return false;
+	}
+
+	return true;
+}
+
+AActor* FMCPTool_MergeStaticActors::MergeToInstanced(UWorld* World, const TArray<UStaticMeshComponent*>& Components, int32& OutDrawCalls, FString& OutError) const
+{
+	// Group components that can be drawn as instances of each other
+	TMap<FString, TArray<UStaticMeshComponent*>> Groups;
+	FBox Bounds(ForceInit);
+	for (UStaticMeshComponent* Component : Components)
+	{
+		Groups.FindOrAdd(GetInstanceGroupKey(Component)).Add(Component);
+		Bounds += Component->Bounds.GetBox();
+	}
+
+	AActor* MergedActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity);
+	if (!MergedActor)
+	{
+		OutError = TEXT("Failed to spawn merged actor");
+		return nullptr;
+	}
+
+	MergedActor->Modify();
+
+	USceneComponent* Root = NewObject<USceneComponent>(MergedActor, TEXT("Root"), RF_Transactional);
+	Root->SetMobility(EComponentMobility::Static);
+	MergedActor->SetRootComponent(Root);
+	MergedActor->AddInstanceComponent(Root);
+	Root->RegisterComponent();
+	MergedActor->SetActorLocation(Bounds.GetCenter());
+
+	OutDrawCalls = 0;
+	for (const TPair<FString, TArray<UStaticMeshComponent*>>& Group : Groups)
+	{
+		const UStaticMeshComponent* Template = Group.Value[0];
+
+		UHierarchicalInstancedStaticMeshComponent* HISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(
+			MergedActor, MakeUniqueObjectName(MergedActor, UHierarchicalInstancedStaticMeshComponent::StaticClass(),
+				*FString::Printf(TEXT("HISM_%s"), *Template->GetStaticMesh()->GetName())), RF_Transactional);
+
+		HISM->SetMobility(EComponentMobility::Static);
+		HISM->SetStaticMesh(Template->GetStaticMesh());
+		for (int32 i = 0; i < Template->GetNumMaterials(); ++i)
+		{
+			HISM->SetMaterial(i, Template->GetMaterial(i));
+		}
+		HISM->SetCollisionProfileName(Template->GetCollisionProfileName());
+		HISM->SetCastShadow(Template->CastShadow);
+		HISM->SetupAttachment(Root);
+		MergedActor->AddInstanceComponent(HISM);
+		HISM->RegisterComponent();
+
+		TArray<FTransform> InstanceTransforms;
+		InstanceTransforms.Reserve(Group.Value.Num());
+		for (const UStaticMeshComponent* Component : Group.Value)
+		{
+			InstanceTransforms.Add(Component->GetComponentTransform());
+		}
+		HISM->AddInstances(InstanceTransforms, false, true);
+
+		OutDrawCalls += GetMeshDrawCalls(Template->GetStaticMesh());
+	}
+
+	return MergedActor;
+}
+
+AActor* FMCPTool_MergeStaticActors::MergeToMesh(UWorld* World, const TArray<UStaticMeshComponent*>& Components, const FString& AssetPath,
+	int32& OutDrawCalls, FString& OutError) const
+{
+	const IMeshMergeUtilities& MergeUtilities = FModuleManager::LoadModuleChecked<IMeshMergeModule>("MeshMergeUtilities").GetUtilities();
+
+	TArray<UPrimitiveComponent*> PrimitiveComponents(Components);
+
+	// Keep the source materials, sections with the same material are combined
+	FMeshMergingSettings Settings;
+	Settings.bMergeMaterials = false;
+	Settings.bMergePhysicsData = true;
+	Settings.LODSelectionType = EMeshLODSelectionType::AllLODs;
+
+	TArray<UObject*> CreatedAssets;
+	FVector MergedLocation = FVector::ZeroVector;
+	MergeUtilities.MergeComponentsToStaticMesh(PrimitiveComponents, World, Settings, nullptr, nullptr, AssetPath,
+		CreatedAssets, MergedLocation, TNumericLimits<float>::Max(), true);
+
+	UStaticMesh* MergedMesh = nullptr;
+	for (UObject* Asset : CreatedAssets)
+	{
+		FAssetRegistryModule::AssetCreated(Asset);
+		Asset->MarkPackageDirty();
+
+		if (UStaticMesh* Mesh = Cast<UStaticMesh>(Asset))
+		{
+			MergedMesh = Mesh;
+		}
+	}
+
+	if (!MergedMesh)
+	{
+		OutError = FString::Printf(TEXT("Failed to merge components into a static mesh at %s"), *AssetPath);
+		return nullptr;
+	}
+
+	AStaticMeshActor* MergedActor = World->SpawnActor<AStaticMeshActor>(MergedLocation, FRotator::ZeroRotator);
+	if (!MergedActor)
+	{
+		OutError = TEXT("Failed to spawn merged actor");
+		return nullptr;
+	}
+
+	MergedActor->GetStaticMeshComponent()->SetStaticMesh(MergedMesh);
+
+	OutDrawCalls = GetMeshDrawCalls(MergedMesh);
+	return MergedActor;
+}
@@ -0,0 +1,67 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MCP/MCPToolBase.h"
+
+class UStaticMeshComponent;
+
+/**
+ * MCP Tool: Merge static mesh actors into a single actor to cut draw calls and actor count
+ */
+class FMCPTool_MergeStaticActors : public FMCPToolBase
+{
+public:
+	virtual FMCPToolInfo GetInfo() const override
+	{
+		FMCPToolInfo Info;
+		Info.Name = TEXT("merge_static_actors");
+		Info.Description = TEXT(
+			"Merge static mesh actors into a single actor to reduce draw calls and actor count.\n\n"
+			"Selection (combine as needed, at least one is required):\n"
+			"- actor_names: Merge specific actors by name or label\n"
+			"- class_filter / name_filter: Merge all actors matching the same filters as get_level_actors\n"
+			"- use_selection: Merge the actors selected in the editor\n\n"
+			"Modes:\n"
+			"- instanced (default): One actor with a HISM component per unique mesh and material set\n"
+			"- mesh: Bake everything into a new static mesh asset and place it in a single actor\n\n"
+			"Movable actors and actors with non static mesh components are skipped. "
+			"Runs as one editor transaction, so Ctrl+Z restores the original actors "
+			"(a baked mesh asset stays in the content browser).\n\n"
+			"Best practice: Use get_level_actors with the same filters first to check what will be merged.\n\n"
+			"Returns: Merged actor name, merged/skipped actors, actor count and draw call estimates before and after."
+		);
+		Info.Parameters = {
+			FMCPToolParameter(TEXT("actor_names"), TEXT("array"), TEXT("Array of actor names or labels to merge"), false),
+			FMCPToolParameter(TEXT("class_filter"), TEXT("string"), TEXT("Merge actors whose class name contains this (e.g., 'StaticMeshActor')"), false),
+			FMCPToolParameter(TEXT("name_filter"), TEXT("string"), TEXT("Merge actors whose name or label contains this"), false),
+			FMCPToolParameter(TEXT("include_hidden"), TEXT("boolean"), TEXT("Include hidden actors when filtering"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("use_selection"), TEXT("boolean"), TEXT("Merge the actors currently selected in the editor"), false, TEXT("false")),
+			FMCPToolParameter(TEXT("mode"), TEXT("string"), TEXT("Merge mode: 'instanced' (HISM actor) or 'mesh' (baked static mesh)"), false, TEXT("instanced")),
+			FMCPToolParameter(TEXT("merged_actor_label"), TEXT("string"), TEXT("Label for the merged actor"), false, TEXT("MergedStaticActors")),
+			FMCPToolParameter(TEXT("asset_path"), TEXT("string"), TEXT("Package path for the baked mesh in 'mesh' mode"), false, TEXT("/Game/Merged/"))
+		};
+		Info.Annotations = FMCPToolAnnotations::Destructive();
+		return Info;
+	}
+
+	virtual FMCPToolResult Execute(const TSharedRef<FJsonObject>& Params) override;
+
+private:
+	/**
+	 * Gather the static mesh components of an actor that can be merged
+	 * @param Actor - The actor to check
+	 * @param OutComponents - Components to merge
+	 * @param OutReason - Why the actor can't be merged, if it can't
+	 * @return true if the whole actor can be merged
+	 */
+	bool GetMergeableComponents(AActor* Actor, TArray<UStaticMeshComponent*>& OutComponents, FString& OutReason) const;
+
+	/** Spawn one actor with a HISM per unique mesh and material set, returns nullptr on failure */
+	AActor* MergeToInstanced(UWorld* World, const TArray<UStaticMeshComponent*>& Components, int32& OutDrawCalls, FString& OutError) const;
+
+	/** Bake the components into a new static mesh asset and spawn an actor for it, returns nullptr on failure */
+	AActor* MergeToMesh(UWorld* World, const TArray<UStaticMeshComponent*>& Components, const FString& AssetPath,
+		int32& OutDrawCalls, FString& OutError) const;
+};
@@ -2,12 +2,22 @@
 
 #include "UnrealClaudeMCPServer.h"
 #include "MCPToolRegistry.h"
+#include "MCPTaskQueue.h"
+#include "MCPEventStream.h"
+#include "MCPToolProgress.h"
+#include "MCPMetrics.h"
+#include "MCPResponseCompression.h"
+#include "MCPBlobStore.h"
+#include "MCPJsonRpc.h"
 #include "UnrealClaudeModule.h"
 #include "UnrealClaudeConstants.h"
+#include "JsonUtils.h"
 #include "HttpServerModule.h"
 #include "IHttpRouter.h"
 #include "HttpServerRequest.h"
 #include "HttpServerResponse.h"
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -53,6 +63,9 @@ bool FUnrealClaudeMCPServer::Start(uint32 Port)
 
 	bIsRunning = true;
 
+	StreamTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FUnrealClaudeMCPServer::TickEventStreams));
+
 	// Start the async task queue
 	if (ToolRegistry.IsValid())
 	{
@@ -62,7 +75,12 @@ bool FUnrealClaudeMCPServer::Start(uint32 Port)
 	UE_LOG(LogUnrealClaude, Log, TEXT("MCP Server started on http://localhost:%d"), ServerPort);
 	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/tools      - List available tools"));
 	UE_LOG(LogUnrealClaude, Log, TEXT("  POST /mcp/tool/{name} - Execute a tool"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  POST /mcp/batch      - Execute several tools in order"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/stream/{id} - Events of a tool called with Accept: text/event-stream"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/blob/{id}  - Binary tool results such as viewport captures"));
 	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/status     - Server status"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  GET  /mcp/metrics    - Prometheus metrics"));
+	UE_LOG(LogUnrealClaude, Log, TEXT("  POST /mcp            - MCP JSON-RPC (streamable HTTP)"));
 
 	return true;
 }
@@ -91,12 +109,49 @@ void FUnrealClaudeMCPServer::Stop()
 		{
 			HttpRouter->UnbindRoute(ExecuteToolHandle);
 		}
+		if (ExecuteBatchHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(ExecuteBatchHandle);
+		}
+		if (StreamEventsHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(StreamEventsHandle);
+		}
+		if (BlobHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(BlobHandle);
+		}
 		if (StatusHandle.IsValid())
 		{
 			HttpRouter->UnbindRoute(StatusHandle);
 		}
+		if (MetricsHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(MetricsHandle);
+		}
+		if (JsonRpcHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(JsonRpcHandle);
+		}
+		if (JsonRpcStreamHandle.IsValid())
+		{
+			HttpRouter->UnbindRoute(JsonRpcStreamHandle);
+		}
 	}
 
+	FTSTicker::GetCoreTicker().RemoveTicker(StreamTickerHandle);
+	StreamTickerHandle.Reset();
+
+	// End open streams with a result event, so their waiting requests are answered rather than left hanging
+	for (const TPair<FGuid, TSharedPtr<FMCPEventStream>>& Stream : EventStreams)
+	{
+		if (!Stream.Value->IsClosed())
+		{
+			Stream.Value->Close(FMCPToolResult::Error(TEXT("MCP server stopped")));
+		}
+	}
+	EventStreams.Empty();
+
 	bIsRunning = false;
 	UE_LOG(LogUnrealClaude, Log, TEXT("MCP Server stopped"));
 }
@@ -112,35 +167,142 @@ void FUnrealClaudeMCPServer::SetupRoutes()
 	ListToolsHandle = HttpRouter->BindRoute(
 		FHttpPath(TEXT("/mcp/tools")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleListTools)
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleListTools)
 	);
 
 	// POST /mcp/tool/* - Execute a tool (wildcard path)
 	ExecuteToolHandle = HttpRouter->BindRoute(
 		FHttpPath(TEXT("/mcp/tool")),
 		EHttpServerRequestVerbs::VERB_POST,
-		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleExecuteTool)
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleExecuteTool)
+	);
+
+	// POST /mcp/batch - Execute several tools in one game thread dispatch
+	ExecuteBatchHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp/batch")),
+		EHttpServerRequestVerbs::VERB_POST,
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleExecuteBatch)
+	);
+
+	// GET /mcp/stream/* - Events of a streamed tool call (wildcard path)
+	StreamEventsHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp/stream")),
+		EHttpServerRequestVerbs::VERB_GET,
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleStreamEvents)
+	);
+
+	// GET /mcp/blob/* - Binary tool results (wildcard path)
+	BlobHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp/blob")),
+		EHttpServerRequestVerbs::VERB_GET,
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleGetBlob)
 	);
 
 	// GET /mcp/status - Server status
 	StatusHandle = HttpRouter->BindRoute(
 		FHttpPath(TEXT("/mcp/status")),
 		EHttpServerRequestVerbs::VERB_GET,
-		FHttpRequestHandler::CreateRaw(this, &FUnrealClaudeMCPServer::HandleStatus)
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleStatus)
+	);
+
+	// GET /mcp/metrics - Prometheus metrics
+	MetricsHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp/metrics")),
+		EHttpServerRequestVerbs::VERB_GET,
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleMetrics)
+	);
+
+	// POST /mcp - MCP JSON-RPC, lets clients connect without the bridge
+	JsonRpcHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp")),
+		EHttpServerRequestVerbs::VERB_POST,
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleJsonRpc)
 	);
+
+	// GET /mcp - Streamable HTTP clients probe for a server stream here
+	JsonRpcStreamHandle = HttpRouter->BindRoute(
+		FHttpPath(TEXT("/mcp")),
+		EHttpServerRequestVerbs::VERB_GET,
+		CreateTrackedHandler(&FUnrealClaudeMCPServer::HandleJsonRpcStream)
+	);
+}
+
+FHttpRequestHandler FUnrealClaudeMCPServer::CreateTrackedHandler(FRouteHandler Handler)
+{
+	return FHttpRequestHandler::CreateLambda([this, Handler](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+	{
+		FMCPMetrics::Get().BeginRequest();
+
+		const EMCPContentEncoding Encoding = FMCPResponseCompression::Negotiate(Request.Headers.Find(TEXT("Accept-Encoding")));
+
+		// Responses may be sent long after the handler returns, count the request until then
+		return (this->*Handler)(Request, [OnComplete, Encoding](TUniquePtr<FHttpServerResponse>&& Response)
+		{
+			if (Response.IsValid())
+			{
+				FMCPResponseCompression::CompressResponse(*Response, Encoding);
+			}
+
+			FMCPMetrics::Get().EndRequest(Response.IsValid() ? static_cast<int32>(Response->Code) : 500);
+			OnComplete(MoveTemp(Response));
+		});
+	});
 }
 
 bool FUnrealClaudeMCPServer::HandleListTools(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
+	UpdateToolsListing();
+
+	// Clients that already have this listing get a bodiless 304
+	if (MatchesETag(Request, ToolsListingETag))
+	{
+		TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+		Response->Code = EHttpServerResponseCodes::NotModified;
+		Response->Headers.Add(TEXT("ETag"), { ToolsListingETag });
+		AddCorsHeaders(*Response);
+
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	TArray<uint8> Body = ToolsListingBody;
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Body), TEXT("application/json"));
+	Response->Code = EHttpServerResponseCodes::Ok;
+	Response->Headers.Add(TEXT("ETag"), { ToolsListingETag });
+	Response->Headers.Add(TEXT("Cache-Control"), { TEXT("no-cache") });
+	AddCorsHeaders(*Response);
+
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+void FUnrealClaudeMCPServer::UpdateToolsListing()
+{
+	const uint32 ToolsVersion = ToolRegistry.IsValid() ? ToolRegistry->GetToolsVersion() : 0;
+
+	if (bToolsListingValid && ToolsListingVersion == ToolsVersion)
+	{
+		return;
+	}
+
 	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
 
 	TArray<TSharedPtr<FJsonValue>> ToolsArray;
+	JsonRpcTools.Reset();
+	StatusTools.Reset();
 
 	if (ToolRegistry.IsValid())
 	{
-		TArray<FMCPToolInfo> Tools = ToolRegistry->GetAllTools();
+		const TArray<FMCPToolInfo>& Tools = ToolRegistry->GetAllTools();
 		for (const FMCPToolInfo& Tool : Tools)
 		{
+			JsonRpcTools.Add(MakeShared<FJsonValueObject>(FMCPJsonRpc::ToolInfoToJson(Tool)));
+
+			TSharedPtr<FJsonObject> StatusToolJson = MakeShared<FJsonObject>();
+			StatusToolJson->SetStringField(TEXT("name"), Tool.Name);
+			StatusToolJson->SetStringField(TEXT("description"), Tool.Description);
+			StatusTools.Add(MakeShared<FJsonValueObject>(StatusToolJson));
+
 			TSharedPtr<FJsonObject> ToolJson = MakeShared<FJsonObject>();
 			ToolJson->SetStringField(TEXT("name"), Tool.Name);
 			ToolJson->SetStringField(TEXT("description"), Tool.Description);
@@ -180,8 +342,16 @@ bool FUnrealClaudeMCPServer::HandleListTools(const FHttpServerRequest& Request,
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
 	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
 
-	OnComplete(CreateJsonResponse(JsonString));
-	return true;
+	// Keep the UTF-8 body around so requests don't convert or serialize anything
+	FTCHARToUTF8 Utf8Listing(*JsonString);
+	ToolsListingBody.Reset(Utf8Listing.Length());
+	ToolsListingBody.Append(reinterpret_cast<const uint8*>(Utf8Listing.Get()), Utf8Listing.Length());
+
+	// Content hash, so the ETag stays valid across editor restarts with the same tools
+	ToolsListingETag = FString::Printf(TEXT("\"%016llx\""), CityHash64(reinterpret_cast<const char*>(ToolsListingBody.GetData()), ToolsListingBody.Num()));
+
+	ToolsListingVersion = ToolsVersion;
+	bToolsListingValid = true;
 }
 
 bool FUnrealClaudeMCPServer::HandleExecuteTool(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
@@ -212,81 +382,248 @@ bool FUnrealClaudeMCPServer::HandleExecuteTool(const FHttpServerRequest& Request
 
 	// Parse JSON body for parameters
 	TSharedPtr<FJsonObject> ParamsJson;
-	if (Request.Body.Num() > UnrealClaudeConstants::MCPServer::MaxRequestBodySize)
+	FString ParseError;
+	if (!ParseJsonBody(Request, ParamsJson, ParseError))
 	{
-		UE_LOG(LogUnrealClaude, Warning, TEXT("Request body too large: %d bytes (max %d)"), Request.Body.Num(), UnrealClaudeConstants::MCPServer::MaxRequestBodySize);
-		OnComplete(CreateErrorResponse(TEXT("Request body too large"), EHttpServerResponseCodes::BadRequest));
+		OnComplete(CreateErrorResponse(ParseError, EHttpServerResponseCodes::BadRequest));
 		return true;
 	}
-	if (Request.Body.Num() > 0)
+
+	// Execute tool
+	if (!ToolRegistry.IsValid())
 	{
-		// Ensure null-termination for safe string conversion
-		TArray<uint8> NullTerminatedBody = Request.Body;
-		NullTerminatedBody.Add(0);
-		FString BodyString = UTF8_TO_TCHAR(reinterpret_cast<const char*>(NullTerminatedBody.GetData()));
+		OnComplete(CreateErrorResponse(TEXT("Tool registry not initialized"), EHttpServerResponseCodes::ServerError));
+		return true;
+	}
+
+	TSharedRef<FJsonObject> Params = ParamsJson.ToSharedRef();
 
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BodyString);
-		if (!FJsonSerializer::Deserialize(Reader, ParamsJson) || !ParamsJson.IsValid())
+	if (WantsEventStream(Request))
+	{
+		StartEventStream(ToolName, Params, OnComplete);
+		return true;
+	}
+
+	// Answer from the game thread once the tool has run, nothing sits waiting on it in between
+	TSharedPtr<FMCPToolRegistry> Registry = ToolRegistry;
+
+	CompleteOnGameThread([Registry, ToolName, Params]()
+	{
+		return CreateToolResponse(Registry->ExecuteTool(ToolName, Params));
+	}, OnComplete);
+
+	return true;
+}
+
+bool FUnrealClaudeMCPServer::HandleExecuteBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	// Body: { "calls": [ { "tool": "name", "params": { ... } }, ... ], "stop_on_error": false }
+	TSharedPtr<FJsonObject> BodyJson;
+	FString ParseError;
+	if (!ParseJsonBody(Request, BodyJson, ParseError))
+	{
+		OnComplete(CreateErrorResponse(ParseError, EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* CallsArray = nullptr;
+	if (!BodyJson->TryGetArrayField(TEXT("calls"), CallsArray) || CallsArray->Num() == 0)
+	{
+		OnComplete(CreateErrorResponse(TEXT("Batch requires a non-empty 'calls' array"), EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	if (CallsArray->Num() > UnrealClaudeConstants::MCPServer::MaxBatchSize)
+	{
+		OnComplete(CreateErrorResponse(FString::Printf(TEXT("Batch has %d calls (max %d)"), CallsArray->Num(), UnrealClaudeConstants::MCPServer::MaxBatchSize), EHttpServerResponseCodes::BadRequest));
+		return true;
+	}
+
+	bool bStopOnError = false;
+	BodyJson->TryGetBoolField(TEXT("stop_on_error"), bStopOnError);
+
+	// Validate every call up front so a malformed batch doesn't half run
+	TArray<FMCPToolCall> Calls;
+	Calls.Reserve(CallsArray->Num());
+
+	for (int32 Index = 0; Index < CallsArray->Num(); ++Index)
+	{
+		const TSharedPtr<FJsonObject>* CallJson = nullptr;
+		FMCPToolCall Call;
+
+		if (!(*CallsArray)[Index]->TryGetObject(CallJson) || !(*CallJson)->TryGetStringField(TEXT("tool"), Call.ToolName) || Call.ToolName.IsEmpty())
 		{
-			UE_LOG(LogUnrealClaude, Warning, TEXT("Failed to parse JSON body: %s"), *BodyString);
-			OnComplete(CreateErrorResponse(TEXT("Invalid JSON body"), EHttpServerResponseCodes::BadRequest));
+			OnComplete(CreateErrorResponse(FString::Printf(TEXT("Call %d needs a 'tool' name"), Index), EHttpServerResponseCodes::BadRequest));
 			return true;
 		}
-	}
-	else
-	{
-		ParamsJson = MakeShared<FJsonObject>();
+
+		const TSharedPtr<FJsonObject>* CallParams = nullptr;
+		if ((*CallJson)->TryGetObjectField(TEXT("params"), CallParams) && CallParams->IsValid())
+		{
+			Call.Params = CallParams->ToSharedRef();
+		}
+
+		Calls.Add(MoveTemp(Call));
 	}
 
-	// Execute tool
 	if (!ToolRegistry.IsValid())
 	{
 		OnComplete(CreateErrorResponse(TEXT("Tool registry not initialized"), EHttpServerResponseCodes::ServerError));
 		return true;
 	}
 
-	FMCPToolResult Result = ToolRegistry->ExecuteTool(ToolName, ParamsJson.ToSharedRef());
+	TSharedPtr<FMCPToolRegistry> Registry = ToolRegistry;
 
-	// Build response
-	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
-	ResponseJson->SetBoolField(TEXT("success"), Result.bSuccess);
-	ResponseJson->SetStringField(TEXT("message"), Result.Message);
+	CompleteOnGameThread([Registry, Calls = MoveTemp(Calls), bStopOnError]()
+	{
+		return CreateBatchResponse(Calls, Registry->ExecuteBatch(Calls, bStopOnError));
+	}, OnComplete);
 
-	if (Result.Data.IsValid())
+	return true;
+}
+
+void FUnrealClaudeMCPServer::StartEventStream(const FString& ToolName, const TSharedRef<FJsonObject>& Params, const FHttpResultCallback& OnComplete)
+{
+	TSharedPtr<FMCPEventStream> Stream = MakeShared<FMCPEventStream>(ToolName);
+	EventStreams.Add(Stream->GetId(), Stream);
+
+	TSharedPtr<FMCPToolRegistry> Registry = ToolRegistry;
+
+	const double DispatchTime = FPlatformTime::Seconds();
+
+	AsyncTask(ENamedThreads::GameThread, [Registry, Stream, ToolName, Params, DispatchTime]()
 	{
-		ResponseJson->SetObjectField(TEXT("data"), Result.Data);
+		FMCPMetrics::Get().RecordGameThreadWait(FPlatformTime::Seconds() - DispatchTime);
+
+		FMCPToolResult Result;
+		{
+			FMCPToolProgressScope ProgressScope(FMCPToolProgressSink::CreateSP(Stream.ToSharedRef(), &FMCPEventStream::PushProgress));
+			Result = Registry->ExecuteTool(ToolName, Params);
+		}
+
+		// Tools that hand their work to the task queue (execute_script, task_submit) stream the task instead
+		FString TaskIdString;
+		FGuid TaskId;
+		TSharedPtr<FMCPTaskQueue> TaskQueue = Registry->GetTaskQueue();
+
+		if (Result.bSuccess && Result.Data.IsValid() && TaskQueue.IsValid()
+			&& Result.Data->TryGetStringField(TEXT("task_id"), TaskIdString) && FGuid::Parse(TaskIdString, TaskId))
+		{
+			if (TSharedPtr<FMCPAsyncTask> Task = TaskQueue->GetTask(TaskId))
+			{
+				Stream->PushEvent(TEXT("queued"), Result.Data.ToSharedRef());
+				Stream->FollowTask(Task);
+				return;
+			}
+		}
+
+		Stream->Close(Result);
+	});
+
+	// The stream event goes out right away, the client reconnects to the events url for the rest
+	Stream->Poll(INDEX_NONE, [OnComplete](const FString& Body)
+	{
+		OnComplete(CreateEventStreamResponse(Body));
+	});
+}
+
+bool FUnrealClaudeMCPServer::HandleStreamEvents(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	// Extract stream id from path: /mcp/stream/{id}
+	FString StreamIdString = Request.RelativePath.GetPath();
+	StreamIdString.RemoveFromStart(TEXT("/mcp/stream"));
+	StreamIdString.RemoveFromStart(TEXT("/"));
+
+	FGuid StreamId;
+	TSharedPtr<FMCPEventStream>* Stream = FGuid::Parse(StreamIdString, StreamId) ? EventStreams.Find(StreamId) : nullptr;
+
+	if (!Stream)
+	{
+		OnComplete(CreateErrorResponse(TEXT("Stream not found or expired"), EHttpServerResponseCodes::NotFound));
+		return true;
 	}
 
-	FString JsonString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+	// Resume after the last event the client saw, standard SSE header or query parameter
+	int32 LastEventId = INDEX_NONE;
+	const TArray<FString>* LastEventIdHeader = Request.Headers.Find(TEXT("Last-Event-ID"));
+
+	if (LastEventIdHeader && LastEventIdHeader->Num() > 0)
+	{
+		LexFromString(LastEventId, *(*LastEventIdHeader)[0]);
+	}
+	else if (const FString* LastEventIdParam = Request.QueryParams.Find(TEXT("last_event_id")))
+	{
+		LexFromString(LastEventId, **LastEventIdParam);
+	}
+
+	(*Stream)->Poll(LastEventId, [OnComplete](const FString& Body)
+	{
+		OnComplete(CreateEventStreamResponse(Body));
+	});
+
+	return true;
+}
+
+bool FUnrealClaudeMCPServer::HandleGetBlob(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	// Extract blob id from path: /mcp/blob/{id}
+	FString BlobIdString = Request.RelativePath.GetPath();
+	BlobIdString.RemoveFromStart(TEXT("/mcp/blob"));
+	BlobIdString.RemoveFromStart(TEXT("/"));
+
+	FGuid BlobId;
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Blob = FGuid::Parse(BlobIdString, BlobId) ? FMCPBlobStore::Get().Find(BlobId) : nullptr;
+
+	if (!Blob.IsValid())
+	{
+		OnComplete(CreateErrorResponse(TEXT("Blob not found or expired"), EHttpServerResponseCodes::NotFound));
+		return true;
+	}
+
+	TArray<uint8> Body = Blob->Data;
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(MoveTemp(Body), Blob->ContentType);
+	Response->Code = EHttpServerResponseCodes::Ok;
+
+	// Blobs never change, clients may keep them until they expire
+	const int32 MaxAge = FMath::Max(0, FMath::FloorToInt(Blob->ExpireTime - FPlatformTime::Seconds()));
+	Response->Headers.Add(TEXT("Cache-Control"), { FString::Printf(TEXT("private, max-age=%d, immutable"), MaxAge) });
+	AddCorsHeaders(*Response);
+
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+bool FUnrealClaudeMCPServer::TickEventStreams(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	for (auto It = EventStreams.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->Tick(Now))
+		{
+			It.RemoveCurrent();
+		}
+	}
 
-	EHttpServerResponseCodes Code = Result.bSuccess ? EHttpServerResponseCodes::Ok : EHttpServerResponseCodes::BadRequest;
-	OnComplete(CreateJsonResponse(JsonString, Code));
 	return true;
 }
 
 bool FUnrealClaudeMCPServer::HandleStatus(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
 {
+	// The tools part only changes with the registry, it's built with the tools listing
+	UpdateToolsListing();
+
 	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
 
 	ResponseJson->SetStringField(TEXT("status"), TEXT("running"));
 	ResponseJson->SetNumberField(TEXT("port"), ServerPort);
 	ResponseJson->SetStringField(TEXT("version"), TEXT("1.0.0"));
-	ResponseJson->SetNumberField(TEXT("toolCount"), ToolRegistry.IsValid() ? ToolRegistry->GetAllTools().Num() : 0);
+	ResponseJson->SetNumberField(TEXT("toolCount"), StatusTools.Num());
 
 	// Add list of available tools
 	if (ToolRegistry.IsValid())
 	{
-		TArray<TSharedPtr<FJsonValue>> ToolsArray;
-		for (const FMCPToolInfo& ToolInfo : ToolRegistry->GetAllTools())
-		{
-			TSharedPtr<FJsonObject> ToolObj = MakeShared<FJsonObject>();
-			ToolObj->SetStringField(TEXT("name"), ToolInfo.Name);
-			ToolObj->SetStringField(TEXT("description"), ToolInfo.Description);
-			ToolsArray.Add(MakeShared<FJsonValueObject>(ToolObj));
-		}
-		ResponseJson->SetArrayField(TEXT("tools"), ToolsArray);
+		ResponseJson->SetArrayField(TEXT("tools"), StatusTools);
 	}
 
 	// Add project info
@@ -301,15 +638,379 @@ bool FUnrealClaudeMCPServer::HandleStatus(const FHttpServerRequest& Request, con
 	return true;
 }
 
+bool FUnrealClaudeMCPServer::HandleMetrics(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	TSharedPtr<FMCPTaskQueue> TaskQueue = ToolRegistry.IsValid() ? ToolRegistry->GetTaskQueue() : nullptr;
+
+	TUniquePtr<FHttpServerResponse> Response = FMCPMetrics::Get().CreateResponse(TaskQueue.Get());
+	AddCorsHeaders(*Response);
+
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+bool FUnrealClaudeMCPServer::HandleJsonRpc(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	// The route also receives POSTs under /mcp/ that no other route took
+	FString SubPath = Request.RelativePath.GetPath();
+	SubPath.RemoveFromStart(TEXT("/mcp"));
+	SubPath.RemoveFromStart(TEXT("/"));
+	if (!SubPath.IsEmpty())
+	{
+		OnComplete(CreateErrorResponse(TEXT("Not found"), EHttpServerResponseCodes::NotFound));
+		return true;
+	}
+
+	// Web pages could otherwise drive the editor through a DNS rebinding attack
+	if (!IsLocalOrigin(Request))
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Rejected MCP request from a non-local origin"));
+		OnComplete(CreateErrorResponse(TEXT("Origin not allowed"), EHttpServerResponseCodes::Forbidden));
+		return true;
+	}
+
+	// Batching was dropped from the protocol in 2025-06-18, POST /mcp/batch covers it for tools
+	const int32 FirstByte = Request.Body.IndexOfByPredicate([](uint8 Byte) { return !FChar::IsWhitespace(static_cast<TCHAR>(Byte)); });
+	if (FirstByte != INDEX_NONE && Request.Body[FirstByte] == '[')
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateJsonRpcResponse(FMCPJsonRpc::MakeError(nullptr, MCPJsonRpcErrors::InvalidRequest, TEXT("Batched JSON-RPC messages are not supported")));
+		Response->Code = EHttpServerResponseCodes::BadRequest;
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> MessageJson;
+	FString ParseError;
+	if (!ParseJsonBody(Request, MessageJson, ParseError))
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateJsonRpcResponse(FMCPJsonRpc::MakeError(nullptr, MCPJsonRpcErrors::ParseError, ParseError));
+		Response->Code = EHttpServerResponseCodes::BadRequest;
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	FString Version;
+	FString Method;
+	const bool bHasMethod = MessageJson->TryGetStringField(TEXT("method"), Method);
+	const TSharedPtr<FJsonValue> Id = MessageJson->TryGetField(TEXT("id"));
+
+	// Notifications and responses to server requests get no reply, just an acknowledgement
+	if ((bHasMethod && !Id.IsValid()) || (!bHasMethod && (MessageJson->HasField(TEXT("result")) || MessageJson->HasField(TEXT("error")))))
+	{
+		UE_LOG(LogUnrealClaude, Verbose, TEXT("MCP notification: %s"), bHasMethod ? *Method : TEXT("(response)"));
+
+		TUniquePtr<FHttpServerResponse> Response = MakeUnique<FHttpServerResponse>();
+		Response->Code = EHttpServerResponseCodes::Accepted;
+		AddCorsHeaders(*Response);
+
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	const bool bValidId = Id.IsValid() && (Id->Type == EJson::String || Id->Type == EJson::Number);
+	if (!MessageJson->TryGetStringField(TEXT("jsonrpc"), Version) || Version != TEXT("2.0") || !bHasMethod || !bValidId)
+	{
+		TUniquePtr<FHttpServerResponse> Response = CreateJsonRpcResponse(FMCPJsonRpc::MakeError(bValidId ? Id : nullptr, MCPJsonRpcErrors::InvalidRequest, TEXT("Invalid JSON-RPC request")));
+		Response->Code = EHttpServerResponseCodes::BadRequest;
+		OnComplete(MoveTemp(Response));
+		return true;
+	}
+
+	const TSharedPtr<FJsonObject>* ParamsJson = nullptr;
+	MessageJson->TryGetObjectField(TEXT("params"), ParamsJson);
+
+	DispatchJsonRpc(Method, Id, ParamsJson ? *ParamsJson : nullptr, OnComplete);
+	return true;
+}
+
+void FUnrealClaudeMCPServer::DispatchJsonRpc(const FString& Method, const TSharedPtr<FJsonValue>& Id, const TSharedPtr<FJsonObject>& Params, const FHttpResultCallback& OnComplete)
+{
+	if (Method == TEXT("initialize"))
+	{
+		OnComplete(CreateJsonRpcResponse(FMCPJsonRpc::MakeResponse(Id, FMCPJsonRpc::BuildInitializeResult(Params))));
+		return;
+	}
+
+	if (Method == TEXT("ping"))
+	{
+		OnComplete(CreateJsonRpcResponse(FMCPJsonRpc::MakeResponse(Id, MakeShared<FJsonObject>())));
+		return;
+	}
+
+	if (Method == TEXT("tools/list"))
+	{
+		UpdateToolsListing();
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetArrayField(TEXT("tools"), JsonRpcTools);
+
+		OnComplete(CreateJsonRpcResponse(FMCPJsonRpc::MakeResponse(Id, Result)));
+		return;
+	}
+
+	if (Method == TEXT("tools/call"))
+	{
+		FString ToolName;
+		if (!FJsonUtils::GetStringField(Params, TEXT("name"), ToolName) || ToolName.IsEmpty())
+		{
+			OnComplete(CreateJsonRpcResponse(FMCPJsonRpc::MakeError(Id, MCPJsonRpcErrors::InvalidParams, TEXT("Missing tool name"))));
+			return;
+		}
+
+		if (!ToolRegistry.IsValid())
+		{
+			OnComplete(CreateJsonRpcResponse(FMCPJsonRpc::MakeError(Id, MCPJsonRpcErrors::InternalError, TEXT("Tool registry not initialized"))));
+			return;
+		}
+
+		// Unknown tools are a protocol error, failures of a known tool come back as an isError result
+		if (!ToolRegistry->FindTool(ToolName))
+		{
+			OnComplete(CreateJsonRpcResponse(FMCPJsonRpc::MakeError(Id, MCPJsonRpcErrors::InvalidParams, FString::Printf(TEXT("Unknown tool: %s"), *ToolName))));
+			return;
+		}
+
+		const TSharedPtr<FJsonObject>* ArgumentsJson = nullptr;
+		TSharedRef<FJsonObject> Arguments = Params->TryGetObjectField(TEXT("arguments"), ArgumentsJson)
+			? ArgumentsJson->ToSharedRef()
+			: MakeShared<FJsonObject>();
+
+		TSharedPtr<FMCPToolRegistry> Registry = ToolRegistry;
+
+		CompleteOnGameThread([Registry, ToolName, Arguments, Id]()
+		{
+			return CreateJsonRpcResponse(FMCPJsonRpc::MakeResponse(Id, FMCPJsonRpc::BuildToolCallResult(Registry->ExecuteTool(ToolName, Arguments))));
+		}, OnComplete);
+		return;
+	}
+
+	OnComplete(CreateJsonRpcResponse(FMCPJsonRpc::MakeError(Id, MCPJsonRpcErrors::MethodNotFound, FString::Printf(TEXT("Method not found: %s"), *Method))));
+}
+
+bool FUnrealClaudeMCPServer::HandleJsonRpcStream(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+{
+	FString SubPath = Request.RelativePath.GetPath();
+	SubPath.RemoveFromStart(TEXT("/mcp"));
+	SubPath.RemoveFromStart(TEXT("/"));
+	if (!SubPath.IsEmpty())
+	{
+		OnComplete(CreateErrorResponse(TEXT("Not found"), EHttpServerResponseCodes::NotFound));
+		return true;
+	}
+
+	// Nothing is ever sent unprompted, so clients fall back to plain request/response
+	TUniquePtr<FHttpServerResponse> Response = CreateErrorResponse(TEXT("Server initiated streams are not supported, POST JSON-RPC messages to /mcp"), EHttpServerResponseCodes::BadMethod);
+	Response->Headers.Add(TEXT("Allow"), { TEXT("POST") });
+
+	OnComplete(MoveTemp(Response));
+	return true;
+}
+
+bool FUnrealClaudeMCPServer::ParseJsonBody(const FHttpServerRequest& Request, TSharedPtr<FJsonObject>& OutJson, FString& OutError) const
+{
+	if (Request.Body.Num() > UnrealClaudeConstants::MCPServer::MaxRequestBodySize)
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Request body too large: %d bytes (max %d)"), Request.Body.Num(), UnrealClaudeConstants::MCPServer::MaxRequestBodySize);
+		OutError = TEXT("Request body too large");
+		return false;
+	}
+
+	if (Request.Body.Num() == 0)
+	{
+		OutJson = MakeShared<FJsonObject>();
+		return true;
+	}
+
+	// Parse the UTF-8 body in place rather than copying it into an FString first
+	FString ReaderError;
+	OutJson = FJsonUtils::ParseUtf8(Request.Body, &ReaderError);
+	if (!OutJson.IsValid())
+	{
+		UE_LOG(LogUnrealClaude, Warning, TEXT("Failed to parse JSON body (%d bytes): %s"), Request.Body.Num(), *ReaderError);
+		OutError = TEXT("Invalid JSON body");
+		return false;
+	}
+
+	return true;
+}
+
+TSharedPtr<FJsonObject> FUnrealClaudeMCPServer::ToolResultToJson(const FMCPToolResult& Result)
+{
+	TSharedPtr<FJsonObject> ResultJson = MakeShared<FJsonObject>();
+	ResultJson->SetBoolField(TEXT("success"), Result.bSuccess);
+	ResultJson->SetStringField(TEXT("message"), Result.Message);
+
+	if (Result.Data.IsValid())
+	{
+		ResultJson->SetObjectField(TEXT("data"), Result.Data);
+	}
+
+	return ResultJson;
+}
+
+void FUnrealClaudeMCPServer::CompleteOnGameThread(TUniqueFunction<TUniquePtr<FHttpServerResponse>()>&& BuildResponse, const FHttpResultCallback& OnComplete)
+{
+	const double DispatchTime = FPlatformTime::Seconds();
+
+	// Always queue, even from the game thread, so the route handler returns before the tool runs
+	AsyncTask(ENamedThreads::GameThread, [BuildResponse = MoveTemp(BuildResponse), OnComplete, DispatchTime]()
+	{
+		FMCPMetrics::Get().RecordGameThreadWait(FPlatformTime::Seconds() - DispatchTime);
+		OnComplete(BuildResponse());
+	});
+}
+
+TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateToolResponse(const FMCPToolResult& Result)
+{
+	TSharedPtr<FJsonObject> ResponseJson = ToolResultToJson(Result);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+
+	EHttpServerResponseCodes Code = Result.bSuccess ? EHttpServerResponseCodes::Ok : EHttpServerResponseCodes::BadRequest;
+	return CreateJsonResponse(JsonString, Code);
+}
+
+TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateBatchResponse(const TArray<FMCPToolCall>& Calls, const TArray<FMCPToolResult>& Results)
+{
+	// Calls skipped after a failure are reported so results line up with calls
+	TArray<TSharedPtr<FJsonValue>> ResultsArray;
+	int32 NumSucceeded = 0;
+
+	for (int32 Index = 0; Index < Calls.Num(); ++Index)
+	{
+		TSharedPtr<FJsonObject> ResultJson;
+
+		if (Results.IsValidIndex(Index))
+		{
+			ResultJson = ToolResultToJson(Results[Index]);
+			NumSucceeded += Results[Index].bSuccess ? 1 : 0;
+		}
+		else
+		{
+			ResultJson = MakeShared<FJsonObject>();
+			ResultJson->SetBoolField(TEXT("success"), false);
+			ResultJson->SetBoolField(TEXT("skipped"), true);
+			ResultJson->SetStringField(TEXT("message"), TEXT("Skipped after an earlier call failed"));
+		}
+
+		ResultJson->SetStringField(TEXT("tool"), Calls[Index].ToolName);
+		ResultsArray.Add(MakeShared<FJsonValueObject>(ResultJson));
+	}
+
+	TSharedPtr<FJsonObject> ResponseJson = MakeShared<FJsonObject>();
+	ResponseJson->SetBoolField(TEXT("success"), NumSucceeded == Calls.Num());
+	ResponseJson->SetStringField(TEXT("message"), FString::Printf(TEXT("%d of %d calls succeeded"), NumSucceeded, Calls.Num()));
+	ResponseJson->SetNumberField(TEXT("executed"), Results.Num());
+	ResponseJson->SetArrayField(TEXT("results"), ResultsArray);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(ResponseJson.ToSharedRef(), Writer);
+
+	// Individual failures are reported per call, the batch itself was handled
+	return CreateJsonResponse(JsonString);
+}
+
+bool FUnrealClaudeMCPServer::MatchesETag(const FHttpServerRequest& Request, const FString& ETag)
+{
+	const TArray<FString>* IfNoneMatch = Request.Headers.Find(TEXT("If-None-Match"));
+	if (!IfNoneMatch || ETag.IsEmpty())
+	{
+		return false;
+	}
+
+	// Header values may hold several comma separated tags, possibly weak
+	for (const FString& HeaderValue : *IfNoneMatch)
+	{
+		TArray<FString> Tags;
+		HeaderValue.ParseIntoArray(Tags, TEXT(","));
+
+		for (FString& Tag : Tags)
+		{
+			Tag.TrimStartAndEndInline();
+			Tag.RemoveFromStart(TEXT("W/"));
+
+			if (Tag == TEXT("*") || Tag.Equals(ETag, ESearchCase::CaseSensitive))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool FUnrealClaudeMCPServer::WantsEventStream(const FHttpServerRequest& Request)
+{
+	if (const FString* StreamParam = Request.QueryParams.Find(TEXT("stream")))
+	{
+		return StreamParam->ToBool();
+	}
+
+	const TArray<FString>* AcceptHeader = Request.Headers.Find(TEXT("Accept"));
+	return AcceptHeader && AcceptHeader->ContainsByPredicate([](const FString& Value)
+	{
+		return Value.Contains(TEXT("text/event-stream"));
+	});
+}
+
+TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateEventStreamResponse(const FString& Body)
+{
+	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(Body, TEXT("text/event-stream"));
+	Response->Code = EHttpServerResponseCodes::Ok;
+	Response->Headers.Add(TEXT("Cache-Control"), { TEXT("no-cache") });
+	AddCorsHeaders(*Response);
+
+	return Response;
+}
+
+bool FUnrealClaudeMCPServer::IsLocalOrigin(const FHttpServerRequest& Request)
+{
+	// Non-browser clients don't send an Origin
+	const TArray<FString>* OriginHeader = Request.Headers.Find(TEXT("Origin"));
+	if (!OriginHeader || OriginHeader->Num() == 0)
+	{
+		return true;
+	}
+
+	FString Host = (*OriginHeader)[0].TrimStartAndEnd();
+	if (!Host.RemoveFromStart(TEXT("http://")) && !Host.RemoveFromStart(TEXT("https://")))
+	{
+		return false;
+	}
+
+	// Drop the port, the last colon of a bracketed IPv6 host is part of the address
+	int32 PortIndex = INDEX_NONE;
+	if (Host.FindLastChar(TEXT(':'), PortIndex) && !Host.EndsWith(TEXT("]")))
+	{
+		Host.LeftInline(PortIndex);
+	}
+
+	return Host.Equals(TEXT("localhost"), ESearchCase::IgnoreCase) || Host == TEXT("127.0.0.1") || Host == TEXT("[::1]");
+}
+
+TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateJsonRpcResponse(const TSharedRef<FJsonObject>& Message)
+{
+	// Errors are reported in the message, the HTTP exchange itself succeeded
+	return CreateJsonResponse(FJsonUtils::Stringify(Message));
+}
+
+void FUnrealClaudeMCPServer::AddCorsHeaders(FHttpServerResponse& Response)
+{
+	// Restricted to localhost for security
+	Response.Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
+	Response.Headers.Add(TEXT("Access-Control-Allow-Methods"), { TEXT("GET, POST, OPTIONS") });
+	Response.Headers.Add(TEXT("Access-Control-Allow-Headers"), { TEXT("Content-Type, Accept, Last-Event-ID, MCP-Protocol-Version") });
+}
+
 TUniquePtr<FHttpServerResponse> FUnrealClaudeMCPServer::CreateJsonResponse(const FString& JsonContent, EHttpServerResponseCodes Code)
 {
 	TUniquePtr<FHttpServerResponse> Response = FHttpServerResponse::Create(JsonContent, TEXT("application/json"));
 	Response->Code = Code;
 
-	// Add CORS headers - restricted to localhost for security
-	Response->Headers.Add(TEXT("Access-Control-Allow-Origin"), { TEXT("http://localhost") });
-	Response->Headers.Add(TEXT("Access-Control-Allow-Methods"), { TEXT("GET, POST, OPTIONS") });
-	Response->Headers.Add(TEXT("Access-Control-Allow-Headers"), { TEXT("Content-Type") });
+	AddCorsHeaders(*Response);
 
 	return Response;
 }
@@ -5,9 +5,15 @@
 #include "CoreMinimal.h"
 #include "HttpServerModule.h"
 #include "IHttpRouter.h"
+#include "Containers/Ticker.h"
 #include "UnrealClaudeConstants.h"
 
 class FMCPToolRegistry;
+class FJsonObject;
+class FJsonValue;
+class FMCPEventStream;
+struct FMCPToolResult;
+struct FMCPToolCall;
 
 /**
  * MCP HTTP Server for editor control
@@ -41,17 +47,86 @@ private:
 	/** Handle GET /mcp/tools - List all available tools */
 	bool HandleListTools(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** Rebuild the serialized tools listing if the registry changed since it was built */
+	void UpdateToolsListing();
+
 	/** Handle POST /mcp/tool/{name} - Execute a tool */
 	bool HandleExecuteTool(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** Handle POST /mcp/batch - Execute several tools in one request */
+	bool HandleExecuteBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Handle GET /mcp/stream/{id} - Get the next events of a streamed tool call */
+	bool HandleStreamEvents(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Handle GET /mcp/blob/{id} - Download a binary tool result */
+	bool HandleGetBlob(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Start a streamed tool call and answer with its first event */
+	void StartEventStream(const FString& ToolName, const TSharedRef<FJsonObject>& Params, const FHttpResultCallback& OnComplete);
+
+	/** Tick event streams, dropping finished ones */
+	bool TickEventStreams(float DeltaTime);
+
 	/** Handle GET /mcp/status - Get server status */
 	bool HandleStatus(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
 
+	/** Handle GET /mcp/metrics - Get server metrics in Prometheus text format */
+	bool HandleMetrics(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Handle POST /mcp - MCP JSON-RPC message (streamable HTTP transport) */
+	bool HandleJsonRpc(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Handle GET /mcp - Server initiated streams aren't offered, answers 405 */
+	bool HandleJsonRpcStream(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete);
+
+	/** Answer a JSON-RPC request from HandleJsonRpc, tools/call completes later on the game thread */
+	void DispatchJsonRpc(const FString& Method, const TSharedPtr<FJsonValue>& Id, const TSharedPtr<FJsonObject>& Params, const FHttpResultCallback& OnComplete);
+
+	/** Route handler member function */
+	using FRouteHandler = bool (FUnrealClaudeMCPServer::*)(const FHttpServerRequest&, const FHttpResultCallback&);
+
+	/** Wrap a route handler so its requests count towards the in-flight and response metrics, and large responses get compressed */
+	FHttpRequestHandler CreateTrackedHandler(FRouteHandler Handler);
+
+	/** Helper to parse the JSON object in a request body. An empty body parses as an empty object */
+	bool ParseJsonBody(const FHttpServerRequest& Request, TSharedPtr<FJsonObject>& OutJson, FString& OutError) const;
+
+	/** Helper to convert a tool result to its JSON response form */
+	static TSharedPtr<FJsonObject> ToolResultToJson(const FMCPToolResult& Result);
+
+	/** Helper to run work on the game thread after the route handler has returned, then complete the request with its response */
+	static void CompleteOnGameThread(TUniqueFunction<TUniquePtr<FHttpServerResponse>()>&& BuildResponse, const FHttpResultCallback& OnComplete);
+
+	/** Helper to create the response for a tool result */
+	static TUniquePtr<FHttpServerResponse> CreateToolResponse(const FMCPToolResult& Result);
+
+	/** Helper to create the response for a batch, with one entry per call */
+	static TUniquePtr<FHttpServerResponse> CreateBatchResponse(const TArray<FMCPToolCall>& Calls, const TArray<FMCPToolResult>& Results);
+
+	/** Helper to check if a conditional request's If-None-Match covers the given ETag */
+	static bool MatchesETag(const FHttpServerRequest& Request, const FString& ETag);
+
+	/** Helper to check if a request asked for a text/event-stream response */
+	static bool WantsEventStream(const FHttpServerRequest& Request);
+
+	/** Helper to create a text/event-stream response */
+	static TUniquePtr<FHttpServerResponse> CreateEventStreamResponse(const FString& Body);
+
+	/** Helper to check that a request's Origin, if any, is a local page */
+	static bool IsLocalOrigin(const FHttpServerRequest& Request);
+
+	/** Helper to create the response for a JSON-RPC message */
+	static TUniquePtr<FHttpServerResponse> CreateJsonRpcResponse(const TSharedRef<FJsonObject>& Message);
+
+	/** Helper to add the CORS headers every response carries */
+	static void AddCorsHeaders(FHttpServerResponse& Response);
+
 	/** Helper to create JSON response */
-	TUniquePtr<FHttpServerResponse> CreateJsonResponse(const FString& JsonContent, EHttpServerResponseCodes Code = EHttpServerResponseCodes::Ok);
+	static TUniquePtr<FHttpServerResponse> CreateJsonResponse(const FString& JsonContent, EHttpServerResponseCodes Code = EHttpServerResponseCodes::Ok);
 
 	/** Helper to create error response */
-	TUniquePtr<FHttpServerResponse> CreateErrorResponse(const FString& Message, EHttpServerResponseCodes Code = EHttpServerResponseCodes::BadRequest);
+	static TUniquePtr<FHttpServerResponse> CreateErrorResponse(const FString& Message, EHttpServerResponseCodes Code = EHttpServerResponseCodes::BadRequest);
 
 private:
 	/** HTTP router handle */
@@ -60,11 +135,41 @@ private:
 	/** Route handles for cleanup */
 	FHttpRouteHandle ListToolsHandle;
 	FHttpRouteHandle ExecuteToolHandle;
+	FHttpRouteHandle ExecuteBatchHandle;
+	FHttpRouteHandle StreamEventsHandle;
+	FHttpRouteHandle BlobHandle;
 	FHttpRouteHandle StatusHandle;
+	FHttpRouteHandle MetricsHandle;
+	FHttpRouteHandle JsonRpcHandle;
+	FHttpRouteHandle JsonRpcStreamHandle;
 
 	/** Tool registry */
 	TSharedPtr<FMCPToolRegistry> ToolRegistry;
 
+	/** Serialized GET /mcp/tools response body (UTF-8) */
+	TArray<uint8> ToolsListingBody;
+
+	/** tools/list entries for the JSON-RPC endpoint, built with the tools listing */
+	TArray<TSharedPtr<FJsonValue>> JsonRpcTools;
+
+	/** Tool names and descriptions for GET /mcp/status, built with the tools listing */
+	TArray<TSharedPtr<FJsonValue>> StatusTools;
+
+	/** ETag of the tools listing */
+	FString ToolsListingETag;
+
+	/** Registry version the tools listing was built from */
+	uint32 ToolsListingVersion = 0;
+
+	/** Whether the tools listing has been built */
+	bool bToolsListingValid = false;
+
+	/** Streamed tool calls by stream id */
+	TMap<FGuid, TSharedPtr<FMCPEventStream>> EventStreams;
+
+	/** Ticker for event streams */
+	FTSTicker::FDelegateHandle StreamTickerHandle;
+
 	/** Server state */
 	bool bIsRunning;
 	uint32 ServerPort;
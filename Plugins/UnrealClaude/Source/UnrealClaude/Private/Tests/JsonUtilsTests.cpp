@@ -0,0 +1,171 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Unit tests for JSON parsing used by the MCP server
+ * Tests that UTF-8 request bodies parse like their FString form, and times both paths
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "JsonUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace JsonUtilsTests
+{
+	/** Encode a string as UTF-8 bytes without a null terminator, like an HTTP request body */
+	TArray<uint8> ToUtf8Body(const FString& Json)
+	{
+		FTCHARToUTF8 Utf8(*Json);
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	}
+
+	/** Parse a body the way the MCP server did before ParseUtf8 */
+	TSharedPtr<FJsonObject> ParseViaString(const TArray<uint8>& Body)
+	{
+		TArray<uint8> NullTerminatedBody = Body;
+		NullTerminatedBody.Add(0);
+		FString BodyString = UTF8_TO_TCHAR(reinterpret_cast<const char*>(NullTerminatedBody.GetData()));
+		return FJsonUtils::Parse(BodyString);
+	}
+
+	/** Build tool params of about TargetSize bytes, shaped like a script plus Blueprint graph nodes */
+	FString MakeParams(int32 TargetSize)
+	{
+		FString Script;
+		FString Nodes;
+
+		for (int32 Index = 0; Script.Len() + Nodes.Len() < TargetSize; ++Index)
+		{
+			Script += FString::Printf(TEXT("print(\\\"line %d é中\\\")\\n"), Index);
+			Nodes += FString::Printf(TEXT("%s{\"id\":%d,\"type\":\"K2Node_CallFunction\",\"x\":%d.5,\"pins\":[\"exec\",\"then\"],\"pure\":false}"),
+				Index > 0 ? TEXT(",") : TEXT(""), Index, Index * 16);
+		}
+
+		return FString::Printf(TEXT("{\"script_type\":\"python\",\"script\":\"%s\",\"nodes\":[%s]}"), *Script, *Nodes);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FJsonUtils_ParseUtf8_MatchesStringParse,
+	"UnrealClaude.Json.ParseUtf8.MatchesStringParse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FJsonUtils_ParseUtf8_MatchesStringParse::RunTest(const FString& Parameters)
+{
+	const FString Json = TEXT("{\"name\":\"Café 中文 \U0001F600\",\"escaped\":\"a\\\"b\\n\\u00e9\",\"count\":3,\"ratio\":-1.5e2,\"flag\":true,\"none\":null,\"list\":[1,\"two\",{\"three\":3}]}");
+	const TArray<uint8> Body = JsonUtilsTests::ToUtf8Body(Json);
+
+	TSharedPtr<FJsonObject> Parsed = FJsonUtils::ParseUtf8(Body);
+	TSharedPtr<FJsonObject> Expected = FJsonUtils::Parse(Json);
+
+	if (!TestTrue("UTF-8 body should parse", Parsed.IsValid()) || !TestTrue("String should parse", Expected.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual("Multi-byte characters should decode", Parsed->GetStringField(TEXT("name")), FString(TEXT("Café 中文 \U0001F600")));
+	TestEqual("Escapes should decode", Parsed->GetStringField(TEXT("escaped")), FString(TEXT("a\"b\né")));
+	TestEqual("Same object as parsing the string", FJsonUtils::Stringify(Parsed), FJsonUtils::Stringify(Expected));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FJsonUtils_ParseUtf8_NotNullTerminated,
+	"UnrealClaude.Json.ParseUtf8.NotNullTerminated",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FJsonUtils_ParseUtf8_NotNullTerminated::RunTest(const FString& Parameters)
+{
+	// Bytes after the view must not be read
+	const TArray<uint8> Buffer = JsonUtilsTests::ToUtf8Body(TEXT("{\"actor_name\":\"Cube\"}garbage"));
+	const int32 JsonLength = Buffer.Num() - 7;
+
+	TSharedPtr<FJsonObject> Parsed = FJsonUtils::ParseUtf8(TConstArrayView<uint8>(Buffer.GetData(), JsonLength));
+	if (!TestTrue("View should parse", Parsed.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual("Field should be read", Parsed->GetStringField(TEXT("actor_name")), FString(TEXT("Cube")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FJsonUtils_ParseUtf8_Invalid,
+	"UnrealClaude.Json.ParseUtf8.Invalid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FJsonUtils_ParseUtf8_Invalid::RunTest(const FString& Parameters)
+{
+	FString Error;
+
+	TestFalse("Truncated JSON should fail", FJsonUtils::ParseUtf8(JsonUtilsTests::ToUtf8Body(TEXT("{\"a\":")), &Error).IsValid());
+	TestFalse("Failure should report an error", Error.IsEmpty());
+
+	TestFalse("Array root should fail", FJsonUtils::ParseUtf8(JsonUtilsTests::ToUtf8Body(TEXT("[1,2]"))).IsValid());
+	TestFalse("Empty body should fail", FJsonUtils::ParseUtf8(TConstArrayView<uint8>()).IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FJsonUtils_ParseUtf8_Benchmark,
+	"UnrealClaude.Json.ParseUtf8.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter
+)
+
+bool FJsonUtils_ParseUtf8_Benchmark::RunTest(const FString& Parameters)
+{
+	struct FBenchCase
+	{
+		const TCHAR* Label;
+		int32 Size;
+		int32 Iterations;
+	};
+
+	const FBenchCase Cases[] = {
+		{ TEXT("1KB"), 1024, 2000 },
+		{ TEXT("100KB"), 100 * 1024, 50 },
+		{ TEXT("10MB"), 10 * 1024 * 1024, 3 },
+	};
+
+	for (const FBenchCase& Case : Cases)
+	{
+		const TArray<uint8> Body = JsonUtilsTests::ToUtf8Body(JsonUtilsTests::MakeParams(Case.Size));
+
+		TSharedPtr<FJsonObject> ViaString;
+		TSharedPtr<FJsonObject> ViaUtf8;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Case.Iterations; ++Iteration)
+		{
+			ViaString = JsonUtilsTests::ParseViaString(Body);
+		}
+		const double StringMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Case.Iterations;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Case.Iterations; ++Iteration)
+		{
+			ViaUtf8 = FJsonUtils::ParseUtf8(Body);
+		}
+		const double Utf8Ms = (FPlatformTime::Seconds() - StartTime) * 1000.0 / Case.Iterations;
+
+		if (!TestTrue(FString::Printf(TEXT("%s body should parse"), Case.Label), ViaString.IsValid() && ViaUtf8.IsValid()))
+		{
+			continue;
+		}
+
+		TestEqual(FString::Printf(TEXT("%s results should match"), Case.Label), FJsonUtils::Stringify(ViaUtf8), FJsonUtils::Stringify(ViaString));
+		AddInfo(FString::Printf(TEXT("%s (%d bytes): FString %.3f ms, UTF-8 %.3f ms per parse"), Case.Label, Body.Num(), StringMs, Utf8Ms));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
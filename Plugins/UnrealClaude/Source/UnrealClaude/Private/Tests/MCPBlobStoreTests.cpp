@@ -0,0 +1,121 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Unit tests for the MCP blob store
+ * Tests publishing, handles, expiry and the memory cap
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MCP/MCPBlobStore.h"
+#include "Dom/JsonObject.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MCPBlobStoreTests
+{
+	TArray<uint8> MakeBytes(int32 Size, uint8 Value)
+	{
+		TArray<uint8> Bytes;
+		Bytes.Init(Value, Size);
+		return Bytes;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPBlobStore_PublishAndFind,
+	"UnrealClaude.MCP.BlobStore.PublishAndFind",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPBlobStore_PublishAndFind::RunTest(const FString& Parameters)
+{
+	FMCPBlobStore Store(1024);
+
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Blob = Store.Publish(MCPBlobStoreTests::MakeBytes(100, 0xAB), TEXT("image/jpeg"));
+	if (!TestTrue("Blob should be published", Blob.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual("Store should hold one blob", Store.Num(), 1);
+	TestEqual("Store should count its bytes", Store.GetTotalBytes(), static_cast<int64>(100));
+
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Found = Store.Find(Blob->Id);
+	if (!TestTrue("Blob should be found by id", Found.IsValid()))
+	{
+		return false;
+	}
+
+	TestEqual("Content type", Found->ContentType, FString(TEXT("image/jpeg")));
+	TestEqual("Bytes", Found->Data.Num(), 100);
+	TestEqual("Byte value", Found->Data[0], static_cast<uint8>(0xAB));
+
+	TSharedPtr<FJsonObject> Handle = FMCPBlobStore::MakeHandleJson(*Found);
+	TestEqual("Handle id", Handle->GetStringField(TEXT("blob_id")), Blob->Id.ToString());
+	TestEqual("Handle url", Handle->GetStringField(TEXT("url")), FString::Printf(TEXT("/mcp/blob/%s"), *Blob->Id.ToString()));
+	TestEqual("Handle size", static_cast<int32>(Handle->GetNumberField(TEXT("size"))), 100);
+
+	TestTrue("Blob should be removable", Store.Remove(Blob->Id));
+	TestFalse("Removed blob should be gone", Store.Find(Blob->Id).IsValid());
+	TestEqual("Removed bytes should be released", Store.GetTotalBytes(), static_cast<int64>(0));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPBlobStore_Expiry,
+	"UnrealClaude.MCP.BlobStore.Expiry",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPBlobStore_Expiry::RunTest(const FString& Parameters)
+{
+	FMCPBlobStore Store(1024);
+
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> ShortLived = Store.Publish(MCPBlobStoreTests::MakeBytes(10, 1), TEXT("application/octet-stream"), 10.0);
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> LongLived = Store.Publish(MCPBlobStoreTests::MakeBytes(20, 2), TEXT("application/octet-stream"), 1000.0);
+
+	Store.RemoveExpired(FPlatformTime::Seconds() + 60.0);
+
+	TestFalse("Expired blob should be dropped", Store.Find(ShortLived->Id).IsValid());
+	TestTrue("Live blob should stay", Store.Find(LongLived->Id).IsValid());
+	TestEqual("Only live bytes should be counted", Store.GetTotalBytes(), static_cast<int64>(20));
+
+	// A blob already past its lifetime is never served
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Expired = Store.Publish(MCPBlobStoreTests::MakeBytes(10, 3), TEXT("application/octet-stream"), -1.0);
+	TestFalse("Blob past its lifetime should not be found", Store.Find(Expired->Id).IsValid());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPBlobStore_MemoryCap,
+	"UnrealClaude.MCP.BlobStore.MemoryCap",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPBlobStore_MemoryCap::RunTest(const FString& Parameters)
+{
+	FMCPBlobStore Store(300);
+
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> First = Store.Publish(MCPBlobStoreTests::MakeBytes(100, 1), TEXT("image/jpeg"));
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Second = Store.Publish(MCPBlobStoreTests::MakeBytes(100, 2), TEXT("image/jpeg"));
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Third = Store.Publish(MCPBlobStoreTests::MakeBytes(150, 3), TEXT("image/jpeg"));
+
+	TestTrue("Store should stay under its cap", Store.GetTotalBytes() <= 300);
+	TestFalse("Oldest blob should be evicted first", Store.Find(First->Id).IsValid());
+	TestTrue("Newer blob should stay", Store.Find(Second->Id).IsValid());
+	TestTrue("Newest blob should be published", Store.Find(Third->Id).IsValid());
+
+	// A blob larger than the whole store is refused and evicts nothing
+	TestFalse("Oversized blob should be refused", Store.Publish(MCPBlobStoreTests::MakeBytes(301, 4), TEXT("image/jpeg")).IsValid());
+	TestEqual("Refusal should keep the other blobs", Store.Num(), 2);
+
+	// Holders of a blob keep its bytes even after eviction
+	TestEqual("Evicted blob should stay readable by its holder", First->Data.Num(), 100);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
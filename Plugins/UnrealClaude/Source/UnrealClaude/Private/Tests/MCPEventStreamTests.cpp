@@ -0,0 +1,142 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Unit tests for MCP tool event streams and progress reporting
+ * Tests SSE formatting, Last-Event-ID resume, waiting requests and progress scopes
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MCP/MCPEventStream.h"
+#include "MCP/MCPToolProgress.h"
+#include "Dom/JsonObject.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ===== Event Stream Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPEventStream_FirstEventImmediate,
+	"UnrealClaude.MCP.EventStream.FirstEventImmediate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPEventStream_FirstEventImmediate::RunTest(const FString& Parameters)
+{
+	TSharedRef<FMCPEventStream> Stream = MakeShared<FMCPEventStream>(TEXT("capture_viewport"));
+
+	FString Body;
+	bool bResponded = false;
+	Stream->Poll(INDEX_NONE, [&Body, &bResponded](const FString& InBody)
+	{
+		Body = InBody;
+		bResponded = true;
+	});
+
+	TestTrue("New stream should answer right away", bResponded);
+	TestTrue("First event should have id 0", Body.StartsWith(TEXT("id: 0\n")));
+	TestTrue("First event should be the stream event", Body.Contains(TEXT("event: stream\n")));
+	TestTrue("Stream event should carry the stream id", Body.Contains(Stream->GetId().ToString()));
+	TestTrue("Event should end with a blank line", Body.EndsWith(TEXT("\n\n")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPEventStream_WaitsForNextEvent,
+	"UnrealClaude.MCP.EventStream.WaitsForNextEvent",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPEventStream_WaitsForNextEvent::RunTest(const FString& Parameters)
+{
+	TSharedRef<FMCPEventStream> Stream = MakeShared<FMCPEventStream>(TEXT("execute_script"));
+
+	FString Body;
+	bool bResponded = false;
+	Stream->Poll(0, [&Body, &bResponded](const FString& InBody)
+	{
+		Body = InBody;
+		bResponded = true;
+	});
+
+	TestFalse("Request after the last event should wait", bResponded);
+
+	Stream->PushProgress(FMCPToolProgress(50, TEXT("Compiling script")));
+
+	TestTrue("Progress should answer the waiting request", bResponded);
+	TestTrue("Progress event should have id 1", Body.StartsWith(TEXT("id: 1\n")));
+	TestTrue("Progress event type", Body.Contains(TEXT("event: progress\n")));
+	TestTrue("Progress message should be in the data", Body.Contains(TEXT("Compiling script")));
+	TestFalse("Already seen events should not be resent", Body.Contains(TEXT("event: stream")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPEventStream_ResultClosesStream,
+	"UnrealClaude.MCP.EventStream.ResultClosesStream",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPEventStream_ResultClosesStream::RunTest(const FString& Parameters)
+{
+	TSharedRef<FMCPEventStream> Stream = MakeShared<FMCPEventStream>(TEXT("blueprint_modify"));
+
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetStringField(TEXT("text"), TEXT("line one\nline two"));
+	Stream->Close(FMCPToolResult::Success(TEXT("Done"), Data));
+
+	TestTrue("Stream should be closed", Stream->IsClosed());
+	TestEqual("Stream and result events", Stream->GetEvents().Num(), 2);
+	TestEqual("Last event should be the result", Stream->GetEvents().Last().Type, FString(TEXT("result")));
+	TestFalse("Event data must stay on one line", Stream->GetEvents().Last().Data.Contains(TEXT("\n")));
+
+	// Events after close are dropped
+	Stream->PushProgress(FMCPToolProgress(100, TEXT("Late")));
+	TestEqual("No events after the result", Stream->GetEvents().Num(), 2);
+
+	// Polling a closed stream answers right away, even with nothing new
+	bool bResponded = false;
+	Stream->Poll(1, [&bResponded](const FString&) { bResponded = true; });
+	TestTrue("Closed stream should not hold requests", bResponded);
+
+	return true;
+}
+
+// ===== Progress Scope Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPToolProgress_InnermostScope,
+	"UnrealClaude.MCP.EventStream.ProgressInnermostScope",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPToolProgress_InnermostScope::RunTest(const FString& Parameters)
+{
+	int32 OuterReports = 0;
+	int32 InnerReports = 0;
+
+	TestFalse("Nobody should listen outside a scope", FMCPToolProgressScope::IsListening());
+	FMCPToolProgressScope::Report(FMCPToolProgress(0, TEXT("Dropped")));
+
+	{
+		FMCPToolProgressScope Outer(FMCPToolProgressSink::CreateLambda([&OuterReports](const FMCPToolProgress&) { ++OuterReports; }));
+		FMCPToolProgressScope::Report(FMCPToolProgress(10, TEXT("Outer")));
+
+		{
+			FMCPToolProgressScope Inner(FMCPToolProgressSink::CreateLambda([&InnerReports](const FMCPToolProgress&) { ++InnerReports; }));
+			FMCPToolProgressScope::Report(FMCPToolProgress(20, TEXT("Inner")));
+		}
+
+		FMCPToolProgressScope::Report(FMCPToolProgress(30, TEXT("Outer again")));
+	}
+
+	TestEqual("Outer scope should get its own reports only", OuterReports, 2);
+	TestEqual("Inner scope should get the nested report", InnerReports, 1);
+	TestFalse("Scopes should be gone", FMCPToolProgressScope::IsListening());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
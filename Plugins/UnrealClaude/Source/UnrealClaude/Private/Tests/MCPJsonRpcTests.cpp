@@ -0,0 +1,164 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Unit tests for the MCP JSON-RPC endpoint's messages
+ * Tests envelopes, initialize, the tools/list schema and tools/call results
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MCP/MCPJsonRpc.h"
+#include "MCP/MCPBlobStore.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPJsonRpc_Envelopes,
+	"UnrealClaude.MCP.JsonRpc.Envelopes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPJsonRpc_Envelopes::RunTest(const FString& Parameters)
+{
+	TSharedRef<FJsonObject> Response = FMCPJsonRpc::MakeResponse(MakeShared<FJsonValueNumber>(7), MakeShared<FJsonObject>());
+	TestEqual("Response version", Response->GetStringField(TEXT("jsonrpc")), FString(TEXT("2.0")));
+	TestEqual("Response id", static_cast<int32>(Response->GetNumberField(TEXT("id"))), 7);
+	TestTrue("Response should hold a result", Response->HasTypedField<EJson::Object>(TEXT("result")));
+	TestFalse("Response should not hold an error", Response->HasField(TEXT("error")));
+
+	TSharedRef<FJsonObject> Error = FMCPJsonRpc::MakeError(MakeShared<FJsonValueString>(TEXT("abc")), MCPJsonRpcErrors::MethodNotFound, TEXT("Method not found"));
+	TestEqual("Error id keeps its type", Error->GetStringField(TEXT("id")), FString(TEXT("abc")));
+	TestEqual("Error code", static_cast<int32>(Error->GetObjectField(TEXT("error"))->GetNumberField(TEXT("code"))), -32601);
+	TestFalse("Error should not hold a result", Error->HasField(TEXT("result")));
+
+	// Requests that couldn't be read are answered with a null id
+	TSharedRef<FJsonObject> ParseError = FMCPJsonRpc::MakeError(nullptr, MCPJsonRpcErrors::ParseError, TEXT("Invalid JSON body"));
+	TestTrue("Unknown id should be null", ParseError->HasTypedField<EJson::Null>(TEXT("id")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPJsonRpc_Initialize,
+	"UnrealClaude.MCP.JsonRpc.Initialize",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPJsonRpc_Initialize::RunTest(const FString& Parameters)
+{
+	const FString Latest = FMCPJsonRpc::GetSupportedProtocolVersions()[0];
+
+	TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>();
+	Params->SetStringField(TEXT("protocolVersion"), TEXT("2025-03-26"));
+
+	TSharedRef<FJsonObject> Result = FMCPJsonRpc::BuildInitializeResult(Params);
+	TestEqual("Supported version should be echoed", Result->GetStringField(TEXT("protocolVersion")), FString(TEXT("2025-03-26")));
+	TestTrue("Tools capability", Result->GetObjectField(TEXT("capabilities"))->HasTypedField<EJson::Object>(TEXT("tools")));
+	TestTrue("Server info name", Result->GetObjectField(TEXT("serverInfo"))->HasTypedField<EJson::String>(TEXT("name")));
+
+	Params->SetStringField(TEXT("protocolVersion"), TEXT("1999-01-01"));
+	TestEqual("Unknown version should get the latest", FMCPJsonRpc::BuildInitializeResult(Params)->GetStringField(TEXT("protocolVersion")), Latest);
+	TestEqual("Missing params should get the latest", FMCPJsonRpc::BuildInitializeResult(nullptr)->GetStringField(TEXT("protocolVersion")), Latest);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPJsonRpc_ToolSchema,
+	"UnrealClaude.MCP.JsonRpc.ToolSchema",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPJsonRpc_ToolSchema::RunTest(const FString& Parameters)
+{
+	FMCPToolInfo Info;
+	Info.Name = TEXT("spawn_actor");
+	Info.Description = TEXT("Spawn an actor");
+	Info.Parameters.Add(FMCPToolParameter(TEXT("class"), TEXT("string"), TEXT("Actor class"), true));
+	Info.Parameters.Add(FMCPToolParameter(TEXT("location"), TEXT("object"), TEXT("World location")));
+	Info.Parameters.Add(FMCPToolParameter(TEXT("count"), TEXT("integer"), TEXT("How many"), false, TEXT("1")));
+	Info.Annotations = FMCPToolAnnotations::Modifying();
+
+	TSharedRef<FJsonObject> ToolJson = FMCPJsonRpc::ToolInfoToJson(Info);
+	TestEqual("Name has no bridge prefix", ToolJson->GetStringField(TEXT("name")), FString(TEXT("spawn_actor")));
+
+	TSharedPtr<FJsonObject> Schema = ToolJson->GetObjectField(TEXT("inputSchema"));
+	TestEqual("Schema type", Schema->GetStringField(TEXT("type")), FString(TEXT("object")));
+
+	TSharedPtr<FJsonObject> Properties = Schema->GetObjectField(TEXT("properties"));
+	TestEqual("Object type kept", Properties->GetObjectField(TEXT("location"))->GetStringField(TEXT("type")), FString(TEXT("object")));
+	TestEqual("Unknown type becomes string", Properties->GetObjectField(TEXT("count"))->GetStringField(TEXT("type")), FString(TEXT("string")));
+	TestEqual("Default kept", Properties->GetObjectField(TEXT("count"))->GetStringField(TEXT("default")), FString(TEXT("1")));
+	TestFalse("No default when none is set", Properties->GetObjectField(TEXT("class"))->HasField(TEXT("default")));
+
+	const TArray<TSharedPtr<FJsonValue>>& Required = Schema->GetArrayField(TEXT("required"));
+	if (TestEqual("One required parameter", Required.Num(), 1))
+	{
+		TestEqual("Required parameter", Required[0]->AsString(), FString(TEXT("class")));
+	}
+
+	TSharedPtr<FJsonObject> Annotations = ToolJson->GetObjectField(TEXT("annotations"));
+	TestFalse("Read-only hint", Annotations->GetBoolField(TEXT("readOnlyHint")));
+	TestFalse("Destructive hint", Annotations->GetBoolField(TEXT("destructiveHint")));
+
+	FMCPToolInfo NoParams;
+	NoParams.Name = TEXT("get_status");
+	TestFalse("No required list without required parameters", FMCPJsonRpc::ToolInfoToJson(NoParams)->GetObjectField(TEXT("inputSchema"))->HasField(TEXT("required")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPJsonRpc_ToolCallResult,
+	"UnrealClaude.MCP.JsonRpc.ToolCallResult",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPJsonRpc_ToolCallResult::RunTest(const FString& Parameters)
+{
+	TSharedPtr<FJsonObject> Data = MakeShared<FJsonObject>();
+	Data->SetNumberField(TEXT("count"), 3);
+
+	TSharedRef<FJsonObject> Success = FMCPJsonRpc::BuildToolCallResult(FMCPToolResult::Success(TEXT("Found actors"), Data));
+	TestFalse("Success is not an error", Success->GetBoolField(TEXT("isError")));
+
+	const TArray<TSharedPtr<FJsonValue>>& Content = Success->GetArrayField(TEXT("content"));
+	if (TestEqual("One content block", Content.Num(), 1))
+	{
+		TSharedPtr<FJsonObject> Text = Content[0]->AsObject();
+		TestEqual("Text block", Text->GetStringField(TEXT("type")), FString(TEXT("text")));
+		TestEqual("Message and data", Text->GetStringField(TEXT("text")), FString(TEXT("Found actors\n\n{\"count\":3}")));
+	}
+
+	TSharedRef<FJsonObject> Failure = FMCPJsonRpc::BuildToolCallResult(FMCPToolResult::Error(TEXT("No such actor")));
+	TestTrue("Failure is an error", Failure->GetBoolField(TEXT("isError")));
+	TestEqual("Error text", Failure->GetArrayField(TEXT("content"))[0]->AsObject()->GetStringField(TEXT("text")), FString(TEXT("Error: No such actor")));
+
+	// Image blobs come back inline as image content
+	TArray<uint8> Bytes = { 1, 2, 3 };
+	TSharedPtr<const FMCPBlob, ESPMode::ThreadSafe> Blob = FMCPBlobStore::Get().Publish(MoveTemp(Bytes), TEXT("image/jpeg"));
+	if (!TestTrue("Blob should be published", Blob.IsValid()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> ImageData = MakeShared<FJsonObject>();
+	ImageData->SetObjectField(TEXT("image_blob"), FMCPBlobStore::MakeHandleJson(*Blob));
+
+	const TArray<TSharedPtr<FJsonValue>>& ImageContent = FMCPJsonRpc::BuildToolCallResult(FMCPToolResult::Success(TEXT("Captured"), ImageData))->GetArrayField(TEXT("content"));
+	if (TestEqual("Text and image blocks", ImageContent.Num(), 2))
+	{
+		TSharedPtr<FJsonObject> Image = ImageContent[1]->AsObject();
+		TestEqual("Image block", Image->GetStringField(TEXT("type")), FString(TEXT("image")));
+		TestEqual("Image data", Image->GetStringField(TEXT("data")), FString(TEXT("AQID")));
+		TestEqual("Image mime type", Image->GetStringField(TEXT("mimeType")), FString(TEXT("image/jpeg")));
+	}
+
+	FMCPBlobStore::Get().Remove(Blob->Id);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,161 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Unit tests for MCP server metrics
+ * Tests histogram buckets, per-tool counters and the Prometheus text output
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "MCP/MCPMetrics.h"
+#include "MCP/MCPToolRegistry.h"
+#include "Dom/JsonObject.h"
+#include "HttpServerResponse.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPMetrics_HistogramBuckets,
+	"UnrealClaude.MCP.Metrics.HistogramBuckets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPMetrics_HistogramBuckets::RunTest(const FString& Parameters)
+{
+	FMCPLatencyHistogram Histogram;
+	Histogram.Observe(0.0005);
+	Histogram.Observe(0.001);
+	Histogram.Observe(0.2);
+	Histogram.Observe(120.0);
+
+	TestEqual("All observations should be counted", Histogram.GetCount(), static_cast<uint64>(4));
+
+	FString Out;
+	Histogram.Write(Out, TEXT("test_seconds"), TEXT("tool=\"x\""));
+
+	// Bucket bounds are inclusive and the output is cumulative
+	TestTrue("First bucket holds values up to its bound", Out.Contains(TEXT("test_seconds_bucket{tool=\"x\",le=\"0.001\"} 2\n")));
+	TestTrue("Later buckets include earlier ones", Out.Contains(TEXT("test_seconds_bucket{tool=\"x\",le=\"0.25\"} 3\n")));
+	TestTrue("Values past the last bound only land in +Inf", Out.Contains(TEXT("test_seconds_bucket{tool=\"x\",le=\"60\"} 3\n")));
+	TestTrue("+Inf holds every observation", Out.Contains(TEXT("test_seconds_bucket{tool=\"x\",le=\"+Inf\"} 4\n")));
+	TestTrue("Count line", Out.Contains(TEXT("test_seconds_count{tool=\"x\"} 4\n")));
+	TestTrue("Sum line", Out.Contains(TEXT("test_seconds_sum{tool=\"x\"} 120.201")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPMetrics_ToolCounters,
+	"UnrealClaude.MCP.Metrics.ToolCounters",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPMetrics_ToolCounters::RunTest(const FString& Parameters)
+{
+	FMCPMetrics Metrics;
+	Metrics.RecordToolCall(TEXT("spawn_actor"), true, 0.01);
+	Metrics.RecordToolCall(TEXT("spawn_actor"), false, 0.02);
+	Metrics.RecordToolCall(TEXT("move_actor"), true, 0.03);
+
+	const FMCPToolMetrics* SpawnActor = Metrics.FindTool(TEXT("spawn_actor"));
+	if (!TestNotNull("spawn_actor should have metrics", SpawnActor))
+	{
+		return false;
+	}
+
+	TestEqual("Calls", SpawnActor->Calls.load(), static_cast<uint64>(2));
+	TestEqual("Errors", SpawnActor->Errors.load(), static_cast<uint64>(1));
+	TestNull("Tools never called have no entry", Metrics.FindTool(TEXT("delete_actors")));
+
+	Metrics.BeginRequest();
+	Metrics.BeginRequest();
+	Metrics.EndRequest(200);
+	TestEqual("One request still in flight", Metrics.GetInFlightRequests(), static_cast<int64>(1));
+
+	const FString Out = Metrics.Format(nullptr);
+	TestTrue("Call counter", Out.Contains(TEXT("unrealclaude_mcp_tool_calls_total{tool=\"spawn_actor\"} 2\n")));
+	TestTrue("Error counter", Out.Contains(TEXT("unrealclaude_mcp_tool_errors_total{tool=\"spawn_actor\"} 1\n")));
+	TestTrue("Error counter for tools without errors", Out.Contains(TEXT("unrealclaude_mcp_tool_errors_total{tool=\"move_actor\"} 0\n")));
+	TestTrue("Tool latency histogram", Out.Contains(TEXT("unrealclaude_mcp_tool_duration_seconds_count{tool=\"move_actor\"} 1\n")));
+	TestTrue("In-flight gauge", Out.Contains(TEXT("unrealclaude_mcp_http_requests_in_flight 1\n")));
+	TestTrue("Responses by class", Out.Contains(TEXT("unrealclaude_mcp_http_responses_total{code=\"2xx\"} 1\n")));
+	TestTrue("Metric types are declared", Out.Contains(TEXT("# TYPE unrealclaude_mcp_game_thread_wait_seconds histogram\n")));
+	TestFalse("No task queue, no task gauges", Out.Contains(TEXT("unrealclaude_mcp_task_queue_tasks")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPMetrics_EscapeLabelValue,
+	"UnrealClaude.MCP.Metrics.EscapeLabelValue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPMetrics_EscapeLabelValue::RunTest(const FString& Parameters)
+{
+	TestEqual("Plain names are unchanged", FMCPMetrics::EscapeLabelValue(TEXT("spawn_actor")), FString(TEXT("spawn_actor")));
+	TestEqual("Quotes, backslashes and newlines are escaped",
+		FMCPMetrics::EscapeLabelValue(TEXT("a\"b\\c\nd")), FString(TEXT("a\\\"b\\\\c\\nd")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPMetrics_RegistryRecordsCalls,
+	"UnrealClaude.MCP.Metrics.RegistryRecordsCalls",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPMetrics_RegistryRecordsCalls::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+	FMCPMetrics& Metrics = FMCPMetrics::Get();
+
+	const FMCPToolMetrics* Before = Metrics.FindTool(TEXT("spawn_actor"));
+	const uint64 CallsBefore = Before ? Before->Calls.load() : 0;
+	const uint64 ErrorsBefore = Before ? Before->Errors.load() : 0;
+
+	// Missing class parameter, fails validation
+	Registry.ExecuteTool(TEXT("spawn_actor"), MakeShared<FJsonObject>());
+
+	const FMCPToolMetrics* After = Metrics.FindTool(TEXT("spawn_actor"));
+	if (!TestNotNull("Executed tool should have metrics", After))
+	{
+		return false;
+	}
+
+	TestEqual("Call should be counted", After->Calls.load(), CallsBefore + 1);
+	TestEqual("Failed call should count as an error", After->Errors.load(), ErrorsBefore + 1);
+
+	// Unknown names must not create label values
+	Registry.ExecuteTool(TEXT("nonexistent_tool_xyz"), MakeShared<FJsonObject>());
+	TestNull("Unknown tools should not be recorded", Metrics.FindTool(TEXT("nonexistent_tool_xyz")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPMetrics_ResponseContentType,
+	"UnrealClaude.MCP.Metrics.ResponseContentType",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPMetrics_ResponseContentType::RunTest(const FString& Parameters)
+{
+	TUniquePtr<FHttpServerResponse> Response = FMCPMetrics::Get().CreateResponse(nullptr);
+
+	TestEqual("Status", static_cast<int32>(Response->Code), 200);
+
+	const TArray<FString>* ContentType = Response->Headers.Find(TEXT("Content-Type"));
+	if (!TestTrue("Response should have one Content-Type", ContentType && ContentType->Num() == 1))
+	{
+		return false;
+	}
+
+	// Prometheus parses this with a strict media type parser, charset must appear exactly once
+	TestEqual("Content-Type", (*ContentType)[0], FString(TEXT("text/plain; version=0.0.4;charset=utf-8")));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
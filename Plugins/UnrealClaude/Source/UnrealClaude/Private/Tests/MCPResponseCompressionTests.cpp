@@ -0,0 +1,141 @@
+// Copyright Natali Caggiano. All Rights Reserved.
+
+/**
+ * Unit tests for MCP response compression
+ * Tests Accept-Encoding negotiation, the size threshold and gzip/deflate round trips
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Compression.h"
+#include "MCP/MCPResponseCompression.h"
+#include "HttpServerResponse.h"
+#include "UnrealClaudeConstants.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace MCPResponseCompressionTests
+{
+	EMCPContentEncoding Negotiate(const FString& AcceptEncoding)
+	{
+		const TArray<FString> Values = { AcceptEncoding };
+		return FMCPResponseCompression::Negotiate(&Values);
+	}
+
+	/** A JSON body like get_level_actors returns, repetitive enough to compress */
+	FString MakeLargeJson()
+	{
+		FString Json = TEXT("{\"success\":true,\"data\":{\"actors\":[");
+		for (int32 Index = 0; Index < 200; ++Index)
+		{
+			Json += FString::Printf(TEXT("%s{\"name\":\"StaticMeshActor_%d\",\"class\":\"StaticMeshActor\",\"location\":{\"x\":%d,\"y\":0,\"z\":0}}"),
+				Index > 0 ? TEXT(",") : TEXT(""), Index, Index * 100);
+		}
+		return Json + TEXT("]}}");
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPResponseCompression_Negotiate,
+	"UnrealClaude.MCP.Compression.Negotiate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPResponseCompression_Negotiate::RunTest(const FString& Parameters)
+{
+	using namespace MCPResponseCompressionTests;
+
+	TestTrue("No header, no compression", FMCPResponseCompression::Negotiate(nullptr) == EMCPContentEncoding::Identity);
+	TestTrue("gzip", Negotiate(TEXT("gzip")) == EMCPContentEncoding::Gzip);
+	TestTrue("deflate", Negotiate(TEXT("deflate")) == EMCPContentEncoding::Deflate);
+	TestTrue("gzip wins ties", Negotiate(TEXT("deflate, gzip")) == EMCPContentEncoding::Gzip);
+	TestTrue("Higher q-value wins", Negotiate(TEXT("gzip;q=0.5, deflate")) == EMCPContentEncoding::Deflate);
+	TestTrue("q=0 refuses a coding", Negotiate(TEXT("gzip;q=0, deflate;q=0")) == EMCPContentEncoding::Identity);
+	TestTrue("Wildcard accepts gzip", Negotiate(TEXT("*")) == EMCPContentEncoding::Gzip);
+	TestTrue("Wildcard doesn't override a refusal", Negotiate(TEXT("gzip;q=0, *")) == EMCPContentEncoding::Deflate);
+	TestTrue("Unsupported codings only", Negotiate(TEXT("br, zstd")) == EMCPContentEncoding::Identity);
+	TestTrue("Case and spacing", Negotiate(TEXT("  GZIP ; q=1.0 ")) == EMCPContentEncoding::Gzip);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPResponseCompression_RoundTrip,
+	"UnrealClaude.MCP.Compression.RoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPResponseCompression_RoundTrip::RunTest(const FString& Parameters)
+{
+	FTCHARToUTF8 Utf8(*MCPResponseCompressionTests::MakeLargeJson());
+	const TArray<uint8> Body(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+
+	const TPair<EMCPContentEncoding, FName> Formats[] = {
+		{ EMCPContentEncoding::Gzip, NAME_Gzip },
+		{ EMCPContentEncoding::Deflate, NAME_Zlib },
+	};
+
+	for (const TPair<EMCPContentEncoding, FName>& Format : Formats)
+	{
+		const FString Label = FMCPResponseCompression::GetEncodingName(Format.Key);
+
+		TArray<uint8> Compressed;
+		if (!TestTrue(Label + TEXT(" should compress"), FMCPResponseCompression::CompressBody(Body, Format.Key, Compressed)))
+		{
+			continue;
+		}
+
+		TestTrue(Label + TEXT(" should shrink the body"), Compressed.Num() < Body.Num());
+
+		TArray<uint8> Uncompressed;
+		Uncompressed.SetNumUninitialized(Body.Num());
+		TestTrue(Label + TEXT(" should uncompress"), FCompression::UncompressMemory(Format.Value, Uncompressed.GetData(), Uncompressed.Num(), Compressed.GetData(), Compressed.Num()));
+		TestTrue(Label + TEXT(" should round trip"), Uncompressed == Body);
+	}
+
+	TArray<uint8> Unused;
+	TestFalse("Identity doesn't compress", FMCPResponseCompression::CompressBody(Body, EMCPContentEncoding::Identity, Unused));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPResponseCompression_CompressResponse,
+	"UnrealClaude.MCP.Compression.CompressResponse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPResponseCompression_CompressResponse::RunTest(const FString& Parameters)
+{
+	const FString LargeJson = MCPResponseCompressionTests::MakeLargeJson();
+
+	// Small bodies stay as they are
+	TUniquePtr<FHttpServerResponse> Small = FHttpServerResponse::Create(TEXT("{\"success\":true}"), TEXT("application/json"));
+	TestFalse("Small body should not be compressed", FMCPResponseCompression::CompressResponse(*Small, EMCPContentEncoding::Gzip));
+	TestFalse("Small body has no Content-Encoding", Small->Headers.Contains(TEXT("Content-Encoding")));
+
+	// Large bodies are compressed and their ETag weakened
+	TUniquePtr<FHttpServerResponse> Large = FHttpServerResponse::Create(LargeJson, TEXT("application/json"));
+	Large->Headers.Add(TEXT("ETag"), { TEXT("\"0123456789abcdef\"") });
+	const int32 OriginalSize = Large->Body.Num();
+	TestTrue("Body is past the threshold", OriginalSize >= UnrealClaudeConstants::MCPServer::CompressionMinBytes);
+
+	TestTrue("Large body should be compressed", FMCPResponseCompression::CompressResponse(*Large, EMCPContentEncoding::Gzip));
+	TestTrue("Body should shrink", Large->Body.Num() < OriginalSize);
+	TestEqual("Content-Encoding", Large->Headers.FindRef(TEXT("Content-Encoding"))[0], FString(TEXT("gzip")));
+	TestEqual("Vary", Large->Headers.FindRef(TEXT("Vary"))[0], FString(TEXT("Accept-Encoding")));
+	TestEqual("ETag should be weak", Large->Headers.FindRef(TEXT("ETag"))[0], FString(TEXT("W/\"0123456789abcdef\"")));
+
+	// Identity keeps the body but still varies
+	TUniquePtr<FHttpServerResponse> Plain = FHttpServerResponse::Create(LargeJson, TEXT("application/json"));
+	TestFalse("Identity should not compress", FMCPResponseCompression::CompressResponse(*Plain, EMCPContentEncoding::Identity));
+	TestTrue("Identity response should still vary", Plain->Headers.Contains(TEXT("Vary")));
+
+	// Event streams are left alone
+	TUniquePtr<FHttpServerResponse> Stream = FHttpServerResponse::Create(LargeJson, TEXT("text/event-stream"));
+	TestFalse("Event streams should not be compressed", FMCPResponseCompression::CompressResponse(*Stream, EMCPContentEncoding::Gzip));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
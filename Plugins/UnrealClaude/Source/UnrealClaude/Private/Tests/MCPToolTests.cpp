@@ -14,6 +14,7 @@
 #include "MCP/Tools/MCPTool_MoveActor.h"
 #include "MCP/Tools/MCPTool_SetProperty.h"
 #include "MCP/Tools/MCPTool_GetLevelActors.h"
+#include "MCP/Tools/MCPTool_MergeStaticActors.h"
 #include "Dom/JsonObject.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -280,6 +281,71 @@ bool FMCPTool_SetProperty_MissingRequiredParams::RunTest(const FString& Paramete
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_MergeStaticActors_GetInfo,
+	"UnrealClaude.MCP.Tools.MergeStaticActors.GetInfo",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_MergeStaticActors_GetInfo::RunTest(const FString& Parameters)
+{
+	FMCPTool_MergeStaticActors Tool;
+	FMCPToolInfo Info = Tool.GetInfo();
+
+	TestEqual("Tool name should be merge_static_actors", Info.Name, TEXT("merge_static_actors"));
+	TestTrue("Description should not be empty", !Info.Description.IsEmpty());
+	TestTrue("Should be marked destructive", Info.Annotations.bDestructiveHint);
+
+	// All selection modes are optional, at least one is checked at execution
+	for (const FMCPToolParameter& Param : Info.Parameters)
+	{
+		TestFalse(FString::Printf(TEXT("%s parameter should be optional"), *Param.Name), Param.bRequired);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPTool_MergeStaticActors_InvalidParams,
+	"UnrealClaude.MCP.Tools.MergeStaticActors.InvalidParams",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPTool_MergeStaticActors_InvalidParams::RunTest(const FString& Parameters)
+{
+	FMCPTool_MergeStaticActors Tool;
+
+	// Test no selection, merging the whole level must be asked for explicitly
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+
+		FMCPToolResult Result = Tool.Execute(Params);
+		TestFalse("Should fail without any selection", Result.bSuccess);
+	}
+
+	// Test unknown mode
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("class_filter"), TEXT("StaticMeshActor"));
+		Params->SetStringField(TEXT("mode"), TEXT("nanite"));
+
+		FMCPToolResult Result = Tool.Execute(Params);
+		TestFalse("Should fail with an unknown mode", Result.bSuccess);
+		TestTrue("Error should mention the mode", Result.Message.Contains(TEXT("mode")));
+	}
+
+	// Test nothing mergeable matches
+	{
+		TSharedRef<FJsonObject> Params = MakeShared<FJsonObject>();
+		Params->SetStringField(TEXT("name_filter"), TEXT("NonExistentActor_XYZ_12345"));
+
+		FMCPToolResult Result = Tool.Execute(Params);
+		TestFalse("Should fail when fewer than 2 actors match", Result.bSuccess);
+	}
+
+	return true;
+}
+
 // ===== Class Path Validation Tests =====
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
@@ -399,6 +465,7 @@ bool FMCPToolRegistry_ToolsRegistered::RunTest(const FString& Parameters)
 	TestNotNull("move_actor should be registered", Registry.FindTool(TEXT("move_actor")));
 	TestNotNull("set_property should be registered", Registry.FindTool(TEXT("set_property")));
 	TestNotNull("get_level_actors should be registered", Registry.FindTool(TEXT("get_level_actors")));
+	TestNotNull("merge_static_actors should be registered", Registry.FindTool(TEXT("merge_static_actors")));
 	TestNotNull("run_console_command should be registered", Registry.FindTool(TEXT("run_console_command")));
 	TestNotNull("get_output_log should be registered", Registry.FindTool(TEXT("get_output_log")));
 	TestNotNull("capture_viewport should be registered", Registry.FindTool(TEXT("capture_viewport")));
@@ -431,6 +498,97 @@ bool FMCPToolRegistry_ToolNotFound::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPToolRegistry_ToolListTracksChanges,
+	"UnrealClaude.MCP.Registry.ToolListTracksChanges",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPToolRegistry_ToolListTracksChanges::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	const int32 NumTools = Registry.GetAllTools().Num();
+	const uint32 Version = Registry.GetToolsVersion();
+
+	// The cached listing must follow unregister and register
+	Registry.UnregisterTool(TEXT("spawn_actor"));
+	TestNotEqual("Unregistering should change the version", Registry.GetToolsVersion(), Version);
+	TestEqual("Unregistered tool should leave the list", Registry.GetAllTools().Num(), NumTools - 1);
+
+	const uint32 UnregisteredVersion = Registry.GetToolsVersion();
+	Registry.RegisterTool(MakeShared<FMCPTool_SpawnActor>());
+	TestNotEqual("Registering should change the version", Registry.GetToolsVersion(), UnregisteredVersion);
+	TestEqual("Registered tool should be back in the list", Registry.GetAllTools().Num(), NumTools);
+	TestTrue("spawn_actor should be listed", Registry.GetAllTools().ContainsByPredicate([](const FMCPToolInfo& Info)
+	{
+		return Info.Name == TEXT("spawn_actor");
+	}));
+
+	// Nothing changed, nothing to rebuild
+	const uint32 StableVersion = Registry.GetToolsVersion();
+	Registry.UnregisterTool(TEXT("nonexistent_tool"));
+	TestEqual("Unregistering a missing tool should keep the version", Registry.GetToolsVersion(), StableVersion);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPToolRegistry_ExecuteBatchInOrder,
+	"UnrealClaude.MCP.Registry.ExecuteBatchInOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPToolRegistry_ExecuteBatchInOrder::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	TArray<FMCPToolCall> Calls;
+	Calls.AddDefaulted(3);
+	Calls[0].ToolName = TEXT("nonexistent_tool_a");
+	Calls[1].ToolName = TEXT("nonexistent_tool_b");
+	Calls[2].ToolName = TEXT("nonexistent_tool_c");
+
+	// Without stop_on_error every call runs, in order
+	TArray<FMCPToolResult> Results = Registry.ExecuteBatch(Calls, false);
+
+	TestEqual("Every call should have a result", Results.Num(), 3);
+	if (Results.Num() != 3) return false;
+
+	TestFalse("Missing tool should fail", Results[0].bSuccess);
+	TestTrue("First result should be for the first call", Results[0].Message.Contains(TEXT("nonexistent_tool_a")));
+	TestTrue("Second result should be for the second call", Results[1].Message.Contains(TEXT("nonexistent_tool_b")));
+	TestTrue("Third result should be for the third call", Results[2].Message.Contains(TEXT("nonexistent_tool_c")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FMCPToolRegistry_ExecuteBatchStopOnError,
+	"UnrealClaude.MCP.Registry.ExecuteBatchStopOnError",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FMCPToolRegistry_ExecuteBatchStopOnError::RunTest(const FString& Parameters)
+{
+	FMCPToolRegistry Registry;
+
+	TArray<FMCPToolCall> Calls;
+	Calls.AddDefaulted(2);
+	Calls[0].ToolName = TEXT("nonexistent_tool_a");
+	Calls[1].ToolName = TEXT("nonexistent_tool_b");
+
+	// The first failure ends the batch
+	TArray<FMCPToolResult> Results = Registry.ExecuteBatch(Calls, true);
+
+	TestEqual("Only the failing call should have run", Results.Num(), 1);
+	if (Results.Num() != 1) return false;
+
+	TestFalse("Missing tool should fail", Results[0].bSuccess);
+
+	return true;
+}
+
 // ===== Animation Blueprint Tool Tests =====
 // Tests for anim_blueprint_modify tool
 
@@ -1513,6 +1671,7 @@ bool FMCPTool_CaptureViewport_GetInfo::RunTest(const FString& Parameters)
 	TestEqual("Tool name should be capture_viewport", Info.Name, TEXT("capture_viewport"));
 	TestTrue("Description should mention JPEG", Info.Description.Contains(TEXT("JPEG")));
 	TestTrue("Description should mention base64", Info.Description.Contains(TEXT("base64")));
+	TestTrue("Description should mention the blob endpoint", Info.Description.Contains(TEXT("/mcp/blob/")));
 	TestTrue("Should be read-only", Info.Annotations.bReadOnlyHint);
 
 	return true;
@@ -167,12 +167,31 @@ namespace UnrealClaudeConstants
 		/** Maximum HTTP request body size in bytes (1 MB) */
 		constexpr int32 MaxRequestBodySize = 1024 * 1024;
 
+		/** Maximum number of tool calls in a single batch request */
+		constexpr int32 MaxBatchSize = 256;
+
+		/** How long a streamed tool request waits for the next event before the client reconnects (seconds) */
+		constexpr double StreamWaitSeconds = 15.0;
+
+		/** How long a finished event stream is kept for clients to pick up the result (seconds) */
+		constexpr double StreamRetentionSeconds = 60.0;
+
+		/** Smallest response body worth compressing when the client accepts gzip or deflate (bytes) */
+		constexpr int32 CompressionMinBytes = 1024;
+
+		/** How long a published blob can be downloaded (seconds) */
+		constexpr double BlobLifetimeSeconds = 300.0;
+
+		/** Memory cap for published blobs, the oldest are evicted past it (64 MB) */
+		constexpr int64 BlobStoreMaxBytes = 64 * 1024 * 1024;
+
 		/** Expected MCP tools that should be registered at startup */
 		inline const TArray<FString> ExpectedTools = {
 			// Actor tools
 			TEXT("spawn_actor"),
 			TEXT("get_level_actors"),
 			TEXT("delete_actors"),
+			TEXT("merge_static_actors"),
 			TEXT("move_actor"),
 			TEXT("set_property"),
 			// Utility tools
@@ -59,7 +59,9 @@ public class UnrealClaude : ModuleRules
 				// Asset saving
 				"EditorScriptingUtilities",
 				// Enhanced Input
-				"EnhancedInput"
+				"EnhancedInput",
+				// Actor merging
+				"MeshMergeUtilities"
 			}
 		);
 
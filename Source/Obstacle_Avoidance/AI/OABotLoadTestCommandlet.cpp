@@ -0,0 +1,279 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OABotLoadTestCommandlet.h"
+#include "OABotRunnerController.h"
+#include "Obstacle_AvoidanceCharacter.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerStart.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "Obstacle_Avoidance.h"
+
+namespace OABotLoadTest
+{
+	/** Distance between bots in the starting grid */
+	constexpr float BotSpacing = 120.0f;
+
+	/** Bots per row in the starting grid */
+	constexpr int32 BotsPerRow = 4;
+
+	/** Returns the value at the provided percentile of sorted frame times */
+	float GetPercentile(const TArray<float>& SortedTimes, float Percentile)
+	{
+		const int32 Index = FMath::Clamp(FMath::CeilToInt32(Percentile * SortedTimes.Num()) - 1, 0, SortedTimes.Num() - 1);
+		return SortedTimes[Index];
+	}
+}
+
+UOABotLoadTestCommandlet::UOABotLoadTestCommandlet()
+{
+	// we run a full game world
+	IsClient = true;
+	IsServer = true;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOABotLoadTestCommandlet::Main(const FString& Params)
+{
+	FString MapList = TEXT("Lvl_ObstacleLevel1,Lvl_ObstacleLevel2");
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("LoadTest") / FString::Printf(TEXT("BotLoadTest_%s.csv"), *FDateTime::Now().ToString());
+	int32 NumBots = 16;
+	float Duration = 120.0f;
+	float FrameRate = 60.0f;
+
+	FParse::Value(*Params, TEXT("Maps="), MapList);
+	FParse::Value(*Params, TEXT("Out="), OutputPath);
+	FParse::Value(*Params, TEXT("Bots="), NumBots);
+	FParse::Value(*Params, TEXT("Duration="), Duration);
+	FParse::Value(*Params, TEXT("FPS="), FrameRate);
+
+	NumBots = FMath::Clamp(NumBots, 1, 1024);
+	Duration = FMath::Clamp(Duration, 1.0f, 3600.0f);
+	FrameRate = FMath::Clamp(FrameRate, 1.0f, 240.0f);
+
+	TArray<FString> MapNames;
+	MapList.ParseIntoArray(MapNames, TEXT(","));
+
+	if (MapNames.IsEmpty())
+	{
+		UE_LOG(LogObstacle_Avoidance, Error, TEXT("No maps to run"));
+		return 1;
+	}
+
+	// the levels run in a standalone game instance, same as a packaged game
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->AddToRoot();
+	GameInstance->InitializeStandalone();
+
+	FString Csv = TEXT("Map,Bots,SimSeconds,Frames,AvgFrameMs,P50FrameMs,P95FrameMs,P99FrameMs,MaxFrameMs,ObstacleOverlaps,OverlapsPerMinute,Deaths,DeathsPerMinute,Finishes\n");
+	int32 NumFailed = 0;
+
+	for (const FString& MapName : MapNames)
+	{
+		FOABotLoadTestResult Result;
+
+		if (RunMap(GameInstance, MapName.TrimStartAndEnd(), NumBots, Duration, FrameRate, Result))
+		{
+			ReportResult(Result, Csv);
+		}
+		else
+		{
+			++NumFailed;
+		}
+	}
+
+	// tear down the last level and the game instance
+	UWorld* World = GameInstance->GetWorld();
+	GameInstance->Shutdown();
+
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	GameInstance->RemoveFromRoot();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutputPath), true);
+
+	if (FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogObstacle_Avoidance, Display, TEXT("Wrote %s"), *OutputPath);
+	}
+	else
+	{
+		UE_LOG(LogObstacle_Avoidance, Error, TEXT("Couldn't write %s"), *OutputPath);
+		++NumFailed;
+	}
+
+	return NumFailed > 0 ? 1 : 0;
+}
+
+bool UOABotLoadTestCommandlet::RunMap(UGameInstance* GameInstance, const FString& MapName, int32 NumBots, float Duration, float FrameRate, FOABotLoadTestResult& OutResult) const
+{
+	// short names are levels in the project's maps folder
+	const FString MapPath = MapName.StartsWith(TEXT("/")) ? MapName : FString::Printf(TEXT("/Game/Maps/%s"), *MapName);
+
+	if (!FPackageName::DoesPackageExist(MapPath))
+	{
+		UE_LOG(LogObstacle_Avoidance, Error, TEXT("Map %s not found"), *MapPath);
+		return false;
+	}
+
+	FWorldContext& WorldContext = *GameInstance->GetWorldContext();
+	FString Error;
+
+	if (!GEngine->LoadMap(WorldContext, FURL(*MapPath), nullptr, Error))
+	{
+		UE_LOG(LogObstacle_Avoidance, Error, TEXT("Couldn't load %s: %s"), *MapPath, *Error);
+		return false;
+	}
+
+	UWorld* World = WorldContext.World();
+
+	OutResult.MapName = FPackageName::GetShortName(MapPath);
+	OutResult.NumBots = SpawnBots(World, NumBots);
+
+	if (OutResult.NumBots == 0)
+	{
+		UE_LOG(LogObstacle_Avoidance, Error, TEXT("%s: no bots spawned"), *OutResult.MapName);
+		return false;
+	}
+
+	UE_LOG(LogObstacle_Avoidance, Display, TEXT("%s: running %d bots for %.0fs at %.0f fps"), *OutResult.MapName, OutResult.NumBots, Duration, FrameRate);
+
+	// tick at a fixed rate so the simulated time doesn't depend on how fast this machine is
+	const float DeltaSeconds = 1.0f / FrameRate;
+	const int32 NumFrames = FMath::CeilToInt32(Duration * FrameRate);
+
+	OutResult.FrameTimesMs.Reserve(NumFrames);
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+
+		OutResult.FrameTimesMs.Add(static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0));
+		++GFrameCounter;
+	}
+
+	OutResult.SimulatedSeconds = NumFrames * DeltaSeconds;
+
+	for (TActorIterator<AOABotRunnerController> It(World); It; ++It)
+	{
+		OutResult.NumObstacleOverlaps += It->GetNumObstacleOverlaps();
+		OutResult.NumDeaths += It->GetNumDeaths();
+		OutResult.NumFinishes += It->GetNumFinishes();
+	}
+
+	return true;
+}
+
+int32 UOABotLoadTestCommandlet::SpawnBots(UWorld* World, int32 NumBots) const
+{
+	const AGameModeBase* GameMode = World->GetAuthGameMode();
+	UClass* PawnClass = GameMode ? GameMode->DefaultPawnClass.Get() : nullptr;
+
+	if (!PawnClass || !PawnClass->IsChildOf<AObstacle_AvoidanceCharacter>())
+	{
+		UE_LOG(LogObstacle_Avoidance, Error, TEXT("%s: the game mode's default pawn isn't an obstacle course character"), *World->GetMapName());
+		return 0;
+	}
+
+	FTransform StartTransform = FTransform::Identity;
+	TActorIterator<APlayerStart> PlayerStart(World);
+
+	if (PlayerStart)
+	{
+		StartTransform = PlayerStart->GetActorTransform();
+		StartTransform.SetScale3D(FVector::OneVector);
+	}
+	else
+	{
+		UE_LOG(LogObstacle_Avoidance, Warning, TEXT("%s: no player start, spawning bots at the origin"), *World->GetMapName());
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	int32 NumSpawned = 0;
+
+	for (int32 i = 0; i < NumBots; ++i)
+	{
+		// line the bots up in rows behind the player start
+		const int32 Row = i / OABotLoadTest::BotsPerRow;
+		const float Column = (i % OABotLoadTest::BotsPerRow) - (OABotLoadTest::BotsPerRow - 1) * 0.5f;
+		const FVector Offset(-Row * OABotLoadTest::BotSpacing, Column * OABotLoadTest::BotSpacing, 0.0f);
+
+		FTransform BotTransform = StartTransform;
+		BotTransform.SetLocation(StartTransform.TransformPosition(Offset));
+
+		AObstacle_AvoidanceCharacter* Runner = World->SpawnActor<AObstacle_AvoidanceCharacter>(PawnClass, BotTransform, SpawnParams);
+
+		if (!Runner)
+		{
+			continue;
+		}
+
+		AOABotRunnerController* Bot = World->SpawnActor<AOABotRunnerController>(SpawnParams);
+
+		// an unpossessed runner would just stand there, so don't count it
+		if (!Bot)
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("%s: failed to spawn a controller for bot %d"), *World->GetMapName(), i);
+			Runner->Destroy();
+			continue;
+		}
+
+		Bot->SetRandomSeed(i);
+		Bot->Possess(Runner);
+
+		++NumSpawned;
+	}
+
+	return NumSpawned;
+}
+
+void UOABotLoadTestCommandlet::ReportResult(const FOABotLoadTestResult& Result, FString& InOutCsv) const
+{
+	TArray<float> SortedTimes = Result.FrameTimesMs;
+	SortedTimes.Sort();
+
+	float TotalMs = 0.0f;
+
+	for (float Time : SortedTimes)
+	{
+		TotalMs += Time;
+	}
+
+	const float AverageMs = SortedTimes.IsEmpty() ? 0.0f : TotalMs / SortedTimes.Num();
+	const float P50Ms = SortedTimes.IsEmpty() ? 0.0f : OABotLoadTest::GetPercentile(SortedTimes, 0.5f);
+	const float P95Ms = SortedTimes.IsEmpty() ? 0.0f : OABotLoadTest::GetPercentile(SortedTimes, 0.95f);
+	const float P99Ms = SortedTimes.IsEmpty() ? 0.0f : OABotLoadTest::GetPercentile(SortedTimes, 0.99f);
+	const float MaxMs = SortedTimes.IsEmpty() ? 0.0f : SortedTimes.Last();
+
+	const float Minutes = FMath::Max(Result.SimulatedSeconds / 60.0f, UE_KINDA_SMALL_NUMBER);
+	const float OverlapsPerMinute = Result.NumObstacleOverlaps / Minutes;
+	const float DeathsPerMinute = Result.NumDeaths / Minutes;
+
+	UE_LOG(LogObstacle_Avoidance, Display, TEXT("%s: %d bots, %.0fs simulated over %d frames"), *Result.MapName, Result.NumBots, Result.SimulatedSeconds, SortedTimes.Num());
+	UE_LOG(LogObstacle_Avoidance, Display, TEXT("    frame ms    avg %.2f  p50 %.2f  p95 %.2f  p99 %.2f  max %.2f"), AverageMs, P50Ms, P95Ms, P99Ms, MaxMs);
+	UE_LOG(LogObstacle_Avoidance, Display, TEXT("    overlaps    %d (%.1f/min)"), Result.NumObstacleOverlaps, OverlapsPerMinute);
+	UE_LOG(LogObstacle_Avoidance, Display, TEXT("    deaths      %d (%.1f/min)"), Result.NumDeaths, DeathsPerMinute);
+	UE_LOG(LogObstacle_Avoidance, Display, TEXT("    finishes    %d"), Result.NumFinishes);
+
+	InOutCsv += FString::Printf(TEXT("%s,%d,%.1f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%.2f,%d,%.2f,%d\n"),
+		*Result.MapName, Result.NumBots, Result.SimulatedSeconds, SortedTimes.Num(),
+		AverageMs, P50Ms, P95Ms, P99Ms, MaxMs,
+		Result.NumObstacleOverlaps, OverlapsPerMinute, Result.NumDeaths, DeathsPerMinute, Result.NumFinishes);
+}
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OABotLoadTestCommandlet.generated.h"
+
+class UGameInstance;
+
+/**
+ *  Results of a bot load test run on a single level
+ */
+struct FOABotLoadTestResult
+{
+	/** Level that was run */
+	FString MapName;
+
+	/** Number of bots that ran the course */
+	int32 NumBots = 0;
+
+	/** Simulated game time, in seconds */
+	float SimulatedSeconds = 0.0f;
+
+	/** Game thread time of each frame, in milliseconds */
+	TArray<float> FrameTimesMs;
+
+	/** Times bots started overlapping an obstacle */
+	int32 NumObstacleOverlaps = 0;
+
+	/** Bot deaths */
+	int32 NumDeaths = 0;
+
+	/** Times bots reached the goal */
+	int32 NumFinishes = 0;
+};
+
+/**
+ *  Puts obstacle levels under load with bot runners, no players or rendering needed.
+ *  Loads each level as a game world, spawns AOABotRunnerController driven runners at the player start,
+ *  ticks the world at a fixed frame rate for the requested time and reports game thread frame times,
+ *  obstacle overlaps and deaths per minute to the log and to a CSV in Saved/LoadTest.
+ *
+ *  Usage: UnrealEditor-Cmd Obstacle_Avoidance.uproject -run=OABotLoadTest -nullrhi [-Maps=Lvl_ObstacleLevel1,Lvl_ObstacleLevel2] [-Bots=16] [-Duration=120] [-FPS=60] [-Out=<csv path>]
+ */
+UCLASS()
+class UOABotLoadTestCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	UOABotLoadTestCommandlet();
+
+	/** Runs the commandlet */
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+
+	/** Loads a level, runs the bots on it and fills in the results. Returns false if the level couldn't be run */
+	bool RunMap(UGameInstance* GameInstance, const FString& MapName, int32 NumBots, float Duration, float FrameRate, FOABotLoadTestResult& OutResult) const;
+
+	/** Spawns the bot runners around the level's player start. Returns the number spawned */
+	int32 SpawnBots(UWorld* World, int32 NumBots) const;
+
+	/** Logs the results and appends them to the CSV */
+	void ReportResult(const FOABotLoadTestResult& Result, FString& InOutCsv) const;
+};
@@ -0,0 +1,229 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OABotRunnerController.h"
+#include "Obstacle_AvoidanceCharacter.h"
+#include "OAGoalVolume.h"
+#include "OACannonball.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Obstacle_Avoidance.h"
+
+AOABotRunnerController::AOABotRunnerController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	// ensure we're attached to the possessed character
+	bAttachToPawn = true;
+}
+
+void AOABotRunnerController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	TActorIterator<AOAGoalVolume> It(GetWorld());
+
+	if (It)
+	{
+		Goal = *It;
+	}
+	else
+	{
+		UE_LOG(LogObstacle_Avoidance, Warning, TEXT("%s: no goal volume in the level, running straight ahead."), *GetName());
+	}
+
+	InPawn->OnActorBeginOverlap.AddDynamic(this, &AOABotRunnerController::OnPawnBeginOverlap);
+
+	// spread the first decisions so bots spawned together don't all probe on the same frame
+	DecisionTimeLeft = Random.FRandRange(0.0f, DecisionInterval);
+	WanderOffset = Random.FRandRange(-WanderDistance, WanderDistance);
+}
+
+void AOABotRunnerController::OnUnPossess()
+{
+	if (APawn* CurrentPawn = GetPawn())
+	{
+		CurrentPawn->OnActorBeginOverlap.RemoveDynamic(this, &AOABotRunnerController::OnPawnBeginOverlap);
+	}
+
+	Super::OnUnPossess();
+}
+
+void AOABotRunnerController::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	AObstacle_AvoidanceCharacter* Runner = Cast<AObstacle_AvoidanceCharacter>(GetPawn());
+
+	if (!Runner)
+	{
+		return;
+	}
+
+	// count deaths, and get going again if nothing respawns us
+	if (Runner->IsDead())
+	{
+		if (!bWasDead)
+		{
+			++NumDeaths;
+			DeadTime = 0.0f;
+		}
+
+		bWasDead = true;
+		DeadTime += DeltaTime;
+
+		if (DeadTime > RespawnTimeout)
+		{
+			Runner->Respawn();
+		}
+
+		return;
+	}
+
+	bWasDead = false;
+
+	// the goal volume only stops players, so we check for the finish ourselves and run the course again
+	if (Goal.IsValid() && FVector::DistSquared2D(Goal->GetActorLocation(), Runner->GetActorLocation()) < FMath::Square(FinishDistance))
+	{
+		++NumFinishes;
+		Runner->Respawn();
+		WanderOffset = Random.FRandRange(-WanderDistance, WanderDistance);
+		return;
+	}
+
+	if (JumpTimeLeft > 0.0f)
+	{
+		JumpTimeLeft -= DeltaTime;
+
+		if (JumpTimeLeft <= 0.0f)
+		{
+			Runner->DoJumpEnd();
+		}
+	}
+
+	Steer(Runner);
+
+	DecisionTimeLeft -= DeltaTime;
+
+	if (DecisionTimeLeft <= 0.0f)
+	{
+		DecisionTimeLeft += DecisionInterval;
+		Decide(Runner);
+	}
+}
+
+void AOABotRunnerController::Steer(AObstacle_AvoidanceCharacter* Runner)
+{
+	FVector Direction = Runner->GetActorForwardVector();
+
+	if (Goal.IsValid())
+	{
+		const FVector ToGoal = Goal->GetActorLocation() - Runner->GetActorLocation();
+		const FVector GoalDirection = ToGoal.GetSafeNormal2D();
+		const FVector Side(-GoalDirection.Y, GoalDirection.X, 0.0f);
+
+		// aim at a point beside the goal, the offset fades out over the last 10m so we still finish
+		const float Fade = FMath::Min(1.0f, ToGoal.Size2D() / 1000.0f);
+		const FVector Target = Goal->GetActorLocation() + Side * WanderOffset * Fade;
+		Direction = (Target - Runner->GetActorLocation()).GetSafeNormal2D();
+	}
+
+	// the character moves relative to the control rotation
+	SetControlRotation(Direction.Rotation());
+	Runner->DoMove(0.0f, 1.0f);
+}
+
+void AOABotRunnerController::Decide(AObstacle_AvoidanceCharacter* Runner)
+{
+	if (!Runner->GetCharacterMovement()->IsMovingOnGround() || Runner->GetIsDashing() || Runner->GetIsSliding())
+	{
+		return;
+	}
+
+	const float HalfHeight = Runner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+
+	const bool bBlockedLow = IsBlockedAhead(Runner, JumpProbeHeight);
+	const bool bBlockedHigh = IsBlockedAhead(Runner, HalfHeight * 2.0f - JumpProbeHeight);
+
+	// something overhead with room underneath, get under it
+	if (bBlockedHigh && !bBlockedLow)
+	{
+		Runner->DoSlideStart();
+		return;
+	}
+
+	// something low in the way, or nothing to run on
+	if ((bBlockedLow && !bBlockedHigh) || !HasGroundAhead(Runner))
+	{
+		Runner->DoJumpStart();
+		JumpTimeLeft = JumpHoldTime;
+		return;
+	}
+
+	if (IsCannonballIncoming(Runner))
+	{
+		Runner->DoDashStart();
+	}
+}
+
+bool AOABotRunnerController::IsBlockedAhead(const AObstacle_AvoidanceCharacter* Runner, float Height) const
+{
+	const float HalfHeight = Runner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	const FVector Start = Runner->GetActorLocation() + FVector(0.0f, 0.0f, Height - HalfHeight);
+	const FVector End = Start + Runner->GetActorForwardVector() * LookAheadDistance;
+
+	// obstacle triggers are query only, so look for objects rather than blocking hits
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(OABotProbe), false, Runner);
+	FHitResult Hit;
+
+	return GetWorld()->LineTraceSingleByObjectType(Hit, Start, End, ObjectParams, QueryParams);
+}
+
+bool AOABotRunnerController::HasGroundAhead(const AObstacle_AvoidanceCharacter* Runner) const
+{
+	const float HalfHeight = Runner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	const FVector Start = Runner->GetActorLocation() + Runner->GetActorForwardVector() * LookAheadDistance;
+	const FVector End = Start - FVector(0.0f, 0.0f, HalfHeight + MaxDropDepth);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(OABotGround), false, Runner);
+	FHitResult Hit;
+
+	return GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility, QueryParams);
+}
+
+bool AOABotRunnerController::IsCannonballIncoming(const AObstacle_AvoidanceCharacter* Runner) const
+{
+	const FVector RunnerLocation = Runner->GetActorLocation();
+
+	for (TActorIterator<AOACannonball> It(GetWorld()); It; ++It)
+	{
+		const FVector ToRunner = RunnerLocation - It->GetActorLocation();
+
+		if (ToRunner.SizeSquared() > FMath::Square(DashThreatDistance))
+		{
+			continue;
+		}
+
+		// heading roughly our way
+		if (FVector::DotProduct(It->GetVelocity().GetSafeNormal(), ToRunner.GetSafeNormal()) > 0.7f)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void AOABotRunnerController::OnPawnBeginOverlap(AActor* OverlappedActor, AActor* OtherActor)
+{
+	// other runners don't count
+	if (OtherActor && !OtherActor->IsA<APawn>() && OtherActor != Goal.Get())
+	{
+		++NumObstacleOverlaps;
+	}
+}
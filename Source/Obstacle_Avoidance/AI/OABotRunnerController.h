@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "OABotRunnerController.generated.h"
+
+class AObstacle_AvoidanceCharacter;
+
+/**
+ * Bot that runs the obstacle course for load testing.
+ * Steers straight at the level's AOAGoalVolume with some wander so bots spread out, and decides
+ * between jumping, sliding and dashing from short probes ahead of the runner, through the same
+ * character actions the player input uses. Needs no navmesh or rendering, so it runs headless.
+ * Counts its deaths, obstacle overlaps and finishes, and restarts the course when it finishes
+ * or stays dead too long.
+ */
+UCLASS()
+class AOABotRunnerController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	AOABotRunnerController();
+
+protected:
+
+	/** Time between jump, slide and dash decisions */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "s"))
+	float DecisionInterval = 0.1f;
+
+	/** How far ahead of the runner to probe for obstacles and gaps */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "cm"))
+	float LookAheadDistance = 250.0f;
+
+	/** Height above the feet of the probe for obstacles to jump over */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "cm"))
+	float JumpProbeHeight = 40.0f;
+
+	/** Depth below the feet the ground ahead may drop before it counts as a gap to jump */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "cm"))
+	float MaxDropDepth = 150.0f;
+
+	/** Dash away when a cannonball heading at the runner is closer than this */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "cm"))
+	float DashThreatDistance = 600.0f;
+
+	/** Time the jump input is held */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "s"))
+	float JumpHoldTime = 0.2f;
+
+	/** Max sideways offset from the straight line to the goal */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "cm"))
+	float WanderDistance = 150.0f;
+
+	/** Respawn the runner ourselves if the death montage hasn't done it by then */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "s"))
+	float RespawnTimeout = 5.0f;
+
+	/** Distance from the goal that counts as finishing the course */
+	UPROPERTY(EditAnywhere, Category = "Bot", meta = (ClampMin = "0.0", Units = "cm"))
+	float FinishDistance = 150.0f;
+
+	/** Goal the bot runs to */
+	TWeakObjectPtr<AActor> Goal;
+
+	/** Random stream for wander, seeded per bot so runs are repeatable */
+	FRandomStream Random;
+
+	/** Current sideways offset from the straight line to the goal */
+	float WanderOffset = 0.0f;
+
+	/** Time left until the next decision */
+	float DecisionTimeLeft = 0.0f;
+
+	/** Time left until the jump input is released */
+	float JumpTimeLeft = 0.0f;
+
+	/** Time the runner has been dead */
+	float DeadTime = 0.0f;
+
+	/** True if the runner was dead last frame */
+	bool bWasDead = false;
+
+	/** Number of times the runner died */
+	int32 NumDeaths = 0;
+
+	/** Number of times the runner started overlapping an obstacle */
+	int32 NumObstacleOverlaps = 0;
+
+	/** Number of times the runner reached the goal */
+	int32 NumFinishes = 0;
+
+public:
+
+	/** Steers the runner and makes decisions */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Seeds the wander */
+	void SetRandomSeed(int32 Seed) { Random.Initialize(Seed); }
+
+	/** Returns the number of times the runner died */
+	int32 GetNumDeaths() const { return NumDeaths; }
+
+	/** Returns the number of times the runner started overlapping an obstacle */
+	int32 GetNumObstacleOverlaps() const { return NumObstacleOverlaps; }
+
+	/** Returns the number of times the runner reached the goal */
+	int32 GetNumFinishes() const { return NumFinishes; }
+
+protected:
+
+	/** Finds the goal and starts counting overlaps */
+	virtual void OnPossess(APawn* InPawn) override;
+
+	/** Stops counting overlaps */
+	virtual void OnUnPossess() override;
+
+	/** Moves the runner toward the goal */
+	void Steer(AObstacle_AvoidanceCharacter* Runner);
+
+	/** Jumps, slides or dashes if something's coming up */
+	void Decide(AObstacle_AvoidanceCharacter* Runner);
+
+	/** Returns true if something blocks the way ahead at the provided height above the feet */
+	bool IsBlockedAhead(const AObstacle_AvoidanceCharacter* Runner, float Height) const;
+
+	/** Returns true if there's ground to land on ahead */
+	bool HasGroundAhead(const AObstacle_AvoidanceCharacter* Runner) const;
+
+	/** Returns true if a cannonball is about to hit the runner */
+	bool IsCannonballIncoming(const AObstacle_AvoidanceCharacter* Runner) const;
+
+	/** Counts obstacle overlaps */
+	UFUNCTION()
+	void OnPawnBeginOverlap(AActor* OverlappedActor, AActor* OtherActor);
+};
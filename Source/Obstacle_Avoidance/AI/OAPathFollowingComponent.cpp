@@ -0,0 +1,166 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAPathFollowingComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "OAMovingPlatform.h"
+#include "OANavLinkCache.h"
+
+void UOAPathFollowingComponent::SetMoveSegment(int32 SegmentStartIndex)
+{
+	Super::SetMoveSegment(SegmentStartIndex);
+
+	Platform.Reset();
+	SetPlatformState(EOAPlatformLinkState::None);
+
+	if (!Path.IsValid() || !Path->GetPathPoints().IsValidIndex(SegmentStartIndex + 1))
+	{
+		return;
+	}
+
+	// links show up in the path as a segment between their two ends
+	const FVector SegmentStart = Path->GetPathPoints()[SegmentStartIndex].Location;
+	const FVector SegmentEnd = Path->GetPathPoints()[SegmentStartIndex + 1].Location;
+
+	const FOANavLinkData* Link = AOANavLinkCache::FindLinkInWorld(GetWorld(), SegmentStart, SegmentEnd);
+
+	if (!Link || Link->Type != EOANavLinkType::MovingPlatform)
+	{
+		return;
+	}
+
+	AOAMovingPlatform* LinkPlatform = Cast<AOAMovingPlatform>(Link->Source.Get());
+
+	if (!LinkPlatform)
+	{
+		return;
+	}
+
+	// board at whichever end of the platform path is on our side of the link
+	const float DistanceToPositiveEnd = FVector::DistSquared(SegmentStart, LinkPlatform->GetEndLocation(1.0f));
+	const float DistanceToNegativeEnd = FVector::DistSquared(SegmentStart, LinkPlatform->GetEndLocation(-1.0f));
+
+	Platform = LinkPlatform;
+	BoardingEndSign = DistanceToPositiveEnd < DistanceToNegativeEnd ? 1.0f : -1.0f;
+	SetPlatformState(EOAPlatformLinkState::WaitingForPlatform);
+}
+
+void UOAPathFollowingComponent::FollowPathSegment(float DeltaTime)
+{
+	if (PlatformState == EOAPlatformLinkState::None)
+	{
+		Super::FollowPathSegment(DeltaTime);
+		return;
+	}
+
+	AOAMovingPlatform* CurrentPlatform = Platform.Get();
+	const AController* Controller = Cast<AController>(GetOwner());
+	ACharacter* Character = Controller ? Cast<ACharacter>(Controller->GetPawn()) : nullptr;
+
+	// fall back to a plain path segment if we lost the platform or the pawn can't ride one
+	if (!CurrentPlatform || !Character)
+	{
+		SetPlatformState(EOAPlatformLinkState::None);
+		Super::FollowPathSegment(DeltaTime);
+		return;
+	}
+
+	PlatformStateTime += DeltaTime;
+
+	const FVector ToPlatform = (CurrentPlatform->GetActorLocation() - Character->GetActorLocation()).GetSafeNormal2D();
+	const bool bOnPlatform = Character->GetMovementBase() == CurrentPlatform->GetMesh();
+
+	switch (PlatformState)
+	{
+	case EOAPlatformLinkState::WaitingForPlatform:
+
+		// stand still at the link start until the platform is timed to meet us
+		if (ShouldBoard(Character, CurrentPlatform))
+		{
+			SetPlatformState(EOAPlatformLinkState::Boarding);
+		}
+		break;
+
+	case EOAPlatformLinkState::Boarding:
+
+		if (bOnPlatform)
+		{
+			SetPlatformState(EOAPlatformLinkState::Riding);
+		}
+		else if (PlatformStateTime > BoardingTimeout)
+		{
+			// missed it, wait for the next pass
+			SetPlatformState(EOAPlatformLinkState::WaitingForPlatform);
+		}
+		else
+		{
+			Character->AddMovementInput(ToPlatform);
+		}
+		break;
+
+	case EOAPlatformLinkState::Riding:
+
+		// step off toward the link end once the platform gets to the far side
+		if (CurrentPlatform->GetTimeToReachEnd(-BoardingEndSign) <= ExitLeadTime)
+		{
+			SetPlatformState(EOAPlatformLinkState::None);
+			Super::FollowPathSegment(DeltaTime);
+		}
+		else if (FVector::DistSquared2D(CurrentPlatform->GetActorLocation(), Character->GetActorLocation()) > FMath::Square(RideCenterTolerance))
+		{
+			Character->AddMovementInput(ToPlatform);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool UOAPathFollowingComponent::UpdateBlockDetection()
+{
+	// waiting on or for a platform is expected to keep us in place
+	if (PlatformState != EOAPlatformLinkState::None)
+	{
+		ResetBlockDetectionData();
+		return false;
+	}
+
+	return Super::UpdateBlockDetection();
+}
+
+void UOAPathFollowingComponent::OnPathFinished(const FPathFollowingResult& Result)
+{
+	Platform.Reset();
+	SetPlatformState(EOAPlatformLinkState::None);
+
+	Super::OnPathFinished(Result);
+}
+
+void UOAPathFollowingComponent::SetPlatformState(EOAPlatformLinkState NewState)
+{
+	PlatformState = NewState;
+	PlatformStateTime = 0.0f;
+}
+
+bool UOAPathFollowingComponent::ShouldBoard(const APawn* Pawn, const AOAMovingPlatform* CurrentPlatform) const
+{
+	const UPawnMovementComponent* MovementComponent = Pawn->GetMovementComponent();
+	const float MaxSpeed = MovementComponent ? MovementComponent->GetMaxSpeed() : 0.0f;
+
+	if (MaxSpeed <= 0.0f)
+	{
+		return false;
+	}
+
+	// time for us to walk to the near edge of the platform once it's at our end
+	const FVector Axis = CurrentPlatform->GetMoveAxis();
+	const float HalfLength = FMath::Abs(FVector::DotProduct(CurrentPlatform->GetMesh()->Bounds.BoxExtent, Axis));
+	const FVector BoardingEdge = CurrentPlatform->GetEndLocation(BoardingEndSign) + Axis * BoardingEndSign * HalfLength;
+	const float WalkTime = FVector::Dist2D(Pawn->GetActorLocation(), BoardingEdge) / MaxSpeed;
+
+	// leave so we get there just as the platform does, it turns around right away
+	return CurrentPlatform->GetTimeToReachEnd(BoardingEndSign) <= WalkTime + BoardingTimeMargin;
+}
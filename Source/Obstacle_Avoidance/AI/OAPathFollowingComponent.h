@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "OAPathFollowingComponent.generated.h"
+
+class AOAMovingPlatform;
+
+/** Progress through a moving platform nav link */
+enum class EOAPlatformLinkState : uint8
+{
+	None,
+	WaitingForPlatform,
+	Boarding,
+	Riding
+};
+
+/**
+ * Path following for obstacle course runners.
+ * Moving platforms are crossed through prebuilt AOANavLinkCache links instead of a navmesh that follows them.
+ * When a path segment is a platform link, the runner waits at the link start, times its boarding from the
+ * platform's known motion, rides it across and walks off toward the link end.
+ */
+UCLASS()
+class UOAPathFollowingComponent : public UPathFollowingComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Start boarding when the platform arrives at most this long after the runner would reach it */
+	UPROPERTY(EditAnywhere, Category = "Moving Platforms", meta = (ClampMin = "0.0", Units = "s"))
+	float BoardingTimeMargin = 0.1f;
+
+	/** Give up boarding and wait for the next pass if the runner isn't on the platform by then */
+	UPROPERTY(EditAnywhere, Category = "Moving Platforms", meta = (ClampMin = "0.0", Units = "s"))
+	float BoardingTimeout = 1.5f;
+
+	/** Step off when the platform is this close in time to the far end of its path */
+	UPROPERTY(EditAnywhere, Category = "Moving Platforms", meta = (ClampMin = "0.0", Units = "s"))
+	float ExitLeadTime = 0.1f;
+
+	/** While riding, steer back toward the platform center when further than this from it */
+	UPROPERTY(EditAnywhere, Category = "Moving Platforms", meta = (ClampMin = "0.0", Units = "cm"))
+	float RideCenterTolerance = 30.0f;
+
+	/** Platform the current path segment crosses */
+	TWeakObjectPtr<AOAMovingPlatform> Platform;
+
+	/** Platform path end (+1 or -1) the runner boards at */
+	float BoardingEndSign = 1.0f;
+
+	/** Current progress through the platform link */
+	EOAPlatformLinkState PlatformState = EOAPlatformLinkState::None;
+
+	/** Time spent in the current platform link state */
+	float PlatformStateTime = 0.0f;
+
+public:
+
+	/** Returns the current progress through a moving platform link */
+	EOAPlatformLinkState GetPlatformState() const { return PlatformState; }
+
+protected:
+
+	/** Checks whether the new segment crosses a moving platform link */
+	virtual void SetMoveSegment(int32 SegmentStartIndex) override;
+
+	/** Waits for, boards and rides moving platforms, and follows the path normally otherwise */
+	virtual void FollowPathSegment(float DeltaTime) override;
+
+	/** Standing still on or next to a platform doesn't count as being blocked */
+	virtual bool UpdateBlockDetection() override;
+
+	/** Clears the platform state */
+	virtual void OnPathFinished(const FPathFollowingResult& Result) override;
+
+	/** Switches to a new platform link state */
+	void SetPlatformState(EOAPlatformLinkState NewState);
+
+	/** Returns true if the runner should walk onto the platform now to meet it at the boarding end */
+	bool ShouldBoard(const APawn* Pawn, const AOAMovingPlatform* CurrentPlatform) const;
+};
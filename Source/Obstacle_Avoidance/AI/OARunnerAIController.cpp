@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OARunnerAIController.h"
+#include "OAPathFollowingComponent.h"
+#include "OAGoalVolume.h"
+#include "EngineUtils.h"
+#include "TimerManager.h"
+#include "Obstacle_Avoidance.h"
+
+AOARunnerAIController::AOARunnerAIController(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UOAPathFollowingComponent>(TEXT("PathFollowingComponent")))
+{
+	// ensure we're attached to the possessed character
+	bAttachToPawn = true;
+}
+
+void AOARunnerAIController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	// give the pawn a frame to settle on the navmesh
+	GetWorldTimerManager().SetTimerForNextTick(this, &AOARunnerAIController::MoveToGoal);
+}
+
+void AOARunnerAIController::OnUnPossess()
+{
+	GetWorldTimerManager().ClearTimer(RetryTimer);
+
+	Super::OnUnPossess();
+}
+
+void AOARunnerAIController::OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult& Result)
+{
+	Super::OnMoveCompleted(RequestID, Result);
+
+	// keep trying until we get there
+	if (!Result.IsSuccess() && GetPawn())
+	{
+		GetWorldTimerManager().SetTimer(RetryTimer, this, &AOARunnerAIController::MoveToGoal, RetryDelay, false);
+	}
+}
+
+void AOARunnerAIController::MoveToGoal()
+{
+	if (!GetPawn())
+	{
+		return;
+	}
+
+	TActorIterator<AOAGoalVolume> It(GetWorld());
+
+	if (!It)
+	{
+		UE_LOG(LogObstacle_Avoidance, Warning, TEXT("%s: no goal volume in the level to run to."), *GetName());
+		return;
+	}
+
+	MoveToActor(*It, AcceptanceRadius);
+}
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "OARunnerAIController.generated.h"
+
+/**
+ * AI controller that runs the obstacle course.
+ * Paths to the level's AOAGoalVolume over the navmesh, crossing jump pads and moving platforms
+ * through the prebuilt AOANavLinkCache links with UOAPathFollowingComponent.
+ * Retries the move after a delay if the runner gets knocked off or blocked.
+ */
+UCLASS()
+class AOARunnerAIController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	AOARunnerAIController(const FObjectInitializer& ObjectInitializer);
+
+protected:
+
+	/** How close to the goal the runner needs to get */
+	UPROPERTY(EditAnywhere, Category = "Runner", meta = (ClampMin = "0.0", Units = "cm"))
+	float AcceptanceRadius = 50.0f;
+
+	/** Time to wait before pathing again after a failed move */
+	UPROPERTY(EditAnywhere, Category = "Runner", meta = (ClampMin = "0.0", Units = "s"))
+	float RetryDelay = 1.0f;
+
+	/** Timer for retrying failed moves */
+	FTimerHandle RetryTimer;
+
+	/** Starts running once we have a pawn */
+	virtual void OnPossess(APawn* InPawn) override;
+
+	/** Stops retrying when we lose the pawn */
+	virtual void OnUnPossess() override;
+
+	/** Schedules a retry if the move failed */
+	virtual void OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult& Result) override;
+
+public:
+
+	/** Paths to the goal volume */
+	void MoveToGoal();
+};
@@ -6,6 +6,8 @@
 #include "Components/SceneComponent.h"
 #include "Engine/StaticMesh.h"
 #include "TimerManager.h"
+#include "OAFrameWatchdog.h"
+#include "OAObstacleStreamingSubsystem.h"
 
 AOACannon::AOACannon()
 {
@@ -66,6 +68,22 @@ void AOACannon::BeginPlay()
 
 	// Start periodic firing
 	GetWorldTimerManager().SetTimer(FireTimerHandle, this, &AOACannon::FireCannonball, FireInterval, true);
+
+	// Pick up where we left off if our cell was unloaded
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->RestoreObstacle(this);
+	}
+}
+
+void AOACannon::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->SaveObstacle(this, EndPlayReason);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 #if WITH_EDITOR
@@ -79,6 +97,8 @@ void AOACannon::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEve
 
 void AOACannon::FireCannonball()
 {
+	OA_WATCHDOG_SCOPE("OACannon.SpawnCannonball", this);
+
 	const FVector SpawnLocation = MuzzlePoint->GetComponentLocation();
 	const FRotator SpawnRotation = MuzzlePoint->GetComponentRotation();
 	const FVector LaunchDirection = BarrelPivot->GetForwardVector();
@@ -108,3 +128,15 @@ void AOACannon::UpdateCannonLayout()
 	// Muzzle at the end of the barrel
 	MuzzlePoint->SetRelativeLocation(FVector(BarrelLength, 0.0f, 0.0f));
 }
+
+void AOACannon::SaveStreamingState(FOAObstacleStreamingState& OutState) const
+{
+	OutState.Phase = GetWorldTimerManager().GetTimerElapsed(FireTimerHandle);
+}
+
+void AOACannon::RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime)
+{
+	// Shots missed while unloaded are skipped, only the rhythm is kept
+	const float FirstDelay = FireInterval - FMath::Fmod(FMath::Max(0.0f, State.Phase) + ElapsedTime, FireInterval);
+	GetWorldTimerManager().SetTimer(FireTimerHandle, this, &AOACannon::FireCannonball, FireInterval, true, FirstDelay);
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "OAStreamableObstacle.h"
 #include "OACannon.generated.h"
 
 class UStaticMeshComponent;
@@ -13,9 +14,10 @@ class USceneComponent;
  * Cannon obstacle.
  * A base pedestal with an angled barrel that periodically fires cannonballs.
  * Cannonballs follow parabolic trajectory and knock back the player on hit.
+ * Keeps its firing rhythm across World Partition cell unloads.
  */
 UCLASS()
-class AOACannon : public AActor
+class AOACannon : public AActor, public IOAStreamableObstacle
 {
 	GENERATED_BODY()
 
@@ -24,6 +26,11 @@ public:
 	AOACannon();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** IOAStreamableObstacle */
+	virtual void SaveStreamingState(FOAObstacleStreamingState& OutState) const override;
+	virtual void RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime) override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
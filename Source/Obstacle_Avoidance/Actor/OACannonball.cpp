@@ -6,6 +6,9 @@
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "GameFramework/Character.h"
 #include "Engine/StaticMesh.h"
+#include "Obstacle_AvoidanceCharacter.h"
+#include "OATelemetrySubsystem.h"
+#include "OAObstacleForceSubsystem.h"
 
 AOACannonball::AOACannonball()
 {
@@ -56,12 +59,38 @@ void AOACannonball::BeginPlay()
 	CollisionSphere->OnComponentBeginOverlap.AddDynamic(this, &AOACannonball::OnOverlapBegin);
 }
 
+void AOACannonball::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bAsyncForces)
+	{
+		if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+		{
+			Forces->UnregisterForceShapes(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AOACannonball::Initialize(const FVector& InDirection, float InSpeed, float InKnockbackForce)
 {
 	KnockbackForce = InKnockbackForce;
 	ProjectileMovement->InitialSpeed = InSpeed;
 	ProjectileMovement->MaxSpeed = InSpeed;
 	ProjectileMovement->Velocity = InDirection * InSpeed;
+
+	// Let the physics thread track the ball if obstacle forces run there
+	if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+	{
+		FOAObstacleForceSettings Settings;
+		Settings.Type = EOAObstacleForceType::Knockback;
+		Settings.KnockbackForce = KnockbackForce;
+		Settings.bXYOverride = true;
+		Settings.bZOverride = true;
+		Settings.OnLaunch.BindUObject(this, &AOACannonball::OnKnockback);
+
+		bAsyncForces = Forces->RegisterForceShape(CollisionSphere, Settings);
+	}
 }
 
 void AOACannonball::OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor,
@@ -86,14 +115,33 @@ void AOACannonball::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor*
 	}
 
 	ACharacter* HitCharacter = Cast<ACharacter>(OtherActor);
-	if (HitCharacter)
+	if (!HitCharacter)
+	{
+		Destroy();
+		return;
+	}
+
+	// the async physics callback handles knockbacks when it's running
+	if (bAsyncForces)
 	{
-		// Knockback direction: from cannonball toward player
-		FVector KnockbackDir = (HitCharacter->GetActorLocation() - GetActorLocation()).GetSafeNormal2D();
-		KnockbackDir.Z = 0.3f;
-		KnockbackDir.Normalize();
+		return;
+	}
+
+	// Knockback direction: from cannonball toward player
+	HitCharacter->LaunchCharacter(UOAObstacleForceSubsystem::GetKnockbackVelocity(GetActorLocation(), HitCharacter->GetActorLocation(), KnockbackForce), true, true);
 
-		HitCharacter->LaunchCharacter(KnockbackDir * KnockbackForce, true, true);
+	OnKnockback(HitCharacter);
+}
+
+void AOACannonball::OnKnockback(ACharacter* HitCharacter)
+{
+	// Attribute the hit to the cannon that fired us
+	AActor* Cause = GetOwner() ? GetOwner() : this;
+	UOATelemetrySubsystem::Record(this, EOATelemetryEventType::Knockback, HitCharacter->GetActorLocation(), UOATelemetrySubsystem::GetCauseName(Cause));
+
+	if (AObstacle_AvoidanceCharacter* OACharacter = Cast<AObstacle_AvoidanceCharacter>(HitCharacter))
+	{
+		OACharacter->NotifyObstacleHit(Cause);
 	}
 
 	Destroy();
@@ -9,11 +9,13 @@
 class USphereComponent;
 class UStaticMeshComponent;
 class UProjectileMovementComponent;
+class ACharacter;
 
 /**
  * Cannonball projectile.
  * Follows a parabolic trajectory via ProjectileMovementComponent.
  * Knocks back the player on overlap, destroyed on any hit.
+ * Knockbacks move to the async physics callback when UOAObstacleForceSubsystem is running.
  */
 UCLASS()
 class AOACannonball : public AActor
@@ -30,6 +32,7 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	TObjectPtr<USphereComponent> CollisionSphere;
@@ -44,6 +47,12 @@ private:
 
 	float KnockbackForce = 0.0f;
 
+	/** True if knockbacks are applied from the async physics callback */
+	bool bAsyncForces = false;
+
+	/** Records the hit on a character we're knocking back, then goes away */
+	void OnKnockback(ACharacter* HitCharacter);
+
 	UFUNCTION()
 	void OnHit(UPrimitiveComponent* HitComp, AActor* OtherActor,
 		UPrimitiveComponent* OtherComp, FVector NormalImpulse,
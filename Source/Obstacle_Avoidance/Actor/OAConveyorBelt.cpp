@@ -7,6 +7,8 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/MaterialInterface.h"
 #include "GameFramework/Character.h"
+#include "OAFrameWatchdog.h"
+#include "OAObstacleForceSubsystem.h"
 
 AOAConveyorBelt::AOAConveyorBelt()
 {
@@ -60,17 +62,50 @@ void AOAConveyorBelt::BeginPlay()
 		const float DirectionSign = bReverseDirection ? -1.0f : 1.0f;
 		DynamicMaterial->SetScalarParameterValue(TEXT("ScrollSpeed"), UVScrollSpeed * DirectionSign);
 	}
+
+	// Push from the physics thread if obstacle forces run there, we don't need to tick then
+	if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+	{
+		FOAObstacleForceSettings Settings;
+		Settings.Type = EOAObstacleForceType::Push;
+		Settings.Velocity = (bReverseDirection ? -GetActorForwardVector() : GetActorForwardVector()) * BeltSpeed;
+
+		if (Forces->RegisterForceShape(OverlapBox, Settings))
+		{
+			SetActorTickEnabled(false);
+		}
+	}
+}
+
+void AOAConveyorBelt::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+	{
+		Forces->UnregisterForceShapes(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AOAConveyorBelt::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	OA_WATCHDOG_SCOPE("OAConveyorBelt.Tick", this);
+
 	// Push overlapping characters along belt direction
 	if (OverlappingCharacters.Num() > 0)
 	{
+		// Push by whole simulation steps. Characters render their own motion, so apply all steps at once
+		const int32 NumSteps = FixedTimestep.Advance(DeltaTime);
+
+		if (NumSteps == 0)
+		{
+			return;
+		}
+
 		const FVector BeltDirection = bReverseDirection ? -GetActorForwardVector() : GetActorForwardVector();
-		const FVector Displacement = BeltDirection * BeltSpeed * DeltaTime;
+		const FVector Displacement = BeltDirection * BeltSpeed * FixedTimestep.GetStepTime() * NumSteps;
 
 		for (int32 i = OverlappingCharacters.Num() - 1; i >= 0; --i)
 		{
@@ -84,6 +119,11 @@ void AOAConveyorBelt::Tick(float DeltaTime)
 			}
 		}
 	}
+	else
+	{
+		// Start fresh when the next character steps on
+		FixedTimestep.Reset();
+	}
 }
 
 void AOAConveyorBelt::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
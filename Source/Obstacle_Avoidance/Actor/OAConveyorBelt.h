@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "OAFixedTimestep.h"
 #include "OAConveyorBelt.generated.h"
 
 class UStaticMeshComponent;
@@ -15,6 +16,8 @@ class UMaterialInstanceDynamic;
  * Pushes characters along the belt direction while they stand on it.
  * Uses Dynamic Material Instance to scroll UVs, creating a visual flow effect
  * without physically moving the mesh.
+ * Characters are pushed in fixed simulation steps, or from the async physics callback
+ * when UOAObstacleForceSubsystem is running.
  */
 UCLASS()
 class AOAConveyorBelt : public AActor
@@ -28,6 +31,7 @@ public:
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 	/** Visual mesh for the conveyor belt */
@@ -57,6 +61,9 @@ private:
 
 	TArray<TWeakObjectPtr<ACharacter>> OverlappingCharacters;
 
+	/** Fixed timestep accumulator for pushing characters */
+	FOAFixedTimestep FixedTimestep;
+
 	UFUNCTION()
 	void OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
@@ -0,0 +1,52 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAFixedTimestep.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarOAObstacleFixedStepRate(
+	TEXT("OA.Obstacles.FixedStepRate"),
+	60.0f,
+	TEXT("Simulation rate for moving obstacles, in steps per second. Zero simulates once per frame with the frame time."));
+
+static TAutoConsoleVariable<int32> CVarOAObstacleMaxSubsteps(
+	TEXT("OA.Obstacles.MaxSubsteps"),
+	4,
+	TEXT("Max number of fixed simulation steps a moving obstacle may run in a single frame."));
+
+int32 FOAFixedTimestep::Advance(float DeltaTime)
+{
+	const float StepRate = CVarOAObstacleFixedStepRate.GetValueOnGameThread();
+
+	// variable step mode, simulate once with the frame time
+	if (StepRate <= 0.0f)
+	{
+		Accumulator = 0.0f;
+		StepTime = DeltaTime;
+		Alpha = 1.0f;
+		return 1;
+	}
+
+	StepTime = 1.0f / StepRate;
+	Accumulator += DeltaTime;
+
+	const int32 MaxSubsteps = FMath::Max(1, CVarOAObstacleMaxSubsteps.GetValueOnGameThread());
+	int32 NumSteps = FMath::FloorToInt32(Accumulator / StepTime);
+
+	// drop the time we can't afford to simulate
+	if (NumSteps > MaxSubsteps)
+	{
+		NumSteps = MaxSubsteps;
+		Accumulator = StepTime * MaxSubsteps;
+	}
+
+	Accumulator -= NumSteps * StepTime;
+	Alpha = FMath::Clamp(Accumulator / StepTime, 0.0f, 1.0f);
+
+	return NumSteps;
+}
+
+void FOAFixedTimestep::Reset()
+{
+	Accumulator = 0.0f;
+	Alpha = 1.0f;
+}
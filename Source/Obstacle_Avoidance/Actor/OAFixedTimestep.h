@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed timestep accumulator for obstacle simulation.
+ * Splits variable frame times into fixed simulation steps and reports how far
+ * rendering is between the last two steps, so obstacles can interpolate their visuals.
+ * The step rate and max substeps per frame are set with the OA.Obstacles.FixedStepRate
+ * and OA.Obstacles.MaxSubsteps console variables. A rate of zero simulates once per frame.
+ */
+struct FOAFixedTimestep
+{
+	/**
+	 * Adds the frame time and returns the number of simulation steps to run this frame.
+	 * Time beyond the max substeps is dropped so long frames can't snowball.
+	 */
+	int32 Advance(float DeltaTime);
+
+	/** Returns the duration of each simulation step returned by the last Advance */
+	float GetStepTime() const { return StepTime; }
+
+	/** Returns the 0-1 interpolation factor between the previous and current simulation states */
+	float GetAlpha() const { return Alpha; }
+
+	/** Clears any accumulated time */
+	void Reset();
+
+private:
+
+	/** Unsimulated time carried over to the next frame */
+	float Accumulator = 0.0f;
+
+	/** Duration of each simulation step */
+	float StepTime = 0.0f;
+
+	/** Interpolation factor between the previous and current simulation states */
+	float Alpha = 1.0f;
+};
@@ -7,6 +7,7 @@
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
+#include "OAFrameWatchdog.h"
 
 AOAGoalVolume::AOAGoalVolume()
 {
@@ -21,6 +22,11 @@ AOAGoalVolume::AOAGoalVolume()
 	OverlapBox->SetCollisionResponseToAllChannels(ECR_Ignore);
 	OverlapBox->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
 	OverlapBox->SetGenerateOverlapEvents(true);
+
+#if WITH_EDITORONLY_DATA
+	// Keep the goal loaded with the persistent level so runners can path to it from any World Partition cell
+	bIsSpatiallyLoaded = false;
+#endif
 }
 
 void AOAGoalVolume::BeginPlay()
@@ -70,6 +76,8 @@ void AOAGoalVolume::TransitionToNextLevel()
 {
 	if (!NextLevelName.IsNone())
 	{
+		OA_WATCHDOG_SCOPE("OAGoalVolume.OpenLevel", this);
+
 		UGameplayStatics::OpenLevel(this, NextLevelName);
 	}
 }
@@ -7,6 +7,7 @@
 #include "Materials/MaterialInterface.h"
 #include "GameFramework/Character.h"
 #include "Obstacle_AvoidanceCharacter.h"
+#include "OAObstacleForceSubsystem.h"
 
 AOAJumpPad::AOAJumpPad()
 {
@@ -56,24 +57,61 @@ void AOAJumpPad::BeginPlay()
 	Super::BeginPlay();
 
 	OverlapBox->OnComponentBeginOverlap.AddDynamic(this, &AOAJumpPad::OnOverlapBegin);
+
+	// Let the physics thread launch characters if obstacle forces run there
+	if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+	{
+		FOAObstacleForceSettings Settings;
+		Settings.Type = EOAObstacleForceType::Launch;
+		Settings.Velocity = GetLaunchVelocity();
+		Settings.bZOverride = bOverrideZVelocity;
+		Settings.OnLaunch.BindUObject(this, &AOAJumpPad::OnLaunch);
+
+		bAsyncForces = Forces->RegisterForceShape(OverlapBox, Settings);
+	}
+}
+
+void AOAJumpPad::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+	{
+		Forces->UnregisterForceShapes(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AOAJumpPad::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
 	bool bFromSweep, const FHitResult& SweepResult)
 {
+	// the async physics callback handles launches when it's running
+	if (bAsyncForces)
+	{
+		return;
+	}
+
 	ACharacter* Character = Cast<ACharacter>(OtherActor);
 	if (!Character)
 	{
 		return;
 	}
 
+	OnLaunch(Character);
+
+	Character->LaunchCharacter(GetLaunchVelocity(), false, bOverrideZVelocity);
+}
+
+void AOAJumpPad::OnLaunch(ACharacter* Character)
+{
 	AObstacle_AvoidanceCharacter* OACharacter = Cast<AObstacle_AvoidanceCharacter>(Character);
 	if (OACharacter)
 	{
 		OACharacter->SetJumpPadLaunched();
 	}
+}
 
-	const FVector LaunchVelocity(0.0f, 0.0f, LaunchForce);
-	Character->LaunchCharacter(LaunchVelocity, false, bOverrideZVelocity);
+FVector AOAJumpPad::GetLaunchLocation() const
+{
+	return OverlapBox->GetComponentLocation();
 }
@@ -8,11 +8,13 @@
 
 class UStaticMeshComponent;
 class UBoxComponent;
+class ACharacter;
 
 /**
  * Jump Pad obstacle.
  * Launches characters upward when they step onto the pad surface.
  * Uses an overlap trigger to call LaunchCharacter with a configurable force.
+ * Launches move to the async physics callback when UOAObstacleForceSubsystem is running.
  */
 UCLASS()
 class AOAJumpPad : public AActor
@@ -23,9 +25,16 @@ public:
 
 	AOAJumpPad();
 
+	/** Returns the velocity the pad adds to characters it launches */
+	FVector GetLaunchVelocity() const { return FVector(0.0f, 0.0f, LaunchForce); }
+
+	/** Returns the location characters are launched from */
+	FVector GetLaunchLocation() const;
+
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Visual mesh for the jump pad */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
@@ -45,6 +54,12 @@ protected:
 
 private:
 
+	/** True if launches are applied from the async physics callback */
+	bool bAsyncForces = false;
+
+	/** Flags a character we're launching */
+	void OnLaunch(ACharacter* Character);
+
 	UFUNCTION()
 	void OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
@@ -8,6 +8,7 @@
 #include "GameFramework/Character.h"
 #include "Obstacle_AvoidanceCharacter.h"
 #include "TimerManager.h"
+#include "OAObstacleStreamingSubsystem.h"
 
 AOALaserBeam::AOALaserBeam()
 {
@@ -82,6 +83,22 @@ void AOALaserBeam::BeginPlay()
 
 	// Start beam cycle timer (toggles every half-cycle)
 	GetWorldTimerManager().SetTimer(BeamTimerHandle, this, &AOALaserBeam::ToggleBeam, BeamCycle * 0.5f, true);
+
+	// Pick up where we left off if our cell was unloaded
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->RestoreObstacle(this);
+	}
+}
+
+void AOALaserBeam::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->SaveObstacle(this, EndPlayReason);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 #if WITH_EDITOR
@@ -95,7 +112,12 @@ void AOALaserBeam::PostEditChangeProperty(FPropertyChangedEvent& PropertyChanged
 
 void AOALaserBeam::ToggleBeam()
 {
-	bBeamActive = !bBeamActive;
+	SetBeamActive(!bBeamActive);
+}
+
+void AOALaserBeam::SetBeamActive(bool bNewActive)
+{
+	bBeamActive = bNewActive;
 
 	BeamMesh->SetVisibility(bBeamActive);
 	BeamCollision->SetCollisionEnabled(bBeamActive ? ECollisionEnabled::QueryOnly : ECollisionEnabled::NoCollision);
@@ -121,6 +143,27 @@ void AOALaserBeam::OnBeamOverlapBegin(UPrimitiveComponent* OverlappedComponent,
 	AObstacle_AvoidanceCharacter* Character = Cast<AObstacle_AvoidanceCharacter>(OtherActor);
 	if (Character && !Character->IsDead())
 	{
+		Character->NotifyObstacleHit(this);
 		Character->Die();
 	}
 }
+
+void AOALaserBeam::SaveStreamingState(FOAObstacleStreamingState& OutState) const
+{
+	OutState.Phase = GetWorldTimerManager().GetTimerElapsed(BeamTimerHandle);
+	OutState.bActive = bBeamActive;
+}
+
+void AOALaserBeam::RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime)
+{
+	const float HalfCycle = BeamCycle * 0.5f;
+	const float CycleTime = FMath::Max(0.0f, State.Phase) + ElapsedTime;
+
+	// Every half cycle spent unloaded would have toggled the beam once
+	const int32 NumToggles = FMath::FloorToInt(CycleTime / HalfCycle);
+	SetBeamActive(State.bActive != (NumToggles % 2 == 1));
+
+	// Resume the timer part way through the current half cycle
+	const float FirstDelay = HalfCycle - FMath::Fmod(CycleTime, HalfCycle);
+	GetWorldTimerManager().SetTimer(BeamTimerHandle, this, &AOALaserBeam::ToggleBeam, HalfCycle, true, FirstDelay);
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "OAStreamableObstacle.h"
 #include "OALaserBeam.generated.h"
 
 class UStaticMeshComponent;
@@ -14,9 +15,10 @@ class USceneComponent;
  * Laser beam obstacle.
  * Two pillars with a beam that toggles on/off periodically.
  * Kills the player on contact.
+ * Keeps its on/off cycle across World Partition cell unloads.
  */
 UCLASS()
-class AOALaserBeam : public AActor
+class AOALaserBeam : public AActor, public IOAStreamableObstacle
 {
 	GENERATED_BODY()
 
@@ -25,6 +27,11 @@ public:
 	AOALaserBeam();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** IOAStreamableObstacle */
+	virtual void SaveStreamingState(FOAObstacleStreamingState& OutState) const override;
+	virtual void RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime) override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -68,6 +75,9 @@ private:
 
 	void ToggleBeam();
 
+	/** Turns the beam visuals and collision on or off */
+	void SetBeamActive(bool bNewActive);
+
 	/** Update component transforms based on current property values. */
 	void UpdateLayout();
 
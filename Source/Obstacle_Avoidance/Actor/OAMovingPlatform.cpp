@@ -3,6 +3,8 @@
 #include "OAMovingPlatform.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
+#include "OAFrameWatchdog.h"
+#include "OAObstacleStreamingSubsystem.h"
 
 AOAMovingPlatform::AOAMovingPlatform()
 {
@@ -24,6 +26,9 @@ AOAMovingPlatform::AOAMovingPlatform()
 	Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 	Mesh->SetCollisionObjectType(ECC_WorldStatic);
 	Mesh->SetCollisionResponseToAllChannels(ECR_Block);
+
+	// AI crosses the platform through prebuilt nav links, so moving it never dirties the navmesh
+	Mesh->SetCanEverAffectNavigation(false);
 }
 
 void AOAMovingPlatform::BeginPlay()
@@ -32,20 +37,69 @@ void AOAMovingPlatform::BeginPlay()
 
 	StartLocation = GetActorLocation();
 	CurrentDistance = 0.0f;
+	PreviousDistance = 0.0f;
 	Direction = 1.0f;
+	FixedTimestep.Reset();
+
+	// Pick up where we left off if our cell was unloaded
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->RestoreObstacle(this);
+	}
+}
+
+void AOAMovingPlatform::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->SaveObstacle(this, EndPlayReason);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AOAMovingPlatform::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	OA_WATCHDOG_SCOPE("OAMovingPlatform.Tick", this);
+
 	if (MoveDistance <= 0.0f || MoveSpeed <= 0.0f)
 	{
 		return;
 	}
 
+	// Run the fixed simulation steps for this frame
+	const int32 NumSteps = FixedTimestep.Advance(DeltaTime);
+
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		StepMovement(FixedTimestep.GetStepTime());
+	}
+
+	// Interpolate between the last two steps for rendering
+	const float VisualDistance = FMath::Lerp(PreviousDistance, CurrentDistance, FixedTimestep.GetAlpha());
+
+	// Compute the new location
+	FVector NewLocation = StartLocation;
+	if (bMoveLeftRight)
+	{
+		NewLocation.Y += VisualDistance;
+	}
+	else
+	{
+		NewLocation.X += VisualDistance;
+	}
+
+	SetActorLocation(NewLocation);
+}
+
+void AOAMovingPlatform::StepMovement(float StepTime)
+{
+	PreviousDistance = CurrentDistance;
+
 	// Advance along the path
-	CurrentDistance += MoveSpeed * DeltaTime * Direction;
+	CurrentDistance += MoveSpeed * StepTime * Direction;
 
 	// Reverse direction when reaching either end
 	if (CurrentDistance >= MoveDistance)
@@ -58,17 +112,71 @@ void AOAMovingPlatform::Tick(float DeltaTime)
 		CurrentDistance = -MoveDistance;
 		Direction = 1.0f;
 	}
+}
 
-	// Compute the new location
-	FVector NewLocation = StartLocation;
+FVector AOAMovingPlatform::GetEndLocation(float EndSign) const
+{
+	FVector EndLocation = HasActorBegunPlay() ? StartLocation : GetActorLocation();
 	if (bMoveLeftRight)
 	{
-		NewLocation.Y += CurrentDistance;
+		EndLocation.Y += MoveDistance * EndSign;
 	}
 	else
 	{
-		NewLocation.X += CurrentDistance;
+		EndLocation.X += MoveDistance * EndSign;
 	}
 
-	SetActorLocation(NewLocation);
+	return EndLocation;
+}
+
+float AOAMovingPlatform::GetTimeToReachEnd(float EndSign) const
+{
+	if (MoveSpeed <= 0.0f)
+	{
+		return UE_BIG_NUMBER;
+	}
+
+	// Heading toward the end: straight there. Heading away: out to the other end and back
+	const float DistanceToEnd = GetDistanceToEnd(EndSign);
+	const float TravelDistance = FMath::Sign(EndSign) == Direction ? DistanceToEnd : 4.0f * MoveDistance - DistanceToEnd;
+
+	return TravelDistance / MoveSpeed;
+}
+
+float AOAMovingPlatform::GetDistanceToEnd(float EndSign) const
+{
+	return FMath::Abs(MoveDistance * FMath::Sign(EndSign) - CurrentDistance);
+}
+
+void AOAMovingPlatform::SaveStreamingState(FOAObstacleStreamingState& OutState) const
+{
+	OutState.Phase = CurrentDistance;
+	OutState.Direction = Direction;
+}
+
+void AOAMovingPlatform::RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime)
+{
+	if (MoveDistance <= 0.0f)
+	{
+		return;
+	}
+
+	// Unfold the back and forth path into a single loop, advance along it and fold it back
+	const float LoopLength = 4.0f * MoveDistance;
+	const float LoopStart = State.Direction > 0.0f ? State.Phase + MoveDistance : 3.0f * MoveDistance - State.Phase;
+	const float LoopPosition = FMath::Fmod(LoopStart + MoveSpeed * ElapsedTime, LoopLength);
+
+	if (LoopPosition < 2.0f * MoveDistance)
+	{
+		CurrentDistance = LoopPosition - MoveDistance;
+		Direction = 1.0f;
+	}
+	else
+	{
+		CurrentDistance = 3.0f * MoveDistance - LoopPosition;
+		Direction = -1.0f;
+	}
+
+	PreviousDistance = CurrentDistance;
+	FixedTimestep.Reset();
 }
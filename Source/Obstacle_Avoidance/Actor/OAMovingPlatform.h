@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "OAFixedTimestep.h"
+#include "OAStreamableObstacle.h"
 #include "OAMovingPlatform.generated.h"
 
 class UStaticMeshComponent;
@@ -12,9 +14,11 @@ class UStaticMeshComponent;
  * Moving platform obstacle that oscillates between two points.
  * Moves along either the X axis (forward/backward) or Y axis (left/right)
  * based on a configurable distance from the spawn location.
+ * Movement is simulated at a fixed timestep and interpolated for rendering.
+ * Keeps its place along the path across World Partition cell unloads.
  */
 UCLASS()
-class AOAMovingPlatform : public AActor
+class AOAMovingPlatform : public AActor, public IOAStreamableObstacle
 {
 	GENERATED_BODY()
 
@@ -23,8 +27,31 @@ public:
 	AOAMovingPlatform();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
+	/** IOAStreamableObstacle */
+	virtual void SaveStreamingState(FOAObstacleStreamingState& OutState) const override;
+	virtual void RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime) override;
+
+	/** Returns the platform location at either end of its path. Uses the current location as the start before play */
+	FVector GetEndLocation(float EndSign) const;
+
+	/** Returns the time until the platform next arrives at the end of its path on the given side (+1 or -1) */
+	float GetTimeToReachEnd(float EndSign) const;
+
+	/** Returns the distance from the platform to the end of its path on the given side (+1 or -1) */
+	float GetDistanceToEnd(float EndSign) const;
+
+	/** Returns the unit axis the platform moves along */
+	FVector GetMoveAxis() const { return bMoveLeftRight ? FVector::RightVector : FVector::ForwardVector; }
+
+	/** Returns the distance the platform travels from its start location in each direction */
+	float GetMoveDistance() const { return MoveDistance; }
+
+	/** Returns the platform mesh */
+	UStaticMeshComponent* GetMesh() const { return Mesh; }
+
 protected:
 
 	/** Platform mesh component */
@@ -45,6 +72,12 @@ protected:
 
 private:
 
+	/** Advances the platform along its path by one simulation step */
+	void StepMovement(float StepTime);
+
+	/** Fixed timestep accumulator */
+	FOAFixedTimestep FixedTimestep;
+
 	/** Cached start location */
 	FVector StartLocation;
 
@@ -53,4 +86,7 @@ private:
 
 	/** Current progress along the movement path (0 to MoveDistance) */
 	float CurrentDistance = 0.0f;
+
+	/** Progress along the movement path at the previous simulation step */
+	float PreviousDistance = 0.0f;
 };
@@ -0,0 +1,307 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OANavLinkCache.h"
+#include "Components/SceneComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "AI/Navigation/NavLinkDefinition.h"
+#include "AI/Navigation/NavigationRelevantData.h"
+#include "AI/NavigationSystemBase.h"
+#include "AI/NavigationSystemHelpers.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "OAJumpPad.h"
+#include "OAMovingPlatform.h"
+#include "Obstacle_Avoidance.h"
+
+namespace OANavLinks
+{
+	/** Simulation step used to trace jump pad launch arcs */
+	constexpr float ArcStepTime = 0.05f;
+
+	/** Longest launch arc we simulate */
+	constexpr float MaxArcTime = 4.0f;
+
+	/** Min ground normal Z for a landing spot to count as walkable */
+	constexpr float MinWalkableNormalZ = 0.7f;
+
+	/** Height above the expected ground to start downward ground traces from */
+	constexpr float GroundTraceHeight = 100.0f;
+}
+
+AOANavLinkCache::AOANavLinkCache()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("Root")));
+
+#if WITH_EDITORONLY_DATA
+	// Links span the whole course, so keep them loaded with the persistent level
+	bIsSpatiallyLoaded = false;
+#endif
+}
+
+void AOANavLinkCache::GetNavigationData(FNavigationRelevantData& Data) const
+{
+	TArray<FNavigationLink> NavLinks;
+	NavLinks.Reserve(Links.Num());
+
+	for (const FOANavLinkData& Link : Links)
+	{
+		// links are stored in world space
+		FNavigationLink& NavLink = NavLinks.Emplace_GetRef(Link.Start, Link.End);
+		NavLink.Direction = Link.Type == EOANavLinkType::JumpPad ? ENavLinkDirection::LeftToRight : ENavLinkDirection::BothWays;
+		NavLink.SnapRadius = MatchTolerance;
+	}
+
+	NavigationHelper::ProcessNavLinkAndAppend(&Data.Modifiers, FTransform::Identity, NavLinks);
+}
+
+FBox AOANavLinkCache::GetNavigationBounds() const
+{
+	FBox Bounds(ForceInit);
+
+	for (const FOANavLinkData& Link : Links)
+	{
+		Bounds += Link.Start;
+		Bounds += Link.End;
+	}
+
+	return Bounds.ExpandBy(MatchTolerance);
+}
+
+bool AOANavLinkCache::IsNavigationRelevant() const
+{
+	return !Links.IsEmpty();
+}
+
+const FOANavLinkData* AOANavLinkCache::FindLink(const FVector& From, const FVector& To) const
+{
+	const float ToleranceSquared = FMath::Square(MatchTolerance);
+
+	for (const FOANavLinkData& Link : Links)
+	{
+		const bool bForward = FVector::DistSquared(From, Link.Start) < ToleranceSquared && FVector::DistSquared(To, Link.End) < ToleranceSquared;
+		const bool bBackward = Link.Type == EOANavLinkType::MovingPlatform
+			&& FVector::DistSquared(From, Link.End) < ToleranceSquared && FVector::DistSquared(To, Link.Start) < ToleranceSquared;
+
+		if (bForward || bBackward)
+		{
+			return &Link;
+		}
+	}
+
+	return nullptr;
+}
+
+const FOANavLinkData* AOANavLinkCache::FindLinkInWorld(const UWorld* World, const FVector& From, const FVector& To)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	// there's one cache per level, so this only visits a handful of actors
+	for (TActorIterator<AOANavLinkCache> It(World); It; ++It)
+	{
+		if (const FOANavLinkData* Link = It->FindLink(From, To))
+		{
+			return Link;
+		}
+	}
+
+	return nullptr;
+}
+
+#if WITH_EDITOR
+
+void AOANavLinkCache::BuildLinks()
+{
+	Modify();
+	Links.Reset();
+
+	for (TActorIterator<AOAJumpPad> It(GetWorld()); It; ++It)
+	{
+		if (It->GetLevel() == GetLevel())
+		{
+			BuildJumpPadLinks(*It);
+		}
+	}
+
+	for (TActorIterator<AOAMovingPlatform> It(GetWorld()); It; ++It)
+	{
+		if (It->GetLevel() == GetLevel())
+		{
+			BuildMovingPlatformLinks(*It);
+		}
+	}
+
+	UE_LOG(LogObstacle_Avoidance, Log, TEXT("%s: built %d nav links."), *GetName(), Links.Num());
+
+	// push the new links into the navmesh
+	FNavigationSystem::UpdateActorData(*this);
+}
+
+void AOANavLinkCache::BuildJumpPadLinks(AOAJumpPad* JumpPad)
+{
+	FVector PadOrigin;
+	FVector PadExtent;
+	JumpPad->GetActorBounds(true, PadOrigin, PadExtent);
+
+	// the pad itself is the ground here, so don't ignore it
+	FVector PadGround;
+	if (!FindGround(JumpPad->GetLaunchLocation(), OANavLinks::GroundTraceHeight * 2.0f, nullptr, PadGround))
+	{
+		return;
+	}
+
+	const FVector Gravity(0.0f, 0.0f, GetWorld()->GetGravityZ());
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(OANavLinkArc), false, JumpPad);
+
+	for (int32 DirectionIndex = 0; DirectionIndex < NumLaunchDirections; ++DirectionIndex)
+	{
+		// runners keep their ground speed through the launch, so the arc leans the way they ran onto the pad
+		const FVector Direction = FRotator(0.0f, 360.0f * DirectionIndex / NumLaunchDirections, 0.0f).Vector();
+		const FVector LaunchVelocity = JumpPad->GetLaunchVelocity() + Direction * RunnerSpeed;
+
+		FVector Location = PadGround;
+		FVector Velocity = LaunchVelocity;
+		bool bLanded = false;
+		FHitResult Hit;
+
+		for (float Time = 0.0f; Time < OANavLinks::MaxArcTime && !bLanded; Time += OANavLinks::ArcStepTime)
+		{
+			const FVector NextVelocity = Velocity + Gravity * OANavLinks::ArcStepTime;
+			const FVector NextLocation = Location + (Velocity + NextVelocity) * 0.5f * OANavLinks::ArcStepTime;
+
+			if (GetWorld()->LineTraceSingleByChannel(Hit, Location, NextLocation, ECC_Visibility, QueryParams))
+			{
+				// only land on walkable floors while falling, anything else ends the arc
+				if (Velocity.Z >= 0.0f || Hit.ImpactNormal.Z < OANavLinks::MinWalkableNormalZ)
+				{
+					break;
+				}
+
+				bLanded = true;
+			}
+
+			Location = NextLocation;
+			Velocity = NextVelocity;
+		}
+
+		if (!bLanded || Hit.ImpactPoint.Z - PadGround.Z < MinLaunchHeight)
+		{
+			continue;
+		}
+
+		// skip landings this pad already has a link for
+		const bool bDuplicate = Links.ContainsByPredicate([this, JumpPad, &Hit](const FOANavLinkData& Link)
+		{
+			return Link.Source.Get() == JumpPad && FVector::Dist(Link.End, Hit.ImpactPoint) < LandingMergeDistance;
+		});
+
+		if (bDuplicate)
+		{
+			continue;
+		}
+
+		// start the link on the ground behind the pad so runners cross it heading toward the landing
+		FVector Approach;
+		if (!FindGround(PadGround - Direction * (PadExtent.X + MatchTolerance), OANavLinks::GroundTraceHeight * 2.0f, JumpPad, Approach))
+		{
+			Approach = PadGround;
+		}
+
+		FOANavLinkData& Link = Links.AddDefaulted_GetRef();
+		Link.Start = Approach;
+		Link.End = Hit.ImpactPoint;
+		Link.Type = EOANavLinkType::JumpPad;
+		Link.Source = JumpPad;
+	}
+}
+
+void AOANavLinkCache::BuildMovingPlatformLinks(AOAMovingPlatform* Platform)
+{
+	if (Platform->GetMoveDistance() <= 0.0f)
+	{
+		return;
+	}
+
+	const FVector Axis = Platform->GetMoveAxis();
+	const float HalfLength = FMath::Abs(FVector::DotProduct(Platform->GetMesh()->Bounds.BoxExtent, Axis));
+
+	// find the ground just past each end of the platform path
+	FVector Docks[2];
+
+	for (int32 Side = 0; Side < 2; ++Side)
+	{
+		const float EndSign = Side == 0 ? -1.0f : 1.0f;
+		const FVector DockLocation = Platform->GetEndLocation(EndSign) + Axis * EndSign * (HalfLength + DockDistance);
+
+		if (!FindGround(DockLocation, OANavLinks::GroundTraceHeight * 3.0f, Platform, Docks[Side]))
+		{
+			UE_LOG(LogObstacle_Avoidance, Verbose, TEXT("%s: no ground past the %s end of %s, skipping."),
+				*GetName(), EndSign > 0.0f ? TEXT("positive") : TEXT("negative"), *Platform->GetName());
+			return;
+		}
+	}
+
+	FOANavLinkData& Link = Links.AddDefaulted_GetRef();
+	Link.Start = Docks[0];
+	Link.End = Docks[1];
+	Link.Type = EOANavLinkType::MovingPlatform;
+	Link.Source = Platform;
+}
+
+bool AOANavLinkCache::FindGround(const FVector& Location, float MaxDrop, const AActor* IgnoredActor, FVector& OutGround) const
+{
+	const FVector TraceStart = Location + FVector::UpVector * OANavLinks::GroundTraceHeight;
+	const FVector TraceEnd = Location - FVector::UpVector * MaxDrop;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(OANavLinkGround), false, IgnoredActor);
+
+	FHitResult Hit;
+	if (!GetWorld()->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Visibility, QueryParams)
+		|| Hit.ImpactNormal.Z < OANavLinks::MinWalkableNormalZ)
+	{
+		return false;
+	}
+
+	OutGround = Hit.ImpactPoint;
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////
+
+/** Rebuilds the nav link caches in the editor world, adding one if the level doesn't have one yet */
+static FAutoConsoleCommandWithWorldAndArgs CVarBuildNavLinks(
+	TEXT("OA.NavLinks.Build"),
+	TEXT("Rebuilds the jump pad and moving platform nav links for the current editor level. Save the level afterwards to keep them."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World || World->WorldType != EWorldType::Editor)
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("OA.NavLinks.Build must be run in the editor world."));
+			return;
+		}
+
+		TArray<AOANavLinkCache*> Caches;
+		for (TActorIterator<AOANavLinkCache> It(World); It; ++It)
+		{
+			Caches.Add(*It);
+		}
+
+		if (Caches.IsEmpty())
+		{
+			Caches.Add(World->SpawnActor<AOANavLinkCache>());
+		}
+
+		for (AOANavLinkCache* Cache : Caches)
+		{
+			Cache->BuildLinks();
+		}
+	})
+);
+
+#endif
@@ -0,0 +1,127 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AI/Navigation/NavRelevantInterface.h"
+#include "OANavLinkCache.generated.h"
+
+class AOAJumpPad;
+class AOAMovingPlatform;
+
+/** Obstacle a prebuilt nav link crosses */
+UENUM()
+enum class EOANavLinkType : uint8
+{
+	JumpPad,
+	MovingPlatform
+};
+
+/**
+ * A single prebuilt nav link.
+ * Jump pad links are one way, from the pad to a landing spot.
+ * Moving platform links go both ways, between the ground beyond each end of the platform path.
+ */
+USTRUCT()
+struct FOANavLinkData
+{
+	GENERATED_BODY()
+
+	/** World space link start */
+	UPROPERTY(VisibleAnywhere, Category = "Nav Link")
+	FVector Start = FVector::ZeroVector;
+
+	/** World space link end */
+	UPROPERTY(VisibleAnywhere, Category = "Nav Link")
+	FVector End = FVector::ZeroVector;
+
+	/** Obstacle type this link crosses */
+	UPROPERTY(VisibleAnywhere, Category = "Nav Link")
+	EOANavLinkType Type = EOANavLinkType::JumpPad;
+
+	/** Jump pad or moving platform this link was built from. Soft, since it may live in a World Partition cell that isn't loaded */
+	UPROPERTY(VisibleAnywhere, Category = "Nav Link")
+	TSoftObjectPtr<AActor> Source;
+};
+
+/**
+ * Holds nav links precomputed from the level's jump pads and moving platforms.
+ * Links are built in the editor with BuildLinks or the OA.NavLinks.Build console command,
+ * saved with the level and baked into the static navmesh, so moving obstacles never need
+ * a runtime navmesh rebuild. AI runners use UOAPathFollowingComponent to time platform boarding.
+ */
+UCLASS()
+class AOANavLinkCache : public AActor, public INavRelevantInterface
+{
+	GENERATED_BODY()
+
+public:
+
+	AOANavLinkCache();
+
+	/** INavRelevantInterface */
+	virtual void GetNavigationData(FNavigationRelevantData& Data) const override;
+	virtual FBox GetNavigationBounds() const override;
+	virtual bool IsNavigationRelevant() const override;
+
+	/** Returns the link connecting the two points in either direction, or nullptr if no link matches */
+	const FOANavLinkData* FindLink(const FVector& From, const FVector& To) const;
+
+	/** Returns all cached links */
+	const TArray<FOANavLinkData>& GetLinks() const { return Links; }
+
+	/** Returns the link matching the two points from any cache in the world */
+	static const FOANavLinkData* FindLinkInWorld(const UWorld* World, const FVector& From, const FVector& To);
+
+#if WITH_EDITOR
+
+	/** Rebuilds the links from the jump pads and moving platforms in this level and refreshes the navmesh */
+	UFUNCTION(CallInEditor, Category = "Nav Links")
+	void BuildLinks();
+
+#endif
+
+protected:
+
+	/** Precomputed links, saved with the level */
+	UPROPERTY(VisibleAnywhere, Category = "Nav Links")
+	TArray<FOANavLinkData> Links;
+
+	/** Horizontal speed runners carry onto a jump pad, used to predict where they land */
+	UPROPERTY(EditAnywhere, Category = "Nav Links|Jump Pads", meta = (ClampMin = "0.0", Units = "cm/s"))
+	float RunnerSpeed = 500.0f;
+
+	/** Number of launch directions sampled around each jump pad */
+	UPROPERTY(EditAnywhere, Category = "Nav Links|Jump Pads", meta = (ClampMin = "1", ClampMax = "32"))
+	int32 NumLaunchDirections = 8;
+
+	/** Landings must be at least this much higher than the pad to get a link. Lower spots are reachable on foot */
+	UPROPERTY(EditAnywhere, Category = "Nav Links|Jump Pads", meta = (ClampMin = "0.0", Units = "cm"))
+	float MinLaunchHeight = 100.0f;
+
+	/** Landings closer than this to an existing link end from the same pad are merged */
+	UPROPERTY(EditAnywhere, Category = "Nav Links|Jump Pads", meta = (ClampMin = "0.0", Units = "cm"))
+	float LandingMergeDistance = 150.0f;
+
+	/** Distance from the end of the platform to the link point on the ground beyond it */
+	UPROPERTY(EditAnywhere, Category = "Nav Links|Moving Platforms", meta = (ClampMin = "0.0", Units = "cm"))
+	float DockDistance = 75.0f;
+
+	/** Max distance between a path point and a link end for them to be matched at runtime */
+	UPROPERTY(EditAnywhere, Category = "Nav Links", meta = (ClampMin = "0.0", Units = "cm"))
+	float MatchTolerance = 60.0f;
+
+#if WITH_EDITOR
+
+	/** Simulates launches off the pad and adds a link for each distinct landing */
+	void BuildJumpPadLinks(AOAJumpPad* JumpPad);
+
+	/** Adds a link between the ground beyond both ends of the platform path */
+	void BuildMovingPlatformLinks(AOAMovingPlatform* Platform);
+
+	/** Traces down for walkable ground under the given point */
+	bool FindGround(const FVector& Location, float MaxDrop, const AActor* IgnoredActor, FVector& OutGround) const;
+
+#endif
+};
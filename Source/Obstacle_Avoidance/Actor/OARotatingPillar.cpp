@@ -6,6 +6,11 @@
 #include "Components/SceneComponent.h"
 #include "Engine/StaticMesh.h"
 #include "GameFramework/Character.h"
+#include "Obstacle_AvoidanceCharacter.h"
+#include "OATelemetrySubsystem.h"
+#include "OAFrameWatchdog.h"
+#include "OAObstacleStreamingSubsystem.h"
+#include "OAObstacleForceSubsystem.h"
 
 AOARotatingPillar::AOARotatingPillar()
 {
@@ -70,18 +75,78 @@ void AOARotatingPillar::BeginPlay()
 
 	UpdatePillarLayout();
 
+	CurrentYaw = RotatingRoot->GetRelativeRotation().Yaw;
+	PreviousYaw = CurrentYaw;
+	FixedTimestep.Reset();
+
 	HitCollision->OnComponentBeginOverlap.AddDynamic(this, &AOARotatingPillar::OnHitCollisionOverlapBegin);
+
+	// Let the physics thread sweep the arm if obstacle forces run there
+	if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+	{
+		FOAObstacleForceSettings Settings;
+		Settings.Type = EOAObstacleForceType::Knockback;
+		Settings.KnockbackForce = KnockbackForce;
+		Settings.bXYOverride = true;
+		Settings.bZOverride = true;
+		Settings.YawRate = bClockwise ? -RotationSpeed : RotationSpeed;
+		Settings.OnLaunch.BindUObject(this, &AOARotatingPillar::OnKnockback);
+
+		bAsyncForces = Forces->RegisterForceShape(HitCollision, Settings);
+	}
+
+	// Pick up where we left off if our cell was unloaded
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->RestoreObstacle(this);
+	}
+}
+
+void AOARotatingPillar::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->SaveObstacle(this, EndPlayReason);
+	}
+
+	if (UOAObstacleForceSubsystem* Forces = UOAObstacleForceSubsystem::Get(this))
+	{
+		Forces->UnregisterForceShapes(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AOARotatingPillar::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	OA_WATCHDOG_SCOPE("OARotatingPillar.Tick", this);
+
 	// Clockwise = negative yaw (top-down view)
 	const float Direction = bClockwise ? -1.0f : 1.0f;
-	const float DeltaYaw = RotationSpeed * Direction * DeltaTime;
 
-	RotatingRoot->AddRelativeRotation(FRotator(0.0f, DeltaYaw, 0.0f));
+	// Run the fixed simulation steps for this frame
+	const int32 NumSteps = FixedTimestep.Advance(DeltaTime);
+
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		PreviousYaw = CurrentYaw;
+		CurrentYaw += RotationSpeed * Direction * FixedTimestep.GetStepTime();
+	}
+
+	// Keep the yaw bounded, shifting both states so interpolation is unaffected
+	if (FMath::Abs(CurrentYaw) > 360.0f)
+	{
+		const float Wrap = 360.0f * FMath::Sign(CurrentYaw);
+		CurrentYaw -= Wrap;
+		PreviousYaw -= Wrap;
+	}
+
+	// Interpolate between the last two steps for rendering
+	const float VisualYaw = FMath::Lerp(PreviousYaw, CurrentYaw, FixedTimestep.GetAlpha());
+
+	RotatingRoot->SetRelativeRotation(FRotator(0.0f, VisualYaw, 0.0f));
 }
 
 #if WITH_EDITOR
@@ -115,20 +180,47 @@ void AOARotatingPillar::OnHitCollisionOverlapBegin(UPrimitiveComponent* Overlapp
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
 	bool bFromSweep, const FHitResult& SweepResult)
 {
+	// the async physics callback handles knockbacks when it's running
+	if (bAsyncForces)
+	{
+		return;
+	}
+
 	ACharacter* HitCharacter = Cast<ACharacter>(OtherActor);
 	if (!HitCharacter)
 	{
 		return;
 	}
 
-	// Knockback direction: from pillar center outward toward player
-	const FVector PillarLocation = GetActorLocation();
-	const FVector PlayerLocation = HitCharacter->GetActorLocation();
-	FVector KnockbackDirection = (PlayerLocation - PillarLocation).GetSafeNormal2D();
+	// Knockback from pillar center outward toward player
+	HitCharacter->LaunchCharacter(UOAObstacleForceSubsystem::GetKnockbackVelocity(GetActorLocation(), HitCharacter->GetActorLocation(), KnockbackForce), true, true);
+
+	OnKnockback(HitCharacter);
+}
+
+void AOARotatingPillar::OnKnockback(ACharacter* HitCharacter)
+{
+	UOATelemetrySubsystem::Record(this, EOATelemetryEventType::Knockback, HitCharacter->GetActorLocation(), UOATelemetrySubsystem::GetCauseName(this));
+
+	if (AObstacle_AvoidanceCharacter* OACharacter = Cast<AObstacle_AvoidanceCharacter>(HitCharacter))
+	{
+		OACharacter->NotifyObstacleHit(this);
+	}
+}
+
+void AOARotatingPillar::SaveStreamingState(FOAObstacleStreamingState& OutState) const
+{
+	OutState.Phase = CurrentYaw;
+}
+
+void AOARotatingPillar::RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime)
+{
+	// Advance the arm by the time spent unloaded
+	const float Direction = bClockwise ? -1.0f : 1.0f;
 
-	// Add slight upward component for natural knockback feel
-	KnockbackDirection.Z = 0.3f;
-	KnockbackDirection.Normalize();
+	CurrentYaw = FMath::Fmod(State.Phase + RotationSpeed * Direction * ElapsedTime, 360.0f);
+	PreviousYaw = CurrentYaw;
+	FixedTimestep.Reset();
 
-	HitCharacter->LaunchCharacter(KnockbackDirection * KnockbackForce, true, true);
+	RotatingRoot->SetRelativeRotation(FRotator(0.0f, CurrentYaw, 0.0f));
 }
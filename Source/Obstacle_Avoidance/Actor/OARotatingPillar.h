@@ -4,19 +4,25 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "OAFixedTimestep.h"
+#include "OAStreamableObstacle.h"
 #include "OARotatingPillar.generated.h"
 
 class UStaticMeshComponent;
 class UBoxComponent;
+class ACharacter;
 class USceneComponent;
 
 /**
  * Rotating pillar obstacle.
  * A ground pillar with a horizontal arm on top that rotates around Z-axis.
  * Forms an "ㄱ" shape. Pushes the player on overlap.
+ * Rotation is simulated at a fixed timestep and interpolated for rendering.
+ * Knockbacks move to the async physics callback when UOAObstacleForceSubsystem is running.
+ * Keeps its arm angle across World Partition cell unloads.
  */
 UCLASS()
-class AOARotatingPillar : public AActor
+class AOARotatingPillar : public AActor, public IOAStreamableObstacle
 {
 	GENERATED_BODY()
 
@@ -26,6 +32,11 @@ public:
 
 	virtual void Tick(float DeltaTime) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** IOAStreamableObstacle */
+	virtual void SaveStreamingState(FOAObstacleStreamingState& OutState) const override;
+	virtual void RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime) override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -75,9 +86,24 @@ protected:
 
 private:
 
+	/** Fixed timestep accumulator */
+	FOAFixedTimestep FixedTimestep;
+
+	/** Arm yaw at the current simulation step */
+	float CurrentYaw = 0.0f;
+
+	/** Arm yaw at the previous simulation step */
+	float PreviousYaw = 0.0f;
+
+	/** True if knockbacks are applied from the async physics callback */
+	bool bAsyncForces = false;
+
 	/** Update component transforms based on current property values. */
 	void UpdatePillarLayout();
 
+	/** Records the hit on a character we're knocking back */
+	void OnKnockback(ACharacter* HitCharacter);
+
 	UFUNCTION()
 	void OnHitCollisionOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "OAStreamableObstacle.generated.h"
+
+/**
+ * Runtime state an obstacle keeps while its World Partition cell is unloaded
+ */
+struct FOAObstacleStreamingState
+{
+	/** Obstacle specific phase, e.g. distance along a path, arm yaw or time into a cycle */
+	float Phase = 0.0f;
+
+	/** Direction of travel for obstacles that move back and forth */
+	float Direction = 1.0f;
+
+	/** Obstacle specific on/off state */
+	bool bActive = false;
+
+	/** World time the state was saved at */
+	double SaveTime = 0.0;
+};
+
+/**
+ * Streamable Obstacle Interface
+ * Lets obstacles carry their phase and state across World Partition cell unloads.
+ * State is saved when the cell unloads and restored, advanced by the time spent unloaded, when it loads again.
+ */
+UINTERFACE(MinimalAPI, NotBlueprintable)
+class UOAStreamableObstacle : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class IOAStreamableObstacle
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Writes the obstacle's current phase and state */
+	virtual void SaveStreamingState(FOAObstacleStreamingState& OutState) const = 0;
+
+	/** Restores a saved state, advanced by the time the obstacle spent unloaded */
+	virtual void RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime) = 0;
+};
@@ -6,6 +6,21 @@
 #include "Engine/StaticMesh.h"
 #include "GameFramework/Character.h"
 #include "TimerManager.h"
+#include "Obstacle_AvoidanceCharacter.h"
+#include "OAFrameWatchdog.h"
+#include "OAObstacleStreamingSubsystem.h"
+
+namespace OATrapFloor
+{
+	/** Downward acceleration of a falling platform (cm/s²) */
+	constexpr float FallGravity = 980.0f;
+
+	/** Distance a platform falls before it's hidden (cm) */
+	constexpr float FallDistance = 1000.0f;
+
+	/** Time a platform takes to fall out of sight */
+	const float FallDuration = FMath::Sqrt(2.0f * FallDistance / FallGravity);
+}
 
 AOATrapFloor::AOATrapFloor()
 {
@@ -51,30 +66,56 @@ void AOATrapFloor::BeginPlay()
 
 	InitialLocation = GetActorLocation();
 	OverlapBox->OnComponentBeginOverlap.AddDynamic(this, &AOATrapFloor::OnOverlapBegin);
+
+	// Pick up where we left off if our cell was unloaded
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->RestoreObstacle(this);
+	}
+}
+
+void AOATrapFloor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(this))
+	{
+		Streaming->SaveObstacle(this, EndPlayReason);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AOATrapFloor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	OA_WATCHDOG_SCOPE("OATrapFloor.Tick", this);
+
 	if (!bIsFalling)
 	{
 		return;
 	}
 
-	// Accelerate downward (gravity: 980 cm/s²)
-	FallSpeed += 980.0f * DeltaTime;
-	const float DeltaFall = FallSpeed * DeltaTime;
-	AddActorWorldOffset(FVector(0.0f, 0.0f, -DeltaFall));
+	// Run the fixed simulation steps for this frame
+	const int32 NumSteps = FixedTimestep.Advance(DeltaTime);
+	const float StepTime = FixedTimestep.GetStepTime();
 
-	FallDistance += DeltaFall;
-	if (FallDistance > 1000.0f)
+	for (int32 Step = 0; Step < NumSteps; ++Step)
+	{
+		PreviousFallDistance = FallDistance;
+
+		// Accelerate downward
+		FallSpeed += OATrapFloor::FallGravity * StepTime;
+		FallDistance += FallSpeed * StepTime;
+	}
+
+	// Interpolate between the last two steps for rendering
+	const float VisualFallDistance = FMath::Lerp(PreviousFallDistance, FallDistance, FixedTimestep.GetAlpha());
+	SetActorLocation(InitialLocation - FVector(0.0f, 0.0f, VisualFallDistance));
+
+	if (FallDistance > OATrapFloor::FallDistance)
 	{
 		// Hide and schedule respawn instead of destroying
-		SetActorHiddenInGame(true);
-		SetActorEnableCollision(false);
-		SetActorTickEnabled(false);
-		bIsFalling = false;
+		HidePlatform();
 
 		GetWorldTimerManager().SetTimer(
 			RespawnTimerHandle, this, &AOATrapFloor::RespawnPlatform,
@@ -103,16 +144,29 @@ void AOATrapFloor::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AAct
 
 void AOATrapFloor::StartFalling()
 {
+	OA_WATCHDOG_SCOPE("OATrapFloor.StartFalling", this);
+
+	// Anyone still standing on the platform falls because of us
+	TArray<AActor*> StandingActors;
+	OverlapBox->GetOverlappingActors(StandingActors, AObstacle_AvoidanceCharacter::StaticClass());
+	for (AActor* StandingActor : StandingActors)
+	{
+		CastChecked<AObstacle_AvoidanceCharacter>(StandingActor)->NotifyObstacleHit(this);
+	}
+
 	// Disable collision so the player falls through
 	PlatformMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	OverlapBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	bIsFalling = true;
+	FixedTimestep.Reset();
 	SetActorTickEnabled(true);
 }
 
 void AOATrapFloor::RespawnPlatform()
 {
+	OA_WATCHDOG_SCOPE("OATrapFloor.Respawn", this);
+
 	// Reset position and state
 	SetActorLocation(InitialLocation);
 	SetActorHiddenInGame(false);
@@ -125,4 +179,69 @@ void AOATrapFloor::RespawnPlatform()
 	bIsFalling = false;
 	FallSpeed = 0.0f;
 	FallDistance = 0.0f;
+	PreviousFallDistance = 0.0f;
+}
+
+void AOATrapFloor::HidePlatform()
+{
+	PlatformMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	OverlapBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+	bIsFalling = false;
+}
+
+void AOATrapFloor::SaveStreamingState(FOAObstacleStreamingState& OutState) const
+{
+	OutState.bActive = bTriggered;
+
+	if (!bTriggered)
+	{
+		return;
+	}
+
+	// Save the time left until the platform is back in place
+	const FTimerManager& TimerManager = GetWorldTimerManager();
+
+	if (TimerManager.IsTimerActive(FallTimerHandle))
+	{
+		OutState.Phase = TimerManager.GetTimerRemaining(FallTimerHandle) + OATrapFloor::FallDuration + RespawnDelay;
+	}
+	else if (bIsFalling)
+	{
+		const float TimeFalling = FMath::Sqrt(2.0f * FallDistance / OATrapFloor::FallGravity);
+		OutState.Phase = FMath::Max(0.0f, OATrapFloor::FallDuration - TimeFalling) + RespawnDelay;
+	}
+	else
+	{
+		OutState.Phase = FMath::Max(0.0f, TimerManager.GetTimerRemaining(RespawnTimerHandle));
+	}
+}
+
+void AOATrapFloor::RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime)
+{
+	// A freshly loaded platform is already in its respawned state
+	const float TimeToRespawn = State.Phase - ElapsedTime;
+
+	if (!State.bActive || TimeToRespawn <= 0.0f)
+	{
+		return;
+	}
+
+	bTriggered = true;
+
+	// Still counting down to the collapse
+	const float TimeToFall = TimeToRespawn - OATrapFloor::FallDuration - RespawnDelay;
+
+	if (TimeToFall > 0.0f)
+	{
+		GetWorldTimerManager().SetTimer(FallTimerHandle, this, &AOATrapFloor::StartFalling, TimeToFall, false);
+		return;
+	}
+
+	// Nobody was close enough to watch it fall, so skip straight to waiting for the respawn
+	HidePlatform();
+	GetWorldTimerManager().SetTimer(RespawnTimerHandle, this, &AOATrapFloor::RespawnPlatform, TimeToRespawn, false);
 }
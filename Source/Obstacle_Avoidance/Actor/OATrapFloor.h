@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "OAFixedTimestep.h"
+#include "OAStreamableObstacle.h"
 #include "OATrapFloor.generated.h"
 
 class UStaticMeshComponent;
@@ -13,9 +15,11 @@ class UBoxComponent;
  * Trap floor obstacle.
  * A walkable platform that collapses after the player steps on it.
  * Falls away after a configurable delay.
+ * The fall is simulated at a fixed timestep and interpolated for rendering.
+ * Keeps its collapse and respawn countdown across World Partition cell unloads.
  */
 UCLASS()
-class AOATrapFloor : public AActor
+class AOATrapFloor : public AActor, public IOAStreamableObstacle
 {
 	GENERATED_BODY()
 
@@ -25,6 +29,11 @@ public:
 
 	virtual void Tick(float DeltaTime) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** IOAStreamableObstacle */
+	virtual void SaveStreamingState(FOAObstacleStreamingState& OutState) const override;
+	virtual void RestoreStreamingState(const FOAObstacleStreamingState& State, float ElapsedTime) override;
 
 protected:
 
@@ -54,6 +63,9 @@ private:
 	bool bIsFalling = false;
 	float FallSpeed = 0.0f;
 	float FallDistance = 0.0f;
+	float PreviousFallDistance = 0.0f;
+
+	FOAFixedTimestep FixedTimestep;
 
 	FVector InitialLocation = FVector::ZeroVector;
 
@@ -67,4 +79,7 @@ private:
 
 	void StartFalling();
 	void RespawnPlatform();
+
+	/** Hides the platform and disables its collision after it has fallen away */
+	void HidePlatform();
 };
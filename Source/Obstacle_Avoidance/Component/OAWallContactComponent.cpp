@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAWallContactComponent.h"
+#include "GameFramework/Actor.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cached Wall Contacts"), STAT_OAWallContactCached, STATGROUP_OAWallContact);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Wall Sweeps"), STAT_OAWallContactSweeps, STATGROUP_OAWallContact);
+
+UOAWallContactComponent::UOAWallContactComponent()
+{
+	// contacts are pushed to us by movement, so we never need to tick
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UOAWallContactComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// capsule sweeps during movement report their blocking hits to the owner
+	GetOwner()->OnActorHit.AddDynamic(this, &UOAWallContactComponent::OnOwnerHit);
+}
+
+void UOAWallContactComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetOwner()->OnActorHit.RemoveDynamic(this, &UOAWallContactComponent::OnOwnerHit);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool UOAWallContactComponent::FindWall(const FVector& Direction, float TraceDistance, float TraceRadius, FHitResult& OutHit)
+{
+	const FVector Start = GetOwner()->GetActorLocation();
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// can we reuse the last wall we ran into?
+	if (GetCachedWall(Start, Direction, TraceDistance + TraceRadius, CurrentTime, OutHit))
+	{
+		INC_DWORD_STAT(STAT_OAWallContactCached);
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_OAWallContactSweeps);
+
+	const FVector End = Start + (Direction.GetSafeNormal() * TraceDistance);
+
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(GetOwner());
+
+	bool bHit = false;
+
+	if (TraceRadius > 0.0f)
+	{
+		bHit = GetWorld()->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity, WallChannel, FCollisionShape::MakeSphere(TraceRadius), QueryParams);
+	}
+	else
+	{
+		bHit = GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, WallChannel, QueryParams);
+	}
+
+	// keep the result around for the next check
+	if (bHit)
+	{
+		CachedHit = OutHit;
+		CachedHitTime = CurrentTime;
+		bHasCachedHit = true;
+	}
+
+	return bHit;
+}
+
+void UOAWallContactComponent::RecordImpact(const FHitResult& Hit, double Time)
+{
+	// ignore floors, ceilings and anything the wall checks wouldn't see
+	if (!Hit.bBlockingHit || !IsWallNormal(Hit.ImpactNormal))
+	{
+		return;
+	}
+
+	if (const UPrimitiveComponent* HitComponent = Hit.GetComponent())
+	{
+		if (HitComponent->GetCollisionResponseToChannel(WallChannel) != ECR_Block)
+		{
+			return;
+		}
+	}
+
+	CachedHit = Hit;
+	CachedHitTime = Time;
+	bHasCachedHit = true;
+}
+
+bool UOAWallContactComponent::GetCachedWall(const FVector& Location, const FVector& Direction, float Reach, double Time, FHitResult& OutHit) const
+{
+	if (!bHasCachedHit || Time - CachedHitTime > MaxContactAge)
+	{
+		return false;
+	}
+
+	// are we still facing into the wall?
+	if (FVector::DotProduct(Direction.GetSafeNormal(), -CachedHit.ImpactNormal) < MinFacingDot)
+	{
+		return false;
+	}
+
+	// are we still within reach of the wall plane?
+	const float WallDistance = FVector::PointPlaneDist(Location, CachedHit.ImpactPoint, CachedHit.ImpactNormal);
+
+	if (WallDistance < 0.0f || WallDistance > Reach)
+	{
+		return false;
+	}
+
+	OutHit = CachedHit;
+	return true;
+}
+
+void UOAWallContactComponent::ClearContact()
+{
+	bHasCachedHit = false;
+}
+
+void UOAWallContactComponent::NotifyMovementModeChanged(EMovementMode NewMovementMode)
+{
+	// contacts from the previous jump don't carry over once we're grounded
+	if (NewMovementMode != MOVE_Falling)
+	{
+		ClearContact();
+	}
+}
+
+void UOAWallContactComponent::OnOwnerHit(AActor* SelfActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit)
+{
+	RecordImpact(Hit, GetWorld()->GetTimeSeconds());
+}
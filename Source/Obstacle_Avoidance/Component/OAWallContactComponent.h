@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/HitResult.h"
+#include "Stats/Stats.h"
+#include "OAWallContactComponent.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("OAWallContact"), STATGROUP_OAWallContact, STATCAT_Advanced);
+
+/**
+ *  Shared wall detection for wall jumping characters.
+ *  Caches the last wall the owner's capsule ran into during movement and reuses it
+ *  for wall jump checks while it's recent and still within reach.
+ *  Only sweeps for walls when the cached contact is stale.
+ *  Use "stat OAWallContact" to compare cached contacts against sweeps.
+ */
+UCLASS()
+class UOAWallContactComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Max age of a cached wall contact before a sweep is needed */
+	UPROPERTY(EditAnywhere, Category="Wall Contact", meta = (ClampMin = 0, ClampMax = 1, Units = "s"))
+	float MaxContactAge = 0.15f;
+
+	/** Max absolute Z of an impact normal to count as a wall */
+	UPROPERTY(EditAnywhere, Category="Wall Contact", meta = (ClampMin = 0, ClampMax = 1))
+	float MaxWallNormalZ = 0.3f;
+
+	/** Min alignment between the check direction and the direction into the wall to reuse a cached contact */
+	UPROPERTY(EditAnywhere, Category="Wall Contact", meta = (ClampMin = 0, ClampMax = 1))
+	float MinFacingDot = 0.5f;
+
+	/** Collision channel walls must block */
+	UPROPERTY(EditAnywhere, Category="Wall Contact")
+	TEnumAsByte<ECollisionChannel> WallChannel = ECC_Visibility;
+
+	/** Last wall contact */
+	FHitResult CachedHit;
+
+	/** Time the last wall contact was recorded */
+	double CachedHitTime = 0.0;
+
+	/** True if CachedHit holds a wall contact */
+	bool bHasCachedHit = false;
+
+public:
+
+	/** Constructor */
+	UOAWallContactComponent();
+
+	/** Starts listening to the owner's movement impacts */
+	virtual void BeginPlay() override;
+
+	/** Stops listening to the owner's movement impacts */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 *  Looks for a wall in front of the owner along the provided direction.
+	 *  Uses the cached wall contact if possible, otherwise sweeps a sphere of the given radius, or a line if the radius is zero.
+	 */
+	bool FindWall(const FVector& Direction, float TraceDistance, float TraceRadius, FHitResult& OutHit);
+
+	/** Records a movement impact, keeping it if it's a wall */
+	void RecordImpact(const FHitResult& Hit, double Time);
+
+	/** Returns the cached wall contact if it's still usable from the provided location and direction at the given time */
+	bool GetCachedWall(const FVector& Location, const FVector& Direction, float Reach, double Time, FHitResult& OutHit) const;
+
+	/** Drops the cached wall contact. Call after consuming it for a wall jump */
+	void ClearContact();
+
+	/** Drops the cached wall contact once the owner is back on the ground */
+	void NotifyMovementModeChanged(EMovementMode NewMovementMode);
+
+	/** Returns true if the impact normal counts as a wall */
+	bool IsWallNormal(const FVector& Normal) const { return FMath::Abs(Normal.Z) <= MaxWallNormalZ; }
+
+protected:
+
+	/** Handles blocking hits from the owner's movement */
+	UFUNCTION()
+	void OnOwnerHit(AActor* SelfActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit);
+};
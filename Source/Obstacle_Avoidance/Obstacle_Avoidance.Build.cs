@@ -18,15 +18,20 @@ public class Obstacle_Avoidance : ModuleRules
 			"StateTreeModule",
 			"GameplayStateTreeModule",
 			"UMG",
-			"Slate"
+			"Slate",
+			"SlateCore"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] { "AnimationBudgetAllocator", "Chaos", "PhysicsCore" });
 
 		PublicIncludePaths.AddRange(new string[] {
 			"Obstacle_Avoidance",
 			"Obstacle_Avoidance/Actor",
+			"Obstacle_Avoidance/AI",
+			"Obstacle_Avoidance/Component",
 			"Obstacle_Avoidance/GameMode",
+			"Obstacle_Avoidance/Subsystem",
+			"Obstacle_Avoidance/Telemetry",
 			"Obstacle_Avoidance/Variant_Platforming",
 			"Obstacle_Avoidance/Variant_Platforming/Animation",
 			"Obstacle_Avoidance/Variant_Combat",
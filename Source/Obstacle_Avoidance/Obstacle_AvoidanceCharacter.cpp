@@ -14,6 +14,8 @@
 #include "InputMappingContext.h"
 #include "Animation/AnimMontage.h"
 #include "Obstacle_Avoidance.h"
+#include "OATelemetrySubsystem.h"
+#include "OAFrameWatchdog.h"
 
 void AObstacle_AvoidanceCharacter::BeginPlay()
 {
@@ -72,6 +74,8 @@ AObstacle_AvoidanceCharacter::AObstacle_AvoidanceCharacter()
 
 void AObstacle_AvoidanceCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
+	OA_WATCHDOG_SCOPE("Character.LoadInputAssets", this);
+
 	// Blueprint에서 미할당된 에셋을 런타임 로드 (Live Coding 후 Blueprint 미갱신 대응)
 	if (!JumpAction)
 	{
@@ -223,6 +227,16 @@ void AObstacle_AvoidanceCharacter::DoJumpEnd()
 	StopJumping();
 }
 
+void AObstacle_AvoidanceCharacter::DoDashStart()
+{
+	StartDash();
+}
+
+void AObstacle_AvoidanceCharacter::DoSlideStart()
+{
+	StartSlide();
+}
+
 // ── Airborne Die ──
 
 void AObstacle_AvoidanceCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode)
@@ -251,6 +265,12 @@ void AObstacle_AvoidanceCharacter::OnMovementModeChanged(EMovementMode PrevMovem
 
 // ── Death ──
 
+void AObstacle_AvoidanceCharacter::NotifyObstacleHit(AActor* Obstacle)
+{
+	LastObstacleHit = Obstacle;
+	LastObstacleHitTime = GetWorld()->GetTimeSeconds();
+}
+
 void AObstacle_AvoidanceCharacter::Die()
 {
 	if (bIsDead)
@@ -260,6 +280,22 @@ void AObstacle_AvoidanceCharacter::Die()
 
 	bIsDead = true;
 
+	OA_WATCHDOG_SCOPE("Character.Die", this);
+
+	// Attribute the death to a recent obstacle hit, or to how we died
+	FName DeathCause;
+	if (LastObstacleHit.IsValid() && GetWorld()->GetTimeSeconds() - LastObstacleHitTime <= DeathCauseWindow)
+	{
+		DeathCause = UOATelemetrySubsystem::GetCauseName(LastObstacleHit.Get());
+	}
+	else
+	{
+		DeathCause = GetActorLocation().Z < StartLocation.Z - FallDeathHeight ? FName(TEXT("Fall")) : FName(TEXT("Airborne"));
+	}
+
+	UOATelemetrySubsystem::Record(this, EOATelemetryEventType::Death, GetActorLocation(), DeathCause);
+	LastObstacleHit.Reset();
+
 	// Reset action states
 	bIsDashing = false;
 	bIsSliding = false;
@@ -292,6 +328,8 @@ void AObstacle_AvoidanceCharacter::Die()
 
 void AObstacle_AvoidanceCharacter::Respawn()
 {
+	OA_WATCHDOG_SCOPE("Character.Respawn", this);
+
 	bIsDead = false;
 	bIsDashing = false;
 	bIsSliding = false;
@@ -308,12 +346,22 @@ void AObstacle_AvoidanceCharacter::Respawn()
 	GetCharacterMovement()->GroundFriction = DefaultGroundFriction;
 	GetCharacterMovement()->BrakingDecelerationWalking = DefaultBrakingDeceleration;
 
+	UOATelemetrySubsystem::Record(this, EOATelemetryEventType::Respawn, StartLocation, NAME_None);
+
 	// Teleport to start location
 	SetActorLocation(StartLocation);
 	SetActorRotation(StartRotation);
 
-	// Re-enable movement
-	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+	// Re-enable movement, holding the character in place if its World Partition cell is still streaming in
+	if (HasRespawnGround())
+	{
+		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+	}
+	else
+	{
+		GetCharacterMovement()->SetMovementMode(MOVE_None);
+		GetWorldTimerManager().SetTimer(RespawnGroundTimer, this, &AObstacle_AvoidanceCharacter::WaitForRespawnGround, RespawnGroundCheckInterval, true);
+	}
 
 	// Re-enable input and reset camera
 	APlayerController* PC = Cast<APlayerController>(GetController());
@@ -324,11 +372,31 @@ void AObstacle_AvoidanceCharacter::Respawn()
 	}
 }
 
+bool AObstacle_AvoidanceCharacter::HasRespawnGround() const
+{
+	// any floor above the fall death height will do
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(OARespawnGround), false, this);
+	FHitResult Hit;
+
+	return GetWorld()->LineTraceSingleByChannel(Hit, StartLocation, StartLocation - FVector(0.0f, 0.0f, FallDeathHeight), ECC_Visibility, QueryParams);
+}
+
+void AObstacle_AvoidanceCharacter::WaitForRespawnGround()
+{
+	if (bIsDead || !HasRespawnGround())
+	{
+		return;
+	}
+
+	GetWorldTimerManager().ClearTimer(RespawnGroundTimer);
+	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+}
+
 // ── Dash ──
 
 void AObstacle_AvoidanceCharacter::StartDash()
 {
-	UE_LOG(LogObstacle_Avoidance, Warning, TEXT("StartDash called! bCanDash=%d, bIsDashing=%d, bIsSliding=%d, OnGround=%d, DashMontage=%s"),
+	UE_LOG(LogObstacle_Avoidance, Verbose, TEXT("StartDash called! bCanDash=%d, bIsDashing=%d, bIsSliding=%d, OnGround=%d, DashMontage=%s"),
 		bCanDash, bIsDashing, bIsSliding,
 		GetCharacterMovement()->IsMovingOnGround(),
 		DashMontage ? *GetNameSafe(DashMontage) : TEXT("NULL"));
@@ -360,6 +428,8 @@ void AObstacle_AvoidanceCharacter::StartDash()
 	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
 	if (AnimInstance)
 	{
+		OA_WATCHDOG_SCOPE("Character.PlayDashMontage", this);
+
 		AnimInstance->Montage_Play(DashMontage);
 
 		FOnMontageEnded EndDelegate;
@@ -430,6 +500,8 @@ void AObstacle_AvoidanceCharacter::StartSlide()
 	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
 	if (AnimInstance)
 	{
+		OA_WATCHDOG_SCOPE("Character.PlaySlideMontage", this);
+
 		AnimInstance->Montage_Play(SlideMontage);
 
 		FOnMontageEnded EndDelegate;
@@ -475,6 +547,8 @@ void AObstacle_AvoidanceCharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	OA_WATCHDOG_SCOPE("Character.Tick", this);
+
 	// 시작 위치 Z 기준 FallDeathHeight 이하로 떨어지면 즉시 사망
 	if (!bIsDead && GetActorLocation().Z < StartLocation.Z - FallDeathHeight)
 	{
@@ -112,6 +112,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Death")
 	float FallDeathHeight = 1000.f;
 
+	/** Time after an obstacle hit during which a death is attributed to that obstacle */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Death", meta = (ClampMin = 0, Units = "s"))
+	float DeathCauseWindow = 3.f;
+
+	/** Time between checks for the floor under the start location while it streams back in after a respawn */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Death", meta = (ClampMin = 0, Units = "s"))
+	float RespawnGroundCheckInterval = 0.1f;
+
 public:
 
 	/** Constructor */
@@ -124,6 +132,9 @@ public:
 	/** 점프 패드에 의한 공중 상태임을 표시 (공중 사망 타이머 제외용) */
 	void SetJumpPadLaunched() { bJumpPadLaunched = true; }
 
+	/** Records an obstacle hit, so a following death can be attributed to it */
+	void NotifyObstacleHit(AActor* Obstacle);
+
 	/** Kill the character — disables movement and input, plays death montage. */
 	UFUNCTION(BlueprintCallable, Category = "State")
 	virtual void Die();
@@ -157,6 +168,14 @@ protected:
 	void OnSlideMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 	void FinishSlideRecovery();
 
+	// ── Respawn ──
+
+	/** Returns true if there's a floor under the start location to respawn onto */
+	bool HasRespawnGround() const;
+
+	/** Re-enables movement once the floor under the start location has streamed in */
+	void WaitForRespawnGround();
+
 public:
 
 	/** Handles move inputs from either controls or UI interfaces */
@@ -175,6 +194,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Input")
 	virtual void DoJumpEnd();
 
+	/** Handles dash inputs from either controls, UI interfaces or AI */
+	UFUNCTION(BlueprintCallable, Category="Input")
+	virtual void DoDashStart();
+
+	/** Handles slide inputs from either controls, UI interfaces or AI */
+	UFUNCTION(BlueprintCallable, Category="Input")
+	virtual void DoSlideStart();
+
 public:
 
 	/** Returns CameraBoom subobject **/
@@ -206,8 +233,13 @@ private:
 	FTimerHandle SlideCooldownTimer;
 	FTimerHandle SlideRecoveryTimer;
 	FTimerHandle AirborneDieTimer;
+	FTimerHandle RespawnGroundTimer;
 
 	FVector StartLocation = FVector::ZeroVector;
 	FRotator StartRotation = FRotator::ZeroRotator;
+
+	/** Last obstacle that hit the character, for death attribution */
+	TWeakObjectPtr<AActor> LastObstacleHit;
+	float LastObstacleHitTime = -1.f;
 };
 
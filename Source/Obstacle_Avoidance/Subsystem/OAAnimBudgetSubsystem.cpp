@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAAnimBudgetSubsystem.h"
+#include "Engine/World.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "IAnimationBudgetAllocator.h"
+
+bool UOAAnimBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UOAAnimBudgetSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// budget parameters come from the a.Budget.* console variables
+	if (IAnimationBudgetAllocator* Allocator = IAnimationBudgetAllocator::Get(&InWorld))
+	{
+		Allocator->SetEnabled(true);
+	}
+}
+
+void UOAAnimBudgetSubsystem::ConfigureBudgetedMesh(USkeletalMeshComponent* Mesh)
+{
+	if (USkeletalMeshComponentBudgeted* BudgetedMesh = Cast<USkeletalMeshComponentBudgeted>(Mesh))
+	{
+		// let the allocator rank this mesh by its distance to the view
+		BudgetedMesh->SetAutoRegisterWithBudgetAllocator(true);
+		BudgetedMesh->SetAutoCalculateSignificance(true);
+	}
+
+	// off-screen characters still need montage notifies to drive their AI, and attack traces read
+	// socket transforms, so refresh bones while a montage plays and skip pose work the rest of the time
+	Mesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesAndRefreshBonesWhenPlayingMontages;
+}
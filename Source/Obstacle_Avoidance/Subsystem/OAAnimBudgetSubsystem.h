@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "OAAnimBudgetSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ *  Enables the animation budget allocator for game worlds.
+ *  Crowd characters created with a USkeletalMeshComponentBudgeted mesh are then ticked at a rate
+ *  based on their significance (distance to the view), interpolated between skipped frames,
+ *  and kept within a global per-frame animation time budget (a.Budget.BudgetMs).
+ */
+UCLASS()
+class UOAAnimBudgetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Enables the budget allocator for this world */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** Sets up a character mesh to be managed by the budget allocator. Call from the character's constructor */
+	static void ConfigureBudgetedMesh(USkeletalMeshComponent* Mesh);
+};
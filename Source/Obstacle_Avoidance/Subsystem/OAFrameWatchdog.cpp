@@ -0,0 +1,218 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAFrameWatchdog.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/World.h"
+#include "Obstacle_Avoidance.h"
+
+static TAutoConsoleVariable<bool> CVarOAWatchdogEnabled(
+	TEXT("OA.Watchdog.Enabled"),
+	false,
+	TEXT("If true, the frame watchdog records obstacle and character timings and dumps them on frame spikes. Also enabled with -OAWatchdog."));
+
+static TAutoConsoleVariable<float> CVarOAWatchdogThresholdMs(
+	TEXT("OA.Watchdog.ThresholdMs"),
+	50.0f,
+	TEXT("Frames longer than this many milliseconds count as spikes."));
+
+static TAutoConsoleVariable<int32> CVarOAWatchdogHistoryFrames(
+	TEXT("OA.Watchdog.HistoryFrames"),
+	60,
+	TEXT("Number of recent frames kept and dumped when a spike happens."));
+
+static TAutoConsoleVariable<float> CVarOAWatchdogDumpCooldown(
+	TEXT("OA.Watchdog.DumpCooldown"),
+	5.0f,
+	TEXT("Min time between spike dumps, in seconds, so a long stall doesn't flood the disk."));
+
+UOAFrameWatchdogSubsystem* UOAFrameWatchdogSubsystem::Instance = nullptr;
+
+void UOAFrameWatchdogSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// allow enabling from the command line for automated runs
+	if (FParse::Param(FCommandLine::Get(), TEXT("OAWatchdog")))
+	{
+		CVarOAWatchdogEnabled->Set(true, ECVF_SetByCommandline);
+	}
+
+	Instance = this;
+
+	BeginFrameHandle = FCoreDelegates::OnBeginFrame.AddUObject(this, &UOAFrameWatchdogSubsystem::OnBeginFrame);
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UOAFrameWatchdogSubsystem::OnPreLoadMap);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UOAFrameWatchdogSubsystem::OnPostLoadMap);
+}
+
+void UOAFrameWatchdogSubsystem::Deinitialize()
+{
+	FCoreDelegates::OnBeginFrame.Remove(BeginFrameHandle);
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+
+	if (Instance == this)
+	{
+		Instance = nullptr;
+	}
+
+	Super::Deinitialize();
+}
+
+void UOAFrameWatchdogSubsystem::EndScope(const TCHAR* Label, FName Context, float DurationMs, uint8 Depth)
+{
+	ScopeDepth = Depth;
+
+	if (Frames.IsValidIndex(CurrentFrameIndex))
+	{
+		FOAWatchdogScopeRecord& Record = Frames[CurrentFrameIndex].Scopes.AddDefaulted_GetRef();
+		Record.Label = Label;
+		Record.Context = Context;
+		Record.DurationMs = DurationMs;
+		Record.Depth = Depth;
+	}
+}
+
+void UOAFrameWatchdogSubsystem::OnBeginFrame()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	// close the previous frame and check it for a spike
+	if (bRecording && Frames.IsValidIndex(CurrentFrameIndex))
+	{
+		FOAWatchdogFrame& Frame = Frames[CurrentFrameIndex];
+		Frame.DurationMs = (Now - Frame.StartSeconds) * 1000.0;
+
+		if (Frame.DurationMs > CVarOAWatchdogThresholdMs.GetValueOnGameThread())
+		{
+			++NumSpikes;
+
+			if (Now - LastDumpSeconds >= CVarOAWatchdogDumpCooldown.GetValueOnGameThread())
+			{
+				LastDumpSeconds = Now;
+
+				const FString Path = DumpHistory(FString::Printf(TEXT("Frame %llu took %.2f ms"), Frame.FrameNumber, Frame.DurationMs));
+				UE_LOG(LogObstacle_Avoidance, Warning, TEXT("Frame spike of %.2f ms, watchdog history written to %s"), Frame.DurationMs, *Path);
+			}
+		}
+	}
+
+	bRecording = CVarOAWatchdogEnabled.GetValueOnGameThread();
+	ScopeDepth = 0;
+
+	if (!bRecording)
+	{
+		CurrentFrameIndex = INDEX_NONE;
+		NumRecordedFrames = 0;
+		return;
+	}
+
+	// resize the history if needed
+	const int32 HistoryFrames = FMath::Max(1, CVarOAWatchdogHistoryFrames.GetValueOnGameThread());
+
+	if (Frames.Num() != HistoryFrames)
+	{
+		Frames.SetNum(HistoryFrames);
+		CurrentFrameIndex = INDEX_NONE;
+		NumRecordedFrames = 0;
+	}
+
+	// start the next frame, reusing the oldest slot's allocations
+	CurrentFrameIndex = (CurrentFrameIndex + 1) % Frames.Num();
+	NumRecordedFrames = FMath::Min(NumRecordedFrames + 1, Frames.Num());
+
+	FOAWatchdogFrame& Frame = Frames[CurrentFrameIndex];
+	Frame.FrameNumber = GFrameCounter;
+	Frame.StartSeconds = Now;
+	Frame.DurationMs = 0.0f;
+	Frame.Scopes.Reset();
+}
+
+void UOAFrameWatchdogSubsystem::OnPreLoadMap(const FString& MapName)
+{
+	MapLoadStartSeconds = FPlatformTime::Seconds();
+	LoadingMapName = FName(*FPaths::GetBaseFilename(MapName));
+}
+
+void UOAFrameWatchdogSubsystem::OnPostLoadMap(UWorld* LoadedWorld)
+{
+	if (bRecording && MapLoadStartSeconds > 0.0)
+	{
+		EndScope(TEXT("LoadMap"), LoadingMapName, (FPlatformTime::Seconds() - MapLoadStartSeconds) * 1000.0, ScopeDepth);
+	}
+
+	MapLoadStartSeconds = 0.0;
+}
+
+FString UOAFrameWatchdogSubsystem::DumpHistory(const FString& Reason)
+{
+	TStringBuilder<16384> Report;
+	Report.Appendf(TEXT("Frame watchdog dump: %s\n"), *Reason);
+	Report.Appendf(TEXT("Threshold %.2f ms, %d frames, oldest first\n\n"), CVarOAWatchdogThresholdMs.GetValueOnGameThread(), NumRecordedFrames);
+
+	const float ThresholdMs = CVarOAWatchdogThresholdMs.GetValueOnGameThread();
+
+	for (int32 i = NumRecordedFrames - 1; i >= 0; --i)
+	{
+		const int32 FrameIndex = (CurrentFrameIndex - i + Frames.Num()) % Frames.Num();
+		const FOAWatchdogFrame& Frame = Frames[FrameIndex];
+
+		// the frame being recorded has no duration yet
+		const float DurationMs = i == 0 ? (FPlatformTime::Seconds() - Frame.StartSeconds) * 1000.0 : Frame.DurationMs;
+
+		// sum the outermost scopes to see how much of the frame we can attribute
+		float AttributedMs = 0.0f;
+
+		for (const FOAWatchdogScopeRecord& Record : Frame.Scopes)
+		{
+			AttributedMs += Record.Depth == 0 ? Record.DurationMs : 0.0f;
+		}
+
+		Report.Appendf(TEXT("Frame %llu: %.2f ms%s, attributed %.2f ms\n"), Frame.FrameNumber, DurationMs,
+			DurationMs > ThresholdMs ? TEXT(" SPIKE") : TEXT(""), AttributedMs);
+
+		// list the most expensive scopes first
+		TArray<const FOAWatchdogScopeRecord*, TInlineAllocator<64>> SortedScopes;
+
+		for (const FOAWatchdogScopeRecord& Record : Frame.Scopes)
+		{
+			SortedScopes.Add(&Record);
+		}
+
+		SortedScopes.Sort([](const FOAWatchdogScopeRecord& A, const FOAWatchdogScopeRecord& B) { return A.DurationMs > B.DurationMs; });
+
+		for (const FOAWatchdogScopeRecord* Record : SortedScopes)
+		{
+			Report.Appendf(TEXT("    %8.3f ms  %s%s  %s\n"), Record->DurationMs, *FString::ChrN(Record->Depth * 2, TEXT(' ')), Record->Label, *Record->Context.ToString());
+		}
+	}
+
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("Watchdog") / FString::Printf(TEXT("Spike_%s_%llu.txt"), *FDateTime::Now().ToString(), GFrameCounter);
+	FFileHelper::SaveStringToFile(Report.ToView(), *Path);
+
+	return Path;
+}
+
+////////////////////////////////////////////////////////////////////
+
+/** Writes the current watchdog history to a file on demand */
+static FAutoConsoleCommand CVarOAWatchdogDump(
+	TEXT("OA.Watchdog.Dump"),
+	TEXT("Writes the frame watchdog history to Saved/Watchdog."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (UOAFrameWatchdogSubsystem* Watchdog = UOAFrameWatchdogSubsystem::GetRecording())
+		{
+			UE_LOG(LogObstacle_Avoidance, Log, TEXT("Watchdog history written to %s"), *Watchdog->DumpHistory(TEXT("Manual dump")));
+		}
+		else
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("The frame watchdog isn't recording. Set OA.Watchdog.Enabled 1 first."));
+		}
+	})
+);
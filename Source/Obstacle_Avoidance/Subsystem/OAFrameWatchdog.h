@@ -0,0 +1,171 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "OAFrameWatchdog.generated.h"
+
+/**
+ *  Timing of a single watchdog scope
+ */
+struct FOAWatchdogScopeRecord
+{
+	/** Code path label */
+	const TCHAR* Label = nullptr;
+
+	/** Name of the object the code ran for, if any */
+	FName Context;
+
+	/** Scope duration in milliseconds */
+	float DurationMs = 0.0f;
+
+	/** Nesting depth, zero for outermost scopes */
+	uint8 Depth = 0;
+};
+
+/**
+ *  Watchdog timings for a single frame
+ */
+struct FOAWatchdogFrame
+{
+	/** Engine frame counter */
+	uint64 FrameNumber = 0;
+
+	/** Time the frame started */
+	double StartSeconds = 0.0;
+
+	/** Total frame duration in milliseconds */
+	float DurationMs = 0.0f;
+
+	/** Scopes recorded during the frame, in completion order */
+	TArray<FOAWatchdogScopeRecord> Scopes;
+};
+
+/**
+ *  Frame spike watchdog.
+ *  Records timings for scoped obstacle and character code paths on the game thread,
+ *  keeps a rolling history of recent frames, and dumps the history with per scope
+ *  attribution to Saved/Watchdog when a frame goes over the spike threshold.
+ *  Map loads are recorded automatically.
+ *  Runs with or without rendering, so it can be enabled in headless automated runs
+ *  with -OAWatchdog or OA.Watchdog.Enabled=1.
+ */
+UCLASS()
+class UOAFrameWatchdogSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Rolling frame history */
+	TArray<FOAWatchdogFrame> Frames;
+
+	/** Index of the frame currently being recorded */
+	int32 CurrentFrameIndex = INDEX_NONE;
+
+	/** Number of frames recorded since the history was last cleared */
+	int32 NumRecordedFrames = 0;
+
+	/** Current scope nesting depth */
+	uint8 ScopeDepth = 0;
+
+	/** Time the current map load started */
+	double MapLoadStartSeconds = 0.0;
+
+	/** Name of the map being loaded */
+	FName LoadingMapName;
+
+	/** Time of the last spike dump */
+	double LastDumpSeconds = -DBL_MAX;
+
+	/** Number of spikes detected since startup */
+	int32 NumSpikes = 0;
+
+	/** True if recording this frame */
+	bool bRecording = false;
+
+	/** Delegate handles */
+	FDelegateHandle BeginFrameHandle;
+	FDelegateHandle PreLoadMapHandle;
+	FDelegateHandle PostLoadMapHandle;
+
+	/** Active watchdog, for fast access from scopes */
+	static UOAFrameWatchdogSubsystem* Instance;
+
+public:
+
+	/** Binds to the frame and map load delegates */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Unbinds from the delegates */
+	virtual void Deinitialize() override;
+
+	/** Returns the active watchdog, if it's recording */
+	static UOAFrameWatchdogSubsystem* GetRecording() { return Instance && Instance->bRecording ? Instance : nullptr; }
+
+	/** Opens a scope. Returns the nesting depth for the scope */
+	uint8 BeginScope() { return ScopeDepth++; }
+
+	/** Closes a scope and records its timing */
+	void EndScope(const TCHAR* Label, FName Context, float DurationMs, uint8 Depth);
+
+	/** Writes the frame history to a file. Returns the file path */
+	FString DumpHistory(const FString& Reason);
+
+	/** Returns the number of spikes detected since startup */
+	int32 GetNumSpikes() const { return NumSpikes; }
+
+protected:
+
+	/** Closes the previous frame, checks it for spikes and starts recording the next one */
+	void OnBeginFrame();
+
+	/** Starts timing a map load */
+	void OnPreLoadMap(const FString& MapName);
+
+	/** Records the map load timing */
+	void OnPostLoadMap(UWorld* LoadedWorld);
+};
+
+/**
+ *  Times the enclosing scope for the frame watchdog. Only records on the game thread while the watchdog is enabled
+ */
+struct FOAWatchdogScope
+{
+	FOAWatchdogScope(const TCHAR* InLabel, const UObject* InContext = nullptr)
+	{
+		if (IsInGameThread())
+		{
+			Watchdog = UOAFrameWatchdogSubsystem::GetRecording();
+
+			if (Watchdog)
+			{
+				Label = InLabel;
+				Context = InContext ? InContext->GetFName() : NAME_None;
+				Depth = Watchdog->BeginScope();
+				StartCycles = FPlatformTime::Cycles64();
+			}
+		}
+	}
+
+	~FOAWatchdogScope()
+	{
+		if (Watchdog)
+		{
+			const float DurationMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+			Watchdog->EndScope(Label, Context, DurationMs, Depth);
+		}
+	}
+
+private:
+
+	UOAFrameWatchdogSubsystem* Watchdog = nullptr;
+	const TCHAR* Label = nullptr;
+	FName Context;
+	uint64 StartCycles = 0;
+	uint8 Depth = 0;
+};
+
+/** Times the enclosing scope for the frame watchdog, attributed to the provided object */
+#define OA_WATCHDOG_SCOPE(Label, Context) FOAWatchdogScope ANONYMOUS_VARIABLE(OAWatchdogScope)(TEXT(Label), Context)
@@ -0,0 +1,482 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAObstacleForceSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "EngineUtils.h"
+#include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Chaos/SimCallbackInput.h"
+#include "OAFrameWatchdog.h"
+#include "Obstacle_Avoidance.h"
+
+static TAutoConsoleVariable<bool> CVarOAObstacleAsyncForces(
+	TEXT("OA.Obstacles.AsyncForces"),
+	false,
+	TEXT("If true, obstacle pushes and launches are worked out in the Chaos async physics callback at the fixed physics rate.\n")
+	TEXT("Needs Tick Physics Async in the project physics settings. Read when a level starts."));
+
+/**
+ * Game thread snapshot of a force shape
+ */
+struct FOAForceShapeSnapshot
+{
+	int32 Id = 0;
+	EOAObstacleForceType Type = EOAObstacleForceType::Push;
+
+	/** Unscaled shape transform */
+	FTransform Transform;
+
+	/** Box half extents, for boxes */
+	FVector BoxExtent = FVector::ZeroVector;
+
+	/** Sphere radius, zero for boxes */
+	float SphereRadius = 0.0f;
+
+	/** Owner location, knockbacks push away from it and spinning shapes turn around it */
+	FVector Origin = FVector::ZeroVector;
+
+	/** Owner velocity */
+	FVector LinearVelocity = FVector::ZeroVector;
+
+	float YawRate = 0.0f;
+	FVector Velocity = FVector::ZeroVector;
+	float KnockbackForce = 0.0f;
+	bool bXYOverride = false;
+	bool bZOverride = false;
+};
+
+/**
+ * Game thread snapshot of a character capsule
+ */
+struct FOAForceCharacterSnapshot
+{
+	uint32 Id = 0;
+	FVector Location = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+};
+
+/**
+ * Launch worked out on the physics thread
+ */
+struct FOAForceLaunch
+{
+	int32 ShapeId = 0;
+	uint32 CharacterId = 0;
+	FVector Velocity = FVector::ZeroVector;
+	bool bXYOverride = false;
+	bool bZOverride = false;
+};
+
+/**
+ * Snapshot sent to the physics thread once per game frame
+ */
+struct FOAObstacleForceInput : public Chaos::FSimCallbackInput
+{
+	/** Changes every snapshot, so the physics thread knows how stale the one it's using is */
+	uint64 Sequence = 0;
+
+	TArray<FOAForceShapeSnapshot> Shapes;
+	TArray<FOAForceCharacterSnapshot> Characters;
+
+	void Reset()
+	{
+		Shapes.Reset();
+		Characters.Reset();
+	}
+};
+
+/**
+ * Results of a single physics step
+ */
+struct FOAObstacleForceOutput : public Chaos::FSimCallbackOutput
+{
+	/** Push displacement per character id */
+	TMap<uint32, FVector> Pushes;
+
+	TArray<FOAForceLaunch> Launches;
+
+	void Reset()
+	{
+		Pushes.Reset();
+		Launches.Reset();
+	}
+};
+
+/**
+ * Works out obstacle forces every physics step.
+ * Moves the shapes and characters from the last snapshot forward by the time since it was taken,
+ * so spinning arms and flying cannonballs are tested at the physics rate instead of the frame rate.
+ */
+class FOAObstacleForceCallback : public Chaos::TSimCallbackObject<FOAObstacleForceInput, FOAObstacleForceOutput>
+{
+protected:
+
+	virtual void OnPreSimulate_Internal() override
+	{
+		const FOAObstacleForceInput* Input = GetConsumerInput_Internal();
+
+		if (!Input)
+		{
+			return;
+		}
+
+		const float StepTime = GetDeltaTime_Internal();
+		const float SimTime = GetSimTime_Internal();
+
+		if (Input->Sequence != LastSequence)
+		{
+			LastSequence = Input->Sequence;
+			InputSimTime = SimTime;
+		}
+
+		const float Elapsed = SimTime - InputSimTime;
+
+		FOAObstacleForceOutput& Output = GetProducerOutputData_Internal();
+		StillOverlapping.Reset();
+
+		for (const FOAForceShapeSnapshot& Shape : Input->Shapes)
+		{
+			// bring the shape up to the current physics time
+			const FVector Origin = Shape.Origin + Shape.LinearVelocity * Elapsed;
+			FTransform ShapeTransform = Shape.Transform;
+			ShapeTransform.AddToTranslation(Shape.LinearVelocity * Elapsed);
+
+			if (Shape.YawRate != 0.0f)
+			{
+				const FQuat Spin(FVector::UpVector, FMath::DegreesToRadians(Shape.YawRate * Elapsed));
+				ShapeTransform.SetLocation(Origin + Spin.RotateVector(ShapeTransform.GetLocation() - Origin));
+				ShapeTransform.SetRotation(Spin * ShapeTransform.GetRotation());
+			}
+
+			for (const FOAForceCharacterSnapshot& Character : Input->Characters)
+			{
+				const FVector Location = Character.Location + Character.Velocity * Elapsed;
+
+				if (!Overlaps(Shape, ShapeTransform, Location, Character.Radius, Character.HalfHeight))
+				{
+					continue;
+				}
+
+				const uint64 Key = (static_cast<uint64>(Shape.Id) << 32) | Character.Id;
+				StillOverlapping.Add(Key);
+
+				if (Shape.Type == EOAObstacleForceType::Push)
+				{
+					Output.Pushes.FindOrAdd(Character.Id) += Shape.Velocity * StepTime;
+					continue;
+				}
+
+				// launches only happen when the character starts overlapping
+				if (Overlapping.Contains(Key))
+				{
+					continue;
+				}
+
+				FOAForceLaunch& Launch = Output.Launches.AddDefaulted_GetRef();
+				Launch.ShapeId = Shape.Id;
+				Launch.CharacterId = Character.Id;
+				Launch.bXYOverride = Shape.bXYOverride;
+				Launch.bZOverride = Shape.bZOverride;
+				Launch.Velocity = Shape.Type == EOAObstacleForceType::Knockback
+					? UOAObstacleForceSubsystem::GetKnockbackVelocity(Origin, Location, Shape.KnockbackForce)
+					: Shape.Velocity;
+			}
+		}
+
+		// swap rather than move so both sets keep their allocations across steps
+		Swap(Overlapping, StillOverlapping);
+	}
+
+	/** Tests an upright character capsule against a force shape */
+	static bool Overlaps(const FOAForceShapeSnapshot& Shape, const FTransform& ShapeTransform, const FVector& Location, float Radius, float HalfHeight)
+	{
+		// closest point on the capsule's inner segment to the shape center
+		const FVector ShapeCenter = ShapeTransform.GetLocation();
+		const float SegmentHalfLength = FMath::Max(0.0f, HalfHeight - Radius);
+		const FVector SegmentPoint(Location.X, Location.Y, FMath::Clamp(ShapeCenter.Z, Location.Z - SegmentHalfLength, Location.Z + SegmentHalfLength));
+
+		if (Shape.SphereRadius > 0.0f)
+		{
+			return FVector::DistSquared(SegmentPoint, ShapeCenter) <= FMath::Square(Radius + Shape.SphereRadius);
+		}
+
+		const FVector LocalPoint = ShapeTransform.InverseTransformPositionNoScale(SegmentPoint);
+		const FVector ClosestPoint = LocalPoint.BoundToBox(-Shape.BoxExtent, Shape.BoxExtent);
+
+		return FVector::DistSquared(LocalPoint, ClosestPoint) <= FMath::Square(Radius);
+	}
+
+private:
+
+	/** Shape and character pairs that overlapped on the last step */
+	TSet<uint64> Overlapping;
+
+	/** Pairs overlapping on the current step, kept around to reuse its allocation */
+	TSet<uint64> StillOverlapping;
+
+	/** Sequence of the snapshot in use */
+	uint64 LastSequence = 0;
+
+	/** Physics time the snapshot in use was first seen */
+	float InputSimTime = 0.0f;
+};
+
+bool UOAObstacleForceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UOAObstacleForceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!CVarOAObstacleAsyncForces.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	// without async physics the callback runs once per frame with the frame time, which gains us nothing
+	if (!UPhysicsSettings::Get()->bTickPhysicsAsync)
+	{
+		UE_LOG(LogObstacle_Avoidance, Warning, TEXT("OA.Obstacles.AsyncForces needs Tick Physics Async enabled in the physics settings. Applying obstacle forces on the game thread."));
+		return;
+	}
+
+	FPhysScene* PhysScene = InWorld.GetPhysicsScene();
+	Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr;
+
+	if (!Solver)
+	{
+		return;
+	}
+
+	ForceCallback = Solver->CreateAndRegisterSimCallbackObject_External<FOAObstacleForceCallback>();
+}
+
+void UOAObstacleForceSubsystem::Deinitialize()
+{
+	if (ForceCallback)
+	{
+		FPhysScene* PhysScene = GetWorld()->GetPhysicsScene();
+
+		if (Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr)
+		{
+			Solver->UnregisterAndFreeSimCallbackObject_External(ForceCallback);
+		}
+
+		ForceCallback = nullptr;
+	}
+
+	Shapes.Reset();
+	Characters.Reset();
+
+	Super::Deinitialize();
+}
+
+void UOAObstacleForceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!ForceCallback)
+	{
+		return;
+	}
+
+	OA_WATCHDOG_SCOPE("OAObstacleForces.Tick", this);
+
+	ApplyResults();
+	SendSnapshot();
+}
+
+TStatId UOAObstacleForceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UOAObstacleForceSubsystem, STATGROUP_Tickables);
+}
+
+bool UOAObstacleForceSubsystem::RegisterForceShape(UShapeComponent* Shape, const FOAObstacleForceSettings& Settings)
+{
+	if (!ForceCallback || !Shape)
+	{
+		return false;
+	}
+
+	FForceShape& ForceShape = Shapes.AddDefaulted_GetRef();
+	ForceShape.Id = NextShapeId++;
+	ForceShape.Shape = Shape;
+	ForceShape.Settings = Settings;
+
+	return true;
+}
+
+void UOAObstacleForceSubsystem::UnregisterForceShapes(const AActor* Owner)
+{
+	Shapes.RemoveAll([Owner](const FForceShape& ForceShape)
+	{
+		const UShapeComponent* Shape = ForceShape.Shape.Get();
+		return !Shape || Shape->GetOwner() == Owner;
+	});
+}
+
+FVector UOAObstacleForceSubsystem::GetKnockbackVelocity(const FVector& Origin, const FVector& CharacterLocation, float KnockbackForce)
+{
+	// Knockback direction: from obstacle center outward toward character
+	FVector KnockbackDirection = (CharacterLocation - Origin).GetSafeNormal2D();
+
+	// Add slight upward component for natural knockback feel
+	KnockbackDirection.Z = 0.3f;
+	KnockbackDirection.Normalize();
+
+	return KnockbackDirection * KnockbackForce;
+}
+
+void UOAObstacleForceSubsystem::ApplyResults()
+{
+	// gather every physics step finished since last frame, characters render their own motion so pushes go in at once
+	TMap<uint32, FVector> Pushes;
+	TArray<FOAForceLaunch> Launches;
+
+	while (Chaos::TSimCallbackOutputHandle<FOAObstacleForceOutput> Output = ForceCallback->PopOutputData_External())
+	{
+		for (const TPair<uint32, FVector>& Push : Output->Pushes)
+		{
+			Pushes.FindOrAdd(Push.Key) += Push.Value;
+		}
+
+		Launches.Append(Output->Launches);
+	}
+
+	for (const TPair<uint32, FVector>& Push : Pushes)
+	{
+		if (ACharacter* Character = Characters.FindRef(Push.Key).Get())
+		{
+			Character->AddActorWorldOffset(Push.Value);
+		}
+	}
+
+	// launch callbacks can destroy their obstacle, which unregisters its shapes,
+	// so copy what they need out of Shapes before running any of them
+	struct FPendingLaunch
+	{
+		TWeakObjectPtr<UShapeComponent> Shape;
+		TWeakObjectPtr<ACharacter> Character;
+		FOAObstacleLaunchDelegate OnLaunch;
+		const FOAForceLaunch* Launch = nullptr;
+	};
+
+	TArray<FPendingLaunch> PendingLaunches;
+	PendingLaunches.Reserve(Launches.Num());
+
+	for (const FOAForceLaunch& Launch : Launches)
+	{
+		ACharacter* Character = Characters.FindRef(Launch.CharacterId).Get();
+		const FForceShape* ForceShape = Shapes.FindByPredicate([&Launch](const FForceShape& Shape) { return Shape.Id == Launch.ShapeId; });
+
+		if (!Character || !ForceShape || !ForceShape->Shape.IsValid())
+		{
+			continue;
+		}
+
+		PendingLaunches.Add({ ForceShape->Shape, Character, ForceShape->Settings.OnLaunch, &Launch });
+	}
+
+	for (const FPendingLaunch& Pending : PendingLaunches)
+	{
+		ACharacter* Character = Pending.Character.Get();
+
+		// the obstacle may have gone away since, like a cannonball that already hit someone
+		if (!Character || !Pending.Shape.IsValid())
+		{
+			continue;
+		}
+
+		Pending.OnLaunch.ExecuteIfBound(Character);
+
+		Character->LaunchCharacter(Pending.Launch->Velocity, Pending.Launch->bXYOverride, Pending.Launch->bZOverride);
+	}
+}
+
+void UOAObstacleForceSubsystem::SendSnapshot()
+{
+	FOAObstacleForceInput* Input = ForceCallback->GetProducerInputData_External();
+	Input->Reset();
+	Input->Sequence = GFrameCounter;
+
+	// drop shapes whose obstacle went away without unregistering
+	Shapes.RemoveAll([](const FForceShape& ForceShape) { return !ForceShape.Shape.IsValid(); });
+
+	Input->Shapes.Reserve(Shapes.Num());
+
+	for (const FForceShape& ForceShape : Shapes)
+	{
+		const UShapeComponent* Shape = ForceShape.Shape.Get();
+
+		if (!Shape->IsCollisionEnabled())
+		{
+			continue;
+		}
+
+		FOAForceShapeSnapshot& Snapshot = Input->Shapes.AddDefaulted_GetRef();
+		Snapshot.Id = ForceShape.Id;
+		Snapshot.Type = ForceShape.Settings.Type;
+		Snapshot.Transform = FTransform(Shape->GetComponentQuat(), Shape->GetComponentLocation());
+		Snapshot.Origin = Shape->GetOwner()->GetActorLocation();
+		Snapshot.LinearVelocity = Shape->GetOwner()->GetVelocity();
+		Snapshot.YawRate = ForceShape.Settings.YawRate;
+		Snapshot.Velocity = ForceShape.Settings.Velocity;
+		Snapshot.KnockbackForce = ForceShape.Settings.KnockbackForce;
+		Snapshot.bXYOverride = ForceShape.Settings.bXYOverride;
+		Snapshot.bZOverride = ForceShape.Settings.bZOverride;
+
+		if (const USphereComponent* Sphere = Cast<USphereComponent>(Shape))
+		{
+			Snapshot.SphereRadius = Sphere->GetScaledSphereRadius();
+		}
+		else if (const UBoxComponent* Box = Cast<UBoxComponent>(Shape))
+		{
+			Snapshot.BoxExtent = Box->GetScaledBoxExtent();
+		}
+	}
+
+	Characters.Reset();
+
+	for (TActorIterator<ACharacter> It(GetWorld()); It; ++It)
+	{
+		ACharacter* Character = *It;
+		const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+
+		// overlaps need the capsule to collide
+		if (!Capsule || !Capsule->IsCollisionEnabled())
+		{
+			continue;
+		}
+
+		FOAForceCharacterSnapshot& Snapshot = Input->Characters.AddDefaulted_GetRef();
+		Snapshot.Id = Character->GetUniqueID();
+		Snapshot.Location = Character->GetActorLocation();
+		Snapshot.Velocity = Character->GetVelocity();
+		Snapshot.Radius = Capsule->GetScaledCapsuleRadius();
+		Snapshot.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+
+		Characters.Add(Snapshot.Id, Character);
+	}
+}
+
+UOAObstacleForceSubsystem* UOAObstacleForceSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		return World->GetSubsystem<UOAObstacleForceSubsystem>();
+	}
+
+	return nullptr;
+}
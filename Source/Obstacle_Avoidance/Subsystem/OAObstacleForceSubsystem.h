@@ -0,0 +1,137 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "OAObstacleForceSubsystem.generated.h"
+
+class ACharacter;
+class UShapeComponent;
+class FOAObstacleForceCallback;
+
+/** Called on the game thread right before a force shape launches a character */
+DECLARE_DELEGATE_OneParam(FOAObstacleLaunchDelegate, ACharacter*);
+
+/** How a force shape affects the characters overlapping it */
+enum class EOAObstacleForceType : uint8
+{
+	/** Moves characters at the push velocity for as long as they overlap */
+	Push,
+
+	/** Launches characters with the launch velocity when they start overlapping */
+	Launch,
+
+	/** Knocks characters away from the shape owner when they start overlapping */
+	Knockback
+};
+
+/**
+ *  Force an obstacle applies through one of its collision shapes
+ */
+struct FOAObstacleForceSettings
+{
+	/** How the force is applied */
+	EOAObstacleForceType Type = EOAObstacleForceType::Push;
+
+	/** Push velocity, or launch velocity, in world space */
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Knockback speed */
+	float KnockbackForce = 0.0f;
+
+	/** If true, launches replace the character's XY velocity instead of adding to it */
+	bool bXYOverride = false;
+
+	/** If true, launches replace the character's Z velocity instead of adding to it */
+	bool bZOverride = false;
+
+	/** Rate the shape spins around the owner's up axis, in deg/s. Lets the physics thread move it between game frames */
+	float YawRate = 0.0f;
+
+	/** Runs obstacle specific hit handling, like telemetry or destroying a projectile */
+	FOAObstacleLaunchDelegate OnLaunch;
+};
+
+/**
+ *  Applies obstacle forces to characters from the Chaos async physics callback.
+ *  With OA.Obstacles.AsyncForces enabled and physics ticking async, conveyor pushes and jump pad,
+ *  pillar and cannonball launches are worked out every fixed physics step on the physics thread,
+ *  against shape and character snapshots the game thread sends once a frame.
+ *  The game thread only reads the results back and hands them to the character movement.
+ *  Obstacles fall back to their own game thread overlap handling when this isn't running.
+ */
+UCLASS()
+class UOAObstacleForceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/**
+	 *  A registered force shape
+	 */
+	struct FForceShape
+	{
+		/** Snapshot id of the shape */
+		int32 Id = 0;
+
+		/** Collision shape the force is applied through */
+		TWeakObjectPtr<UShapeComponent> Shape;
+
+		/** Force settings */
+		FOAObstacleForceSettings Settings;
+	};
+
+	/** Registered force shapes */
+	TArray<FForceShape> Shapes;
+
+	/** Characters in the last snapshot, by unique id */
+	TMap<uint32, TWeakObjectPtr<ACharacter>> Characters;
+
+	/** Physics thread callback, owned by the physics solver */
+	FOAObstacleForceCallback* ForceCallback = nullptr;
+
+	/** Id for the next registered shape */
+	int32 NextShapeId = 0;
+
+public:
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Registers the physics callback if async forces are enabled */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** Unregisters the physics callback */
+	virtual void Deinitialize() override;
+
+	/** Applies the physics thread results and sends the next snapshot */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Stat id for the tick */
+	virtual TStatId GetStatId() const override;
+
+	/** Returns true if obstacle forces are applied from the async physics callback */
+	bool IsRunning() const { return ForceCallback != nullptr; }
+
+	/** Registers a shape to apply forces through. Returns false if the obstacle should apply its own forces on the game thread */
+	bool RegisterForceShape(UShapeComponent* Shape, const FOAObstacleForceSettings& Settings);
+
+	/** Unregisters all the force shapes owned by the provided actor */
+	void UnregisterForceShapes(const AActor* Owner);
+
+	/** Returns the knockback velocity for a character hit by an obstacle centered at Origin */
+	static FVector GetKnockbackVelocity(const FVector& Origin, const FVector& CharacterLocation, float KnockbackForce);
+
+	/** Convenience accessor for the subsystem owned by the given object's world */
+	static UOAObstacleForceSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+
+	/** Applies the pushes and launches worked out by the physics thread since the last frame */
+	void ApplyResults();
+
+	/** Sends the current shapes and characters to the physics thread */
+	void SendSnapshot();
+};
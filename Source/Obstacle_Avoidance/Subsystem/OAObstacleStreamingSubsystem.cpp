@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAObstacleStreamingSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+bool UOAObstacleStreamingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UOAObstacleStreamingSubsystem::SaveObstacle(const AActor* Obstacle, EEndPlayReason::Type EndPlayReason)
+{
+	// cell unloads remove the level from the world, anything else ends the obstacle for good
+	if (EndPlayReason != EEndPlayReason::RemovedFromWorld)
+	{
+		return;
+	}
+
+	const IOAStreamableObstacle* Streamable = Cast<IOAStreamableObstacle>(Obstacle);
+
+	if (!Streamable)
+	{
+		return;
+	}
+
+	FOAObstacleStreamingState& State = SavedStates.FindOrAdd(Obstacle->GetFName());
+	Streamable->SaveStreamingState(State);
+	State.SaveTime = GetWorld()->GetTimeSeconds();
+}
+
+bool UOAObstacleStreamingSubsystem::RestoreObstacle(AActor* Obstacle)
+{
+	IOAStreamableObstacle* Streamable = Cast<IOAStreamableObstacle>(Obstacle);
+
+	if (!Streamable)
+	{
+		return false;
+	}
+
+	FOAObstacleStreamingState State;
+
+	if (!SavedStates.RemoveAndCopyValue(Obstacle->GetFName(), State))
+	{
+		return false;
+	}
+
+	const float ElapsedTime = static_cast<float>(GetWorld()->GetTimeSeconds() - State.SaveTime);
+	Streamable->RestoreStreamingState(State, FMath::Max(0.0f, ElapsedTime));
+
+	return true;
+}
+
+UOAObstacleStreamingSubsystem* UOAObstacleStreamingSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		return World->GetSubsystem<UOAObstacleStreamingSubsystem>();
+	}
+
+	return nullptr;
+}
@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "OAStreamableObstacle.h"
+#include "OAObstacleStreamingSubsystem.generated.h"
+
+/**
+ *  Keeps the state of obstacles whose World Partition cell was unloaded.
+ *  Unloaded actors are destroyed and reloaded fresh from disk, so without this moving platforms,
+ *  pillars, lasers and cannons would restart their cycles every time the player came back.
+ *  States are keyed by actor name, which is stable across cell reloads.
+ */
+UCLASS()
+class UOAObstacleStreamingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** States of currently unloaded obstacles */
+	TMap<FName, FOAObstacleStreamingState> SavedStates;
+
+public:
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Saves the obstacle's state if it's ending play because its cell is unloading */
+	void SaveObstacle(const AActor* Obstacle, EEndPlayReason::Type EndPlayReason);
+
+	/** Restores the obstacle's state if it was saved when its cell last unloaded. Returns true if a state was restored */
+	bool RestoreObstacle(AActor* Obstacle);
+
+	/** Returns the number of obstacles with a saved state */
+	int32 GetNumSavedStates() const { return SavedStates.Num(); }
+
+	/** Convenience accessor for the subsystem owned by the given object's world */
+	static UOAObstacleStreamingSubsystem* Get(const UObject* WorldContextObject);
+};
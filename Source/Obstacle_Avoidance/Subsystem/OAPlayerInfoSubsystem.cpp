@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OAPlayerInfoSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "Obstacle_Avoidance.h"
+
+bool UOAPlayerInfoSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+const FOAPlayerInfo& UOAPlayerInfoSubsystem::GetPlayerInfo()
+{
+	// only look up the player once per frame
+	if (CachedFrame != GFrameCounter)
+	{
+		RefreshPlayerInfo();
+		CachedFrame = GFrameCounter;
+	}
+
+	return CachedInfo;
+}
+
+UOAPlayerInfoSubsystem* UOAPlayerInfoSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		return World->GetSubsystem<UOAPlayerInfoSubsystem>();
+	}
+
+	return nullptr;
+}
+
+void UOAPlayerInfoSubsystem::RefreshPlayerInfo()
+{
+	// get the pawn possessed by the first local player
+	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+
+	CachedInfo.Pawn = PlayerPawn;
+
+	// keep the last known location if the player is gone
+	if (!PlayerPawn)
+	{
+		CachedInfo.Velocity = FVector::ZeroVector;
+		CachedInfo.PredictedLocation = CachedInfo.Location;
+		CachedInfo.bIsGrounded = false;
+		return;
+	}
+
+	CachedInfo.Location = PlayerPawn->GetActorLocation();
+	CachedInfo.Velocity = PlayerPawn->GetVelocity();
+
+	const ACharacter* PlayerCharacter = Cast<ACharacter>(PlayerPawn);
+	const UCharacterMovementComponent* MovementComponent = PlayerCharacter ? PlayerCharacter->GetCharacterMovement() : nullptr;
+	CachedInfo.bIsGrounded = MovementComponent && MovementComponent->IsMovingOnGround();
+
+	// grounded characters don't drift vertically, so only extrapolate along the floor
+	FVector PredictionVelocity = CachedInfo.Velocity;
+
+	if (CachedInfo.bIsGrounded)
+	{
+		PredictionVelocity.Z = 0.0f;
+	}
+
+	CachedInfo.PredictedLocation = CachedInfo.Location + PredictionVelocity * PredictionTime;
+}
+
+////////////////////////////////////////////////////////////////////
+
+/** Compares the per-agent player lookup against the cached one for a given number of agents */
+static FAutoConsoleCommandWithWorldAndArgs CVarBenchmarkPlayerInfo(
+	TEXT("OA.PlayerInfo.Benchmark"),
+	TEXT("Times N per-agent player lookups against N cached player info reads. Usage: OA.PlayerInfo.Benchmark [NumAgents=100]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UOAPlayerInfoSubsystem* PlayerInfo = World ? World->GetSubsystem<UOAPlayerInfoSubsystem>() : nullptr;
+
+		if (!PlayerInfo)
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("OA.PlayerInfo.Benchmark requires a game world."));
+			return;
+		}
+
+		const int32 NumAgents = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+		const FVector AgentLocation = FVector::ZeroVector;
+
+		// per-agent lookup, as each task used to do it
+		float UncachedDistance = 0.0f;
+		const double UncachedStart = FPlatformTime::Seconds();
+
+		for (int32 i = 0; i < NumAgents; ++i)
+		{
+			if (const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(World, 0))
+			{
+				UncachedDistance += FVector::Distance(PlayerPawn->GetActorLocation(), AgentLocation);
+			}
+		}
+
+		const double UncachedTime = FPlatformTime::Seconds() - UncachedStart;
+
+		// cached lookup, as the tasks do it now
+		float CachedDistance = 0.0f;
+		const double CachedStart = FPlatformTime::Seconds();
+
+		for (int32 i = 0; i < NumAgents; ++i)
+		{
+			const FOAPlayerInfo& Info = PlayerInfo->GetPlayerInfo();
+
+			if (Info.IsValid())
+			{
+				CachedDistance += FVector::Distance(Info.Location, AgentLocation);
+			}
+		}
+
+		const double CachedTime = FPlatformTime::Seconds() - CachedStart;
+
+		UE_LOG(LogObstacle_Avoidance, Log, TEXT("PlayerInfo benchmark, %d agents: per-agent lookup %.3f us, cached %.3f us (checksum %f / %f)"),
+			NumAgents, UncachedTime * 1e6, CachedTime * 1e6, UncachedDistance, CachedDistance);
+	})
+);
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "OAPlayerInfoSubsystem.generated.h"
+
+class APawn;
+
+/**
+ *  Snapshot of the first local player's state.
+ *  Computed at most once per frame and shared by every AI agent that reads it.
+ */
+USTRUCT(BlueprintType)
+struct FOAPlayerInfo
+{
+	GENERATED_BODY()
+
+	/** Pawn possessed by the first local player, if any */
+	UPROPERTY(BlueprintReadOnly, Category = "Player Info")
+	TObjectPtr<APawn> Pawn;
+
+	/** Player pawn location this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Player Info")
+	FVector Location = FVector::ZeroVector;
+
+	/** Player pawn velocity this frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Player Info")
+	FVector Velocity = FVector::ZeroVector;
+
+	/** Player location extrapolated by the subsystem's prediction time */
+	UPROPERTY(BlueprintReadOnly, Category = "Player Info")
+	FVector PredictedLocation = FVector::ZeroVector;
+
+	/** True if the player pawn is a character walking on the ground */
+	UPROPERTY(BlueprintReadOnly, Category = "Player Info")
+	bool bIsGrounded = false;
+
+	/** Returns true if a player pawn was found this frame */
+	bool IsValid() const { return Pawn != nullptr; }
+};
+
+/**
+ *  Per-world cache of the player's location, velocity and grounded state.
+ *  StateTree tasks and EQS contexts read from this instead of looking up the player pawn
+ *  themselves, so the lookup costs the same regardless of how many AI agents are running.
+ */
+UCLASS()
+class UOAPlayerInfoSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Cached player info */
+	FOAPlayerInfo CachedInfo;
+
+	/** Frame number the cache was last refreshed on */
+	uint64 CachedFrame = MAX_uint64;
+
+public:
+
+	/** Time in seconds used to extrapolate the predicted player location */
+	UPROPERTY(EditAnywhere, Category = "Player Info", meta = (ClampMin = 0, Units = "s"))
+	float PredictionTime = 0.5f;
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Returns the player info for the current frame, refreshing the cache if needed */
+	const FOAPlayerInfo& GetPlayerInfo();
+
+	/** Returns the player info for the current frame */
+	UFUNCTION(BlueprintPure, Category = "Player Info", meta = (DisplayName = "Get Player Info"))
+	FOAPlayerInfo K2_GetPlayerInfo() { return GetPlayerInfo(); }
+
+	/** Convenience accessor for the subsystem owned by the given object's world */
+	static UOAPlayerInfoSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+
+	/** Looks up the player pawn and recomputes the cached info */
+	void RefreshPlayerInfo();
+};
@@ -0,0 +1,161 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OATelemetryHeatmapCommandlet.h"
+#include "OATelemetryTypes.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ImageUtils.h"
+#include "Obstacle_Avoidance.h"
+
+UOATelemetryHeatmapCommandlet::UOATelemetryHeatmapCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOATelemetryHeatmapCommandlet::Main(const FString& Params)
+{
+	FString InputDir = OATelemetryFile::GetDefaultDirectory();
+	FString OutputDir = InputDir / TEXT("Heatmaps");
+	int32 Size = 512;
+	int32 Radius = 4;
+
+	FParse::Value(*Params, TEXT("Dir="), InputDir);
+	FParse::Value(*Params, TEXT("Out="), OutputDir);
+	FParse::Value(*Params, TEXT("Size="), Size);
+	FParse::Value(*Params, TEXT("Radius="), Radius);
+
+	Size = FMath::Clamp(Size, 16, 4096);
+	Radius = FMath::Clamp(Radius, 0, Size / 4);
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *InputDir, OATelemetryFile::Extension);
+
+	if (FileNames.IsEmpty())
+	{
+		UE_LOG(LogObstacle_Avoidance, Warning, TEXT("No telemetry files found in %s"), *InputDir);
+		return 1;
+	}
+
+	// gather deaths and their causes per level
+	TMap<FString, TArray<FVector3f>> DeathsByLevel;
+	TMap<FString, TMap<FString, int32>> CausesByLevel;
+
+	for (const FString& FileName : FileNames)
+	{
+		FString LevelName;
+		TArray<FOATelemetryFileEvent> Events;
+
+		if (!OATelemetryFile::Read(InputDir / FileName, LevelName, Events))
+		{
+			continue;
+		}
+
+		for (const FOATelemetryFileEvent& Event : Events)
+		{
+			if (Event.Type == EOATelemetryEventType::Death)
+			{
+				DeathsByLevel.FindOrAdd(LevelName).Add(Event.Location);
+				++CausesByLevel.FindOrAdd(LevelName).FindOrAdd(Event.Cause);
+			}
+		}
+	}
+
+	int32 NumFailed = 0;
+
+	for (const TPair<FString, TArray<FVector3f>>& Level : DeathsByLevel)
+	{
+		UE_LOG(LogObstacle_Avoidance, Display, TEXT("%s: %d deaths"), *Level.Key, Level.Value.Num());
+
+		// list the deadliest causes first
+		TMap<FString, int32>& Causes = CausesByLevel.FindChecked(Level.Key);
+		Causes.ValueSort([](int32 A, int32 B) { return A > B; });
+
+		for (const TPair<FString, int32>& Cause : Causes)
+		{
+			UE_LOG(LogObstacle_Avoidance, Display, TEXT("    %-32s %d"), *Cause.Key, Cause.Value);
+		}
+
+		if (!WriteHeatmap(Level.Key, Level.Value, OutputDir, Size, Radius))
+		{
+			++NumFailed;
+		}
+	}
+
+	return NumFailed > 0 ? 1 : 0;
+}
+
+bool UOATelemetryHeatmapCommandlet::WriteHeatmap(const FString& LevelName, const TArray<FVector3f>& DeathLocations, const FString& OutputDir, int32 Size, int32 Radius) const
+{
+	// fit the top down bounds of the deaths into a square image
+	FBox2f Bounds(ForceInit);
+
+	for (const FVector3f& Location : DeathLocations)
+	{
+		Bounds += FVector2f(Location.X, Location.Y);
+	}
+
+	const float Extent = FMath::Max(Bounds.GetExtent().GetMax(), 100.0f) * 1.1f;
+	const FVector2f Center = Bounds.GetCenter();
+	const FVector2f Origin = Center - FVector2f(Extent, Extent);
+	const float PixelsPerUnit = Size / (Extent * 2.0f);
+
+	// splat each death with a linear falloff
+	TArray<float> Density;
+	Density.SetNumZeroed(Size * Size);
+
+	for (const FVector3f& Location : DeathLocations)
+	{
+		const int32 CenterX = FMath::FloorToInt32((Location.X - Origin.X) * PixelsPerUnit);
+		const int32 CenterY = FMath::FloorToInt32((Location.Y - Origin.Y) * PixelsPerUnit);
+
+		for (int32 Y = FMath::Max(0, CenterY - Radius); Y <= FMath::Min(Size - 1, CenterY + Radius); ++Y)
+		{
+			for (int32 X = FMath::Max(0, CenterX - Radius); X <= FMath::Min(Size - 1, CenterX + Radius); ++X)
+			{
+				const float Distance = FMath::Sqrt(static_cast<float>(FMath::Square(X - CenterX) + FMath::Square(Y - CenterY)));
+				const float Weight = 1.0f - Distance / (Radius + 1.0f);
+
+				if (Weight > 0.0f)
+				{
+					Density[Y * Size + X] += Weight;
+				}
+			}
+		}
+	}
+
+	const float MaxDensity = FMath::Max(1.0f, FMath::Max(Density));
+
+	// map the density to a black, red, yellow, white ramp. World +X is right and +Y is down, as seen from above
+	TArray<FColor> Pixels;
+	Pixels.SetNumUninitialized(Size * Size);
+
+	for (int32 i = 0; i < Density.Num(); ++i)
+	{
+		const float Heat = FMath::Sqrt(Density[i] / MaxDensity);
+
+		Pixels[i] = FColor(
+			static_cast<uint8>(FMath::Clamp(Heat * 3.0f, 0.0f, 1.0f) * 255),
+			static_cast<uint8>(FMath::Clamp(Heat * 3.0f - 1.0f, 0.0f, 1.0f) * 255),
+			static_cast<uint8>(FMath::Clamp(Heat * 3.0f - 2.0f, 0.0f, 1.0f) * 255));
+	}
+
+	TArray64<uint8> PNGData;
+	FImageUtils::PNGCompressImageArray(Size, Size, Pixels, PNGData);
+
+	const FString OutputPath = OutputDir / FString::Printf(TEXT("%s_Deaths.png"), *LevelName);
+
+	if (!FFileHelper::SaveArrayToFile(PNGData, *OutputPath))
+	{
+		UE_LOG(LogObstacle_Avoidance, Error, TEXT("Could not write heatmap %s"), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(LogObstacle_Avoidance, Display, TEXT("Wrote %s, covering X %.0f to %.0f and Y %.0f to %.0f"),
+		*OutputPath, Origin.X, Origin.X + Extent * 2.0f, Origin.Y, Origin.Y + Extent * 2.0f);
+
+	return true;
+}
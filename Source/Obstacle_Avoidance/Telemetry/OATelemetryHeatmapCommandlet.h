@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "OATelemetryHeatmapCommandlet.generated.h"
+
+/**
+ *  Aggregates gameplay telemetry files into a top down death heatmap image per level,
+ *  and logs the death causes for each level, most frequent first.
+ *
+ *  Usage: UnrealEditor-Cmd Obstacle_Avoidance.uproject -run=OATelemetryHeatmap [-Dir=<telemetry dir>] [-Out=<output dir>] [-Size=512] [-Radius=4]
+ */
+UCLASS()
+class UOATelemetryHeatmapCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Constructor */
+	UOATelemetryHeatmapCommandlet();
+
+	/** Runs the commandlet */
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+
+	/** Writes the heatmap image for a single level */
+	bool WriteHeatmap(const FString& LevelName, const TArray<FVector3f>& DeathLocations, const FString& OutputDir, int32 Size, int32 Radius) const;
+};
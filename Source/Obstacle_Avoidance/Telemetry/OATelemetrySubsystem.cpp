@@ -0,0 +1,302 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OATelemetrySubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/ScopeLock.h"
+#include "Obstacle_Avoidance.h"
+
+static TAutoConsoleVariable<bool> CVarOATelemetryEnabled(
+	TEXT("OA.Telemetry.Enabled"),
+	true,
+	TEXT("If true, gameplay telemetry events are recorded to Saved/Telemetry. Read when a level starts."));
+
+static TAutoConsoleVariable<float> CVarOATelemetryFlushInterval(
+	TEXT("OA.Telemetry.FlushInterval"),
+	0.5f,
+	TEXT("Time between telemetry writer drains, in seconds."));
+
+/**
+ * Background thread that owns the per-thread event rings and drains them to a file.
+ */
+class FOATelemetryWriter : public FRunnable
+{
+public:
+
+	FOATelemetryWriter(const FString& Path, const FString& LevelName)
+		: FileWriter(Path, LevelName)
+	{
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("OATelemetryWriter"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FOATelemetryWriter() override
+	{
+		Stop();
+
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+		}
+
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			WakeEvent->Wait(FTimespan::FromSeconds(CVarOATelemetryFlushInterval.GetValueOnAnyThread()));
+			DrainRings();
+		}
+
+		// write whatever was recorded after the last drain
+		DrainRings();
+		FileWriter.Flush();
+
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+		WakeEvent->Trigger();
+	}
+
+	/** Returns the ring of a producing thread, creating it the first time the thread records. Rings live as long as the writer */
+	FOATelemetryRing* FindOrAddRing(uint32 ThreadId)
+	{
+		FScopeLock Lock(&RingsLock);
+
+		if (FOATelemetryRing* const* Ring = ThreadRings.Find(ThreadId))
+		{
+			return *Ring;
+		}
+
+		FOATelemetryRing* Ring = Rings.Add_GetRef(MakeUnique<FOATelemetryRing>()).Get();
+		ThreadRings.Add(ThreadId, Ring);
+
+		return Ring;
+	}
+
+	/** Returns the number of events dropped because a ring was full */
+	uint32 GetNumDropped()
+	{
+		FScopeLock Lock(&RingsLock);
+
+		uint32 NumDropped = 0;
+
+		for (const TUniquePtr<FOATelemetryRing>& Ring : Rings)
+		{
+			NumDropped += Ring->NumDropped.load(std::memory_order_relaxed);
+		}
+
+		return NumDropped;
+	}
+
+private:
+
+	/** Moves all pending events from the rings to the file */
+	void DrainRings()
+	{
+		// copy the ring list so producers can register new rings while we write
+		TArray<FOATelemetryRing*, TInlineAllocator<8>> RingsToDrain;
+		{
+			FScopeLock Lock(&RingsLock);
+
+			for (const TUniquePtr<FOATelemetryRing>& Ring : Rings)
+			{
+				RingsToDrain.Add(Ring.Get());
+			}
+		}
+
+		PendingEvents.Reset();
+
+		for (FOATelemetryRing* Ring : RingsToDrain)
+		{
+			Ring->Drain(PendingEvents);
+		}
+
+		FileWriter.Write(PendingEvents);
+	}
+
+	/** File the events are written to */
+	FOATelemetryFileWriter FileWriter;
+
+	/** Rings owned by the producing threads */
+	TArray<TUniquePtr<FOATelemetryRing>> Rings;
+
+	/** Ring of each producing thread, by thread id */
+	TMap<uint32, FOATelemetryRing*> ThreadRings;
+
+	/** Guards ring registration. Never taken when pushing events */
+	FCriticalSection RingsLock;
+
+	/** Scratch array for drained events */
+	TArray<FOATelemetryEvent> PendingEvents;
+
+	/** Wakes the thread early when stopping */
+	FEvent* WakeEvent = nullptr;
+
+	/** Writer thread */
+	FRunnableThread* Thread = nullptr;
+
+	/** Set when the writer should finish */
+	std::atomic<bool> bStopping { false };
+};
+
+/**
+ * Per-thread cache of the rings this thread records into, by subsystem instance.
+ * Instance ids are never reused, so entries of deinitialized subsystems are never matched and just get replaced.
+ */
+struct FOATelemetryThreadRings
+{
+	static constexpr int32 NumEntries = 4;
+
+	uint32 InstanceIds[NumEntries] = {};
+	FOATelemetryRing* Rings[NumEntries] = {};
+
+	/** Entry replaced on the next miss */
+	int32 NextEntry = 0;
+};
+
+static thread_local FOATelemetryThreadRings GOATelemetryThreadRings;
+static std::atomic<uint32> GOATelemetryNextInstanceId { 1 };
+
+bool UOATelemetrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UOATelemetrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!CVarOATelemetryEnabled.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	InstanceId = GOATelemetryNextInstanceId.fetch_add(1);
+
+	// one file per level session
+	const FString LevelName = UWorld::RemovePIEPrefix(InWorld.GetMapName());
+	const FString FileName = FString::Printf(TEXT("%s_%s_%u%s"), *LevelName, *FDateTime::Now().ToString(), FPlatformProcess::GetCurrentProcessId(), OATelemetryFile::Extension);
+
+	Writer = MakeShared<FOATelemetryWriter>(OATelemetryFile::GetDefaultDirectory() / FileName, LevelName);
+}
+
+void UOATelemetrySubsystem::Deinitialize()
+{
+	if (Writer)
+	{
+		if (const uint32 NumDropped = Writer->GetNumDropped())
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("Telemetry dropped %u events because a ring buffer was full."), NumDropped);
+		}
+
+		// stops the thread after a final drain
+		Writer.Reset();
+	}
+
+	Super::Deinitialize();
+}
+
+void UOATelemetrySubsystem::RecordEvent(EOATelemetryEventType Type, const FVector& Location, FName Cause)
+{
+	if (!Writer)
+	{
+		return;
+	}
+
+	FOATelemetryEvent Event;
+	Event.Type = Type;
+	Event.Location = FVector3f(Location);
+	Event.Time = GetWorld()->GetTimeSeconds();
+	Event.Cause = Cause;
+
+	GetThreadRing()->Push(Event);
+}
+
+FName UOATelemetrySubsystem::GetCauseName(const AActor* CauseActor)
+{
+	return CauseActor ? CauseActor->GetClass()->GetFName() : NAME_None;
+}
+
+void UOATelemetrySubsystem::Record(const UObject* WorldContextObject, EOATelemetryEventType Type, const FVector& Location, FName Cause)
+{
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		if (UOATelemetrySubsystem* Telemetry = World->GetSubsystem<UOATelemetrySubsystem>())
+		{
+			Telemetry->RecordEvent(Type, Location, Cause);
+		}
+	}
+}
+
+FOATelemetryRing* UOATelemetrySubsystem::GetThreadRing()
+{
+	FOATelemetryThreadRings& Cache = GOATelemetryThreadRings;
+
+	// fast path, this thread already has a ring for this subsystem
+	for (int32 Entry = 0; Entry < FOATelemetryThreadRings::NumEntries; ++Entry)
+	{
+		if (Cache.InstanceIds[Entry] == InstanceId)
+		{
+			return Cache.Rings[Entry];
+		}
+	}
+
+	// the writer keeps one ring per thread, so threads switching between subsystems
+	// (multi-client PIE, reloaded worlds) find their ring again instead of adding another
+	FOATelemetryRing* Ring = Writer->FindOrAddRing(FPlatformTLS::GetCurrentThreadId());
+
+	Cache.InstanceIds[Cache.NextEntry] = InstanceId;
+	Cache.Rings[Cache.NextEntry] = Ring;
+	Cache.NextEntry = (Cache.NextEntry + 1) % FOATelemetryThreadRings::NumEntries;
+
+	return Ring;
+}
+
+////////////////////////////////////////////////////////////////////
+
+/** Measures the cost of recording a telemetry event on the calling thread */
+static FAutoConsoleCommandWithWorldAndArgs CVarOATelemetryBenchmark(
+	TEXT("OA.Telemetry.Benchmark"),
+	TEXT("Records N telemetry events and reports the average cost per event. Usage: OA.Telemetry.Benchmark [NumEvents=1000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UOATelemetrySubsystem* Telemetry = World ? World->GetSubsystem<UOATelemetrySubsystem>() : nullptr;
+
+		if (!Telemetry)
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("OA.Telemetry.Benchmark requires a game world."));
+			return;
+		}
+
+		// stay under the ring capacity so we measure pushes, not drops
+		const int32 NumEvents = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, static_cast<int32>(FOATelemetryRing::Capacity)) : 1000;
+		const FName Cause(TEXT("Benchmark"));
+
+		const double Start = FPlatformTime::Seconds();
+
+		for (int32 i = 0; i < NumEvents; ++i)
+		{
+			Telemetry->RecordEvent(EOATelemetryEventType::Knockback, FVector(i, 0.0f, 0.0f), Cause);
+		}
+
+		const double Elapsed = FPlatformTime::Seconds() - Start;
+
+		UE_LOG(LogObstacle_Avoidance, Log, TEXT("Telemetry benchmark: %d events in %.3f us, %.1f ns per event"),
+			NumEvents, Elapsed * 1e6, Elapsed * 1e9 / NumEvents);
+	})
+);
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "OATelemetryTypes.h"
+#include "OATelemetrySubsystem.generated.h"
+
+class FOATelemetryWriter;
+
+/**
+ *  Records gameplay telemetry events (deaths, respawns, knockbacks) for the current level.
+ *  Each recording thread pushes events into its own lock-free ring buffer,
+ *  and a background thread drains the rings into a compact binary file under Saved/Telemetry.
+ *  Use the OATelemetryHeatmap commandlet to turn the files into per level death heatmaps.
+ *  Recording is toggled with OA.Telemetry.Enabled.
+ */
+UCLASS()
+class UOATelemetrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Background writer draining the event rings */
+	TSharedPtr<FOATelemetryWriter> Writer;
+
+	/** Unique id for this subsystem instance, used to match thread local ring caches. Never reused */
+	uint32 InstanceId = 0;
+
+public:
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Starts the background writer for the current level */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** Stops the background writer and flushes pending events */
+	virtual void Deinitialize() override;
+
+	/** Records an event. Safe to call from any thread */
+	void RecordEvent(EOATelemetryEventType Type, const FVector& Location, FName Cause);
+
+	/** Returns the telemetry cause name for an actor */
+	static FName GetCauseName(const AActor* CauseActor);
+
+	/** Convenience helper to record an event from gameplay code on the game thread */
+	static void Record(const UObject* WorldContextObject, EOATelemetryEventType Type, const FVector& Location, FName Cause);
+
+protected:
+
+	/** Returns the calling thread's ring buffer in this subsystem's writer, creating it on first use */
+	FOATelemetryRing* GetThreadRing();
+};
@@ -0,0 +1,202 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "OATelemetryTypes.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Obstacle_Avoidance.h"
+
+namespace OATelemetryFile
+{
+	/** Identifies telemetry files */
+	static constexpr uint32 Magic = 0x4C54414F; // "OATL"
+
+	/** Current file format version */
+	static constexpr uint32 Version = 1;
+
+	/** Record kinds following the header */
+	enum class ERecordType : uint8
+	{
+		Name,
+		Event
+	};
+}
+
+bool FOATelemetryRing::Push(const FOATelemetryEvent& Event)
+{
+	const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+	const uint32 CurrentTail = Tail.load(std::memory_order_acquire);
+
+	// is the ring full?
+	if (CurrentHead - CurrentTail >= Capacity)
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	Events[CurrentHead & (Capacity - 1)] = Event;
+
+	// publish the event to the consumer
+	Head.store(CurrentHead + 1, std::memory_order_release);
+	return true;
+}
+
+int32 FOATelemetryRing::Drain(TArray<FOATelemetryEvent>& OutEvents)
+{
+	const uint32 CurrentTail = Tail.load(std::memory_order_relaxed);
+	const uint32 CurrentHead = Head.load(std::memory_order_acquire);
+	const uint32 NumEvents = CurrentHead - CurrentTail;
+
+	for (uint32 i = 0; i < NumEvents; ++i)
+	{
+		OutEvents.Add(Events[(CurrentTail + i) & (Capacity - 1)]);
+	}
+
+	// hand the slots back to the producer
+	Tail.store(CurrentHead, std::memory_order_release);
+	return NumEvents;
+}
+
+FString OATelemetryFile::GetDefaultDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Telemetry");
+}
+
+bool OATelemetryFile::Read(const FString& Path, FString& OutLevelName, TArray<FOATelemetryFileEvent>& OutEvents)
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*Path));
+
+	if (!Archive)
+	{
+		return false;
+	}
+
+	uint32 FileMagic = 0;
+	uint32 FileVersion = 0;
+	*Archive << FileMagic;
+	*Archive << FileVersion;
+
+	if (FileMagic != Magic || FileVersion != Version)
+	{
+		UE_LOG(LogObstacle_Avoidance, Warning, TEXT("Skipping telemetry file with an unknown format: %s"), *Path);
+		return false;
+	}
+
+	*Archive << OutLevelName;
+
+	TArray<FString> Names;
+
+	while (!Archive->AtEnd() && !Archive->IsError())
+	{
+		uint8 RecordType = 0;
+		*Archive << RecordType;
+
+		if (RecordType == static_cast<uint8>(ERecordType::Name))
+		{
+			FString Name;
+			*Archive << Name;
+			Names.Add(MoveTemp(Name));
+		}
+		else if (RecordType == static_cast<uint8>(ERecordType::Event))
+		{
+			uint8 EventType = 0;
+			uint16 NameIndex = 0;
+
+			FOATelemetryFileEvent& Event = OutEvents.AddDefaulted_GetRef();
+			*Archive << EventType;
+			*Archive << NameIndex;
+			*Archive << Event.Time;
+			*Archive << Event.Location.X;
+			*Archive << Event.Location.Y;
+			*Archive << Event.Location.Z;
+
+			Event.Type = static_cast<EOATelemetryEventType>(EventType);
+			Event.Cause = Names.IsValidIndex(NameIndex) ? Names[NameIndex] : FString();
+		}
+		else
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("Telemetry file is truncated or corrupt: %s"), *Path);
+			break;
+		}
+	}
+
+	return !Archive->IsError();
+}
+
+FOATelemetryFileWriter::FOATelemetryFileWriter(const FString& InPath, const FString& InLevelName)
+	: Path(InPath)
+	, LevelName(InLevelName)
+{
+}
+
+FOATelemetryFileWriter::~FOATelemetryFileWriter()
+{
+	if (Archive)
+	{
+		Archive->Close();
+	}
+}
+
+void FOATelemetryFileWriter::Write(const TArray<FOATelemetryEvent>& Events)
+{
+	using namespace OATelemetryFile;
+
+	if (Events.IsEmpty())
+	{
+		return;
+	}
+
+	// only create the file once there is something to write
+	if (!Archive)
+	{
+		Archive.Reset(IFileManager::Get().CreateFileWriter(*Path));
+
+		if (!Archive)
+		{
+			UE_LOG(LogObstacle_Avoidance, Warning, TEXT("Could not create telemetry file: %s"), *Path);
+			return;
+		}
+
+		uint32 FileMagic = Magic;
+		uint32 FileVersion = Version;
+		*Archive << FileMagic;
+		*Archive << FileVersion;
+		*Archive << LevelName;
+	}
+
+	for (const FOATelemetryEvent& Event : Events)
+	{
+		// write the cause name the first time we see it
+		uint16* NameIndex = NameIndices.Find(Event.Cause);
+
+		if (!NameIndex)
+		{
+			uint8 RecordType = static_cast<uint8>(ERecordType::Name);
+			FString Name = Event.Cause.ToString();
+			*Archive << RecordType;
+			*Archive << Name;
+
+			NameIndex = &NameIndices.Add(Event.Cause, static_cast<uint16>(NameIndices.Num()));
+		}
+
+		uint8 RecordType = static_cast<uint8>(ERecordType::Event);
+		uint8 EventType = static_cast<uint8>(Event.Type);
+		float Time = Event.Time;
+		FVector3f Location = Event.Location;
+
+		*Archive << RecordType;
+		*Archive << EventType;
+		*Archive << *NameIndex;
+		*Archive << Time;
+		*Archive << Location.X;
+		*Archive << Location.Y;
+		*Archive << Location.Z;
+	}
+}
+
+void FOATelemetryFileWriter::Flush()
+{
+	if (Archive)
+	{
+		Archive->Flush();
+	}
+}
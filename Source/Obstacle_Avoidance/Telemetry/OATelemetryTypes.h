@@ -0,0 +1,124 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/** Kinds of gameplay telemetry events */
+enum class EOATelemetryEventType : uint8
+{
+	Death,
+	Respawn,
+	Knockback
+};
+
+/**
+ * A single gameplay telemetry event, as recorded at runtime.
+ * Kept small and trivially copyable so it can be pushed through the ring buffers.
+ */
+struct FOATelemetryEvent
+{
+	/** World location of the event */
+	FVector3f Location = FVector3f::ZeroVector;
+
+	/** World time of the event, in seconds */
+	float Time = 0.0f;
+
+	/** Class name of the actor that caused the event, or a short tag for causes without an actor */
+	FName Cause;
+
+	/** Event kind */
+	EOATelemetryEventType Type = EOATelemetryEventType::Death;
+};
+
+/**
+ * Fixed size single producer / single consumer ring of telemetry events.
+ * Each producing thread owns one ring, and the telemetry writer thread is its only consumer,
+ * so pushing an event never takes a lock or allocates.
+ */
+struct FOATelemetryRing
+{
+	/** Number of events the ring can hold. Must be a power of two */
+	static constexpr uint32 Capacity = 4096;
+
+	/** Adds an event. Returns false and drops the event if the ring is full. Producer thread only */
+	bool Push(const FOATelemetryEvent& Event);
+
+	/** Moves all pending events into the output array. Consumer thread only */
+	int32 Drain(TArray<FOATelemetryEvent>& OutEvents);
+
+	/** Number of events dropped because the ring was full */
+	std::atomic<uint32> NumDropped { 0 };
+
+private:
+
+	/** Event storage */
+	FOATelemetryEvent Events[Capacity];
+
+	/** Next slot to write, only advanced by the producer */
+	std::atomic<uint32> Head { 0 };
+
+	/** Next slot to read, only advanced by the consumer */
+	std::atomic<uint32> Tail { 0 };
+};
+
+/**
+ * Telemetry event as read back from a file, with its cause resolved to a string.
+ */
+struct FOATelemetryFileEvent
+{
+	FVector3f Location = FVector3f::ZeroVector;
+	float Time = 0.0f;
+	FString Cause;
+	EOATelemetryEventType Type = EOATelemetryEventType::Death;
+};
+
+/**
+ * Compact binary telemetry file format.
+ * A header with the level name, followed by records. Cause names are written once
+ * in a name record and referenced by index from event records.
+ */
+namespace OATelemetryFile
+{
+	/** File extension for telemetry files */
+	inline const TCHAR* Extension = TEXT(".oatl");
+
+	/** Returns the default directory telemetry files are written to */
+	FString GetDefaultDirectory();
+
+	/** Reads a telemetry file. Returns false if the file is missing or malformed */
+	bool Read(const FString& Path, FString& OutLevelName, TArray<FOATelemetryFileEvent>& OutEvents);
+}
+
+/**
+ * Writes telemetry events to a single file.
+ * Only used from the telemetry writer thread.
+ */
+class FOATelemetryFileWriter
+{
+public:
+
+	FOATelemetryFileWriter(const FString& InPath, const FString& InLevelName);
+	~FOATelemetryFileWriter();
+
+	/** Appends events to the file, opening it on first use */
+	void Write(const TArray<FOATelemetryEvent>& Events);
+
+	/** Flushes buffered data to disk */
+	void Flush();
+
+private:
+
+	/** File path */
+	FString Path;
+
+	/** Level name written in the header */
+	FString LevelName;
+
+	/** Open file, if any */
+	TUniquePtr<FArchive> Archive;
+
+	/** Indices of the cause names already written to the file */
+	TMap<FName, uint16> NameIndices;
+};
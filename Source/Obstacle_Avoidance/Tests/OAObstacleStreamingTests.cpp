@@ -0,0 +1,233 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Streaming tests for obstacle courses
+ * Streams a long generated course in and out the way World Partition unloads cells, and checks
+ * obstacles keep their phase across reloads and memory stays within budget
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectGlobals.h"
+#include "OAMovingPlatform.h"
+#include "OARotatingPillar.h"
+#include "OALaserBeam.h"
+#include "OACannon.h"
+#include "OATrapFloor.h"
+#include "OAObstacleStreamingSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OAObstacleStreamingTests
+{
+	/** Number of cells in the generated course */
+	constexpr int32 NumCells = 24;
+
+	/** Obstacles generated per cell */
+	constexpr int32 ObstaclesPerCell = 20;
+
+	/** Length of a cell along the course */
+	constexpr float CellLength = 4000.0f;
+
+	/** Number of cells around the runner kept loaded at once */
+	constexpr int32 LoadedCells = 3;
+
+	/** Game time spent in each cell */
+	constexpr float TimePerCell = 1.0f;
+
+	/** Frame time used to tick the world */
+	constexpr float FrameTime = 1.0f / 30.0f;
+
+	/** Max memory growth allowed while streaming the course */
+	constexpr uint64 PeakMemoryBudget = 512ull * 1024ull * 1024ull;
+
+	/** Creates a game world that has begun play */
+	UWorld* CreateGameWorld()
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		return World;
+	}
+
+	/** Tears down a world created by CreateGameWorld */
+	void DestroyGameWorld(UWorld* World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	/** Ticks the world for the provided amount of game time */
+	void TickWorld(UWorld* World, float Time)
+	{
+		for (float Elapsed = 0.0f; Elapsed < Time; Elapsed += FrameTime)
+		{
+			World->Tick(LEVELTICK_All, FrameTime);
+		}
+	}
+
+	/** Returns the obstacle class generated at the provided index */
+	UClass* GetObstacleClass(int32 Index)
+	{
+		switch (Index % 5)
+		{
+		case 0: return AOAMovingPlatform::StaticClass();
+		case 1: return AOARotatingPillar::StaticClass();
+		case 2: return AOALaserBeam::StaticClass();
+		case 3: return AOACannon::StaticClass();
+		default: return AOATrapFloor::StaticClass();
+		}
+	}
+
+	/** Spawns the obstacles of a cell. Names are stable, as they are for actors in a World Partition cell */
+	TArray<AActor*> LoadCell(UWorld* World, int32 CellIndex)
+	{
+		TArray<AActor*> Obstacles;
+
+		for (int32 i = 0; i < ObstaclesPerCell; ++i)
+		{
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.Name = *FString::Printf(TEXT("Cell%d_Obstacle%d"), CellIndex, i);
+			SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Required_ErrorAndReturnNull;
+
+			const FVector Location(CellIndex * CellLength + i * (CellLength / ObstaclesPerCell), 0.0f, 0.0f);
+
+			if (AActor* Obstacle = World->SpawnActor(GetObstacleClass(i), &Location, nullptr, SpawnParams))
+			{
+				Obstacles.Add(Obstacle);
+			}
+		}
+
+		return Obstacles;
+	}
+
+	/** Removes the obstacles of a cell from the world the way a cell unload does, then frees them */
+	void UnloadCell(TArray<AActor*>& Obstacles)
+	{
+		for (AActor* Obstacle : Obstacles)
+		{
+			Obstacle->RouteEndPlay(EEndPlayReason::RemovedFromWorld);
+			Obstacle->Destroy();
+		}
+
+		Obstacles.Reset();
+	}
+
+	/** Returns the saved phase of a streamable obstacle */
+	FOAObstacleStreamingState GetState(const AActor* Obstacle)
+	{
+		FOAObstacleStreamingState State;
+		CastChecked<IOAStreamableObstacle>(Obstacle)->SaveStreamingState(State);
+		return State;
+	}
+}
+
+// ===== Streaming Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOAObstacleStreaming_LongCourse,
+	"Obstacle_Avoidance.Streaming.LongCourse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOAObstacleStreaming_LongCourse::RunTest(const FString& Parameters)
+{
+	using namespace OAObstacleStreamingTests;
+
+	UWorld* World = CreateGameWorld();
+	UOAObstacleStreamingSubsystem* Streaming = UOAObstacleStreamingSubsystem::Get(World);
+
+	if (!TestNotNull("Game worlds should have an obstacle streaming subsystem", Streaming))
+	{
+		DestroyGameWorld(World);
+		return false;
+	}
+
+	// obstacles that never unload, spawned alongside the first cell to compare phases against
+	const FVector ControlLocation(0.0f, 10000.0f, 0.0f);
+	AActor* ControlPlatform = World->SpawnActor(AOAMovingPlatform::StaticClass(), &ControlLocation);
+	AActor* ControlPillar = World->SpawnActor(AOARotatingPillar::StaticClass(), &ControlLocation);
+
+	TArray<TArray<AActor*>> Cells;
+	Cells.SetNum(NumCells);
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	const uint64 BaselineMemory = FPlatformMemory::GetStats().UsedPhysical;
+	uint64 PeakMemory = BaselineMemory;
+
+	// run to the end of the course and back, so every cell but the last is unloaded and reloaded
+	TArray<int32> Route;
+	for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+	{
+		Route.Add(CellIndex);
+	}
+	for (int32 CellIndex = NumCells - 2; CellIndex >= 0; --CellIndex)
+	{
+		Route.Add(CellIndex);
+	}
+
+	for (const int32 RunnerCell : Route)
+	{
+		// stream in the cells around the runner and stream out the rest
+		for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+		{
+			const bool bShouldBeLoaded = FMath::Abs(CellIndex - RunnerCell) < LoadedCells;
+
+			if (bShouldBeLoaded && Cells[CellIndex].IsEmpty())
+			{
+				Cells[CellIndex] = LoadCell(World, CellIndex);
+				TestEqual(FString::Printf(TEXT("Cell %d should spawn all its obstacles"), CellIndex), Cells[CellIndex].Num(), ObstaclesPerCell);
+			}
+			else if (!bShouldBeLoaded && !Cells[CellIndex].IsEmpty())
+			{
+				UnloadCell(Cells[CellIndex]);
+			}
+		}
+
+		// unloaded actors are freed by the next garbage collection
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		TickWorld(World, TimePerCell);
+
+		PeakMemory = FMath::Max(PeakMemory, FPlatformMemory::GetStats().UsedPhysical);
+	}
+
+	// the first cell is back in, so its obstacles should be in step with the ones that never left
+	const FOAObstacleStreamingState ControlPlatformState = GetState(ControlPlatform);
+	const FOAObstacleStreamingState PlatformState = GetState(Cells[0][0]);
+
+	TestEqual("Reloaded platform should keep its direction", PlatformState.Direction, ControlPlatformState.Direction);
+	TestEqual("Reloaded platform should keep its place on the path", PlatformState.Phase, ControlPlatformState.Phase, 10.0f);
+
+	const float PillarYawDelta = FMath::FindDeltaAngleDegrees(GetState(Cells[0][1]).Phase, GetState(ControlPillar).Phase);
+	TestEqual("Reloaded pillar should keep its arm angle", PillarYawDelta, 0.0f, 5.0f);
+
+	// every cell that's currently unloaded should have left its state behind
+	int32 NumUnloadedCells = 0;
+	for (const TArray<AActor*>& Cell : Cells)
+	{
+		NumUnloadedCells += Cell.IsEmpty() ? 1 : 0;
+	}
+
+	TestEqual("Unloaded obstacles should have saved states", Streaming->GetNumSavedStates(), NumUnloadedCells * ObstaclesPerCell);
+
+	const uint64 PeakGrowth = PeakMemory - BaselineMemory;
+	AddInfo(FString::Printf(TEXT("Peak memory growth while streaming: %.1f MB"), PeakGrowth / (1024.0 * 1024.0)));
+	TestTrue("Peak memory while streaming should stay within budget", PeakGrowth < PeakMemoryBudget);
+
+	DestroyGameWorld(World);
+
+	return true;
+}
+
+#endif
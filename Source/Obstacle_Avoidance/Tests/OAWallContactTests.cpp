@@ -0,0 +1,134 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Unit tests for the shared wall contact cache
+ * Simulates movement impacts and checks when cached contacts are reused
+ */
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "OAWallContactComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OAWallContactTests
+{
+	/** Builds a blocking hit against a surface at the provided point with the provided normal */
+	FHitResult MakeHit(const FVector& ImpactPoint, const FVector& ImpactNormal)
+	{
+		FHitResult Hit;
+		Hit.bBlockingHit = true;
+		Hit.ImpactPoint = ImpactPoint;
+		Hit.Location = ImpactPoint;
+		Hit.ImpactNormal = ImpactNormal;
+		Hit.Normal = ImpactNormal;
+		return Hit;
+	}
+}
+
+// ===== Impact Recording Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOAWallContact_RecordsWalls,
+	"Obstacle_Avoidance.WallContact.RecordsWalls",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOAWallContact_RecordsWalls::RunTest(const FString& Parameters)
+{
+	UOAWallContactComponent* WallContact = NewObject<UOAWallContactComponent>();
+	FHitResult OutHit;
+
+	// a wall 35 units ahead along +X, facing back at us
+	WallContact->RecordImpact(OAWallContactTests::MakeHit(FVector(35.0f, 0.0f, 0.0f), FVector(-1.0f, 0.0f, 0.0f)), 1.0);
+
+	TestTrue("Wall contact should be reused while facing the wall", WallContact->GetCachedWall(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), 50.0f, 1.05, OutHit));
+	TestEqual("Cached contact should keep the wall normal", OutHit.ImpactNormal, FVector(-1.0f, 0.0f, 0.0f));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOAWallContact_IgnoresFloors,
+	"Obstacle_Avoidance.WallContact.IgnoresFloors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOAWallContact_IgnoresFloors::RunTest(const FString& Parameters)
+{
+	UOAWallContactComponent* WallContact = NewObject<UOAWallContactComponent>();
+	FHitResult OutHit;
+
+	// floor and ceiling impacts
+	WallContact->RecordImpact(OAWallContactTests::MakeHit(FVector(0.0f, 0.0f, -90.0f), FVector::UpVector), 1.0);
+	WallContact->RecordImpact(OAWallContactTests::MakeHit(FVector(0.0f, 0.0f, 90.0f), FVector::DownVector), 1.0);
+
+	TestFalse("Floor and ceiling impacts should not be cached", WallContact->GetCachedWall(FVector::ZeroVector, FVector::DownVector, 100.0f, 1.0, OutHit));
+
+	// non-blocking hits
+	FHitResult Overlap = OAWallContactTests::MakeHit(FVector(35.0f, 0.0f, 0.0f), FVector(-1.0f, 0.0f, 0.0f));
+	Overlap.bBlockingHit = false;
+	WallContact->RecordImpact(Overlap, 1.0);
+
+	TestFalse("Non-blocking hits should not be cached", WallContact->GetCachedWall(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), 50.0f, 1.0, OutHit));
+
+	return true;
+}
+
+// ===== Cache Staleness Tests =====
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOAWallContact_StaleContacts,
+	"Obstacle_Avoidance.WallContact.StaleContacts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOAWallContact_StaleContacts::RunTest(const FString& Parameters)
+{
+	UOAWallContactComponent* WallContact = NewObject<UOAWallContactComponent>();
+	FHitResult OutHit;
+
+	WallContact->RecordImpact(OAWallContactTests::MakeHit(FVector(35.0f, 0.0f, 0.0f), FVector(-1.0f, 0.0f, 0.0f)), 1.0);
+
+	TestFalse("Old contacts should need a sweep", WallContact->GetCachedWall(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), 50.0f, 2.0, OutHit));
+	TestFalse("Contacts out of reach should need a sweep", WallContact->GetCachedWall(FVector(-100.0f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f), 50.0f, 1.0, OutHit));
+	TestFalse("Contacts behind us should need a sweep", WallContact->GetCachedWall(FVector(100.0f, 0.0f, 0.0f), FVector(1.0f, 0.0f, 0.0f), 50.0f, 1.0, OutHit));
+	TestFalse("Contacts we're facing away from should need a sweep", WallContact->GetCachedWall(FVector::ZeroVector, FVector(-1.0f, 0.0f, 0.0f), 50.0f, 1.0, OutHit));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOAWallContact_ClearedContacts,
+	"Obstacle_Avoidance.WallContact.ClearedContacts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter
+)
+
+bool FOAWallContact_ClearedContacts::RunTest(const FString& Parameters)
+{
+	UOAWallContactComponent* WallContact = NewObject<UOAWallContactComponent>();
+	FHitResult OutHit;
+
+	const FHitResult WallHit = OAWallContactTests::MakeHit(FVector(35.0f, 0.0f, 0.0f), FVector(-1.0f, 0.0f, 0.0f));
+
+	// wall jumping consumes the contact
+	WallContact->RecordImpact(WallHit, 1.0);
+	WallContact->ClearContact();
+
+	TestFalse("Cleared contacts should not be reused", WallContact->GetCachedWall(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), 50.0f, 1.0, OutHit));
+
+	// staying in the air keeps the contact
+	WallContact->RecordImpact(WallHit, 1.0);
+	WallContact->NotifyMovementModeChanged(MOVE_Falling);
+
+	TestTrue("Contacts should survive while falling", WallContact->GetCachedWall(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), 50.0f, 1.0, OutHit));
+
+	// landing drops the contact
+	WallContact->NotifyMovementModeChanged(MOVE_Walking);
+
+	TestFalse("Contacts should be dropped on landing", WallContact->GetCachedWall(FVector::ZeroVector, FVector(1.0f, 0.0f, 0.0f), 50.0f, 1.0, OutHit));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
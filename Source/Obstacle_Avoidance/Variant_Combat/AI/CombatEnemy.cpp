@@ -8,14 +8,22 @@
 #include "Components/WidgetComponent.h"
 #include "Engine/DamageEvents.h"
 #include "CombatLifeBar.h"
+#include "CombatLifeBarSubsystem.h"
 #include "TimerManager.h"
+#include "CombatRagdollSubsystem.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "OAAnimBudgetSubsystem.h"
 
-ACombatEnemy::ACombatEnemy()
+ACombatEnemy::ACombatEnemy(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(ACharacter::MeshComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
+	// run the mesh through the animation budget allocator
+	UOAAnimBudgetSubsystem::ConfigureBudgetedMesh(GetMesh());
+
 	// bind the attack montage ended delegate
 	OnAttackMontageEnded.BindUObject(this, &ACombatEnemy::AttackMontageEnded);
 
@@ -234,14 +242,27 @@ void ACombatEnemy::HandleDeath()
 	// hide the life bar
 	LifeBar->SetHiddenInGame(true);
 
+	// stop managing the life bar
+	if (UCombatLifeBarSubsystem* LifeBarSubsystem = UCombatLifeBarSubsystem::Get(this))
+	{
+		LifeBarSubsystem->UnregisterLifeBar(LifeBar);
+	}
+
 	// disable the collision capsule to avoid being hit again while dead
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	// disable character movement
 	GetCharacterMovement()->DisableMovement();
 
-	// enable full ragdoll physics
-	GetMesh()->SetSimulatePhysics(true);
+	// enable full ragdoll physics, within the level's ragdoll budget
+	if (UCombatRagdollSubsystem* RagdollSubsystem = UCombatRagdollSubsystem::Get(this))
+	{
+		RagdollSubsystem->StartRagdoll(GetMesh());
+	}
+	else
+	{
+		GetMesh()->SetSimulatePhysics(true);
+	}
 
 	// call the died delegate to notify any subscribers
 	OnEnemyDied.Broadcast();
@@ -294,6 +315,12 @@ float ACombatEnemy::TakeDamage(float Damage, struct FDamageEvent const& DamageEv
 		// update the life bar
 		LifeBarWidget->SetLifePercentage(CurrentHP / MaxHP);
 
+		// let the life bar manager redraw it
+		if (UCombatLifeBarSubsystem* LifeBarSubsystem = UCombatLifeBarSubsystem::Get(this))
+		{
+			LifeBarSubsystem->SetLifePercentage(LifeBar, CurrentHP / MaxHP);
+		}
+
 		// enable partial ragdoll physics, but keep the pelvis vertical
 		GetMesh()->SetPhysicsBlendWeight(0.5f);
 		GetMesh()->SetBodySimulatePhysics(PelvisBoneName, false);
@@ -332,6 +359,12 @@ void ACombatEnemy::BeginPlay()
 
 	// fill the life bar
 	LifeBarWidget->SetLifePercentage(1.0f);
+
+	// register the life bar so it's only redrawn on damage events and hidden when far away
+	if (UCombatLifeBarSubsystem* LifeBarSubsystem = UCombatLifeBarSubsystem::Get(this))
+	{
+		LifeBarSubsystem->RegisterLifeBar(LifeBar, 1.0f);
+	}
 }
 
 void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
@@ -340,4 +373,10 @@ void ACombatEnemy::EndPlay(EEndPlayReason::Type EndPlayReason)
 
 	// clear the death timer
 	GetWorld()->GetTimerManager().ClearTimer(DeathTimer);
+
+	// stop managing the life bar
+	if (UCombatLifeBarSubsystem* LifeBarSubsystem = UCombatLifeBarSubsystem::Get(this))
+	{
+		LifeBarSubsystem->UnregisterLifeBar(LifeBar);
+	}
 }
@@ -8,6 +8,8 @@
 #include "Components/ArrowComponent.h"
 #include "TimerManager.h"
 #include "CombatEnemy.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
 
 ACombatEnemySpawner::ACombatEnemySpawner()
 {
@@ -100,6 +102,55 @@ void ACombatEnemySpawner::SpawnerDepleted()
 	}
 }
 
+void ACombatEnemySpawner::SpawnBenchmarkEnemies(int32 Count, float Spacing)
+{
+	// ensure the enemy class is valid
+	if (!IsValid(EnemyClass) || Count <= 0)
+	{
+		return;
+	}
+
+	// lay out the enemies in a square grid centered on the spawn capsule
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+	const FTransform SpawnTransform = SpawnCapsule->GetComponentTransform();
+	const float GridOffset = (GridSize - 1) * Spacing * 0.5f;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector LocalOffset((i / GridSize) * Spacing - GridOffset, (i % GridSize) * Spacing - GridOffset, 0.0f);
+
+		FTransform EnemyTransform = SpawnTransform;
+		EnemyTransform.SetLocation(SpawnTransform.TransformPosition(LocalOffset));
+
+		GetWorld()->SpawnActor<ACombatEnemy>(EnemyClass, EnemyTransform, SpawnParams);
+	}
+}
+
+/** Spawns a crowd of enemies from the first spawner in the level to benchmark the animation budget */
+static FAutoConsoleCommandWithWorldAndArgs CVarCombatSpawnBenchmarkEnemies(
+	TEXT("Combat.Benchmark.SpawnEnemies"),
+	TEXT("Spawns a grid of enemies from the first enemy spawner in the level. Usage: Combat.Benchmark.SpawnEnemies [Count=100] [Spacing=200]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100;
+		const float Spacing = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 200.0f;
+
+		for (TActorIterator<ACombatEnemySpawner> It(World); It; ++It)
+		{
+			It->SpawnBenchmarkEnemies(Count, Spacing);
+			break;
+		}
+	})
+);
+
 void ACombatEnemySpawner::ToggleInteraction(AActor* ActivationInstigator)
 {
 	// stub
@@ -89,6 +89,11 @@ protected:
 	/** Called after the last spawned enemy has died */
 	void SpawnerDepleted();
 
+public:
+
+	/** Spawns a grid of enemies around the spawner all at once, for crowd performance testing */
+	void SpawnBenchmarkEnemies(int32 Count, float Spacing);
+
 public:
 
 	// ~begin ICombatActivatable interface
@@ -9,7 +9,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AIController.h"
 #include "CombatEnemy.h"
-#include "Kismet/GameplayStatics.h"
+#include "OAPlayerInfoSubsystem.h"
 #include "StateTreeAsyncExecutionContext.h"
 
 bool FStateTreeCharacterGroundedCondition::TestCondition(FStateTreeExecutionContext& Context) const
@@ -301,14 +301,26 @@ EStateTreeRunStatus FStateTreeGetPlayerInfoTask::Tick(FStateTreeExecutionContext
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
-	// get the character possessed by the first local player
-	InstanceData.TargetPlayerCharacter = Cast<ACharacter>(UGameplayStatics::GetPlayerPawn(InstanceData.Character, 0));
+	// forget the last target, so it's cleared if the player is gone or there's no player info
+	InstanceData.TargetPlayerCharacter = nullptr;
 
-	// do we have a valid target?
-	if (InstanceData.TargetPlayerCharacter)
+	// read the player info shared by all agents this frame
+	if (UOAPlayerInfoSubsystem* PlayerInfoSubsystem = UOAPlayerInfoSubsystem::Get(InstanceData.Character))
 	{
-		// update the last known location
-		InstanceData.TargetPlayerLocation = InstanceData.TargetPlayerCharacter->GetActorLocation();
+		const FOAPlayerInfo& PlayerInfo = PlayerInfoSubsystem->GetPlayerInfo();
+
+		// get the character possessed by the first local player
+		InstanceData.TargetPlayerCharacter = Cast<ACharacter>(PlayerInfo.Pawn);
+
+		// do we have a valid target?
+		if (InstanceData.TargetPlayerCharacter)
+		{
+			// update the last known location and motion
+			InstanceData.TargetPlayerLocation = PlayerInfo.Location;
+			InstanceData.TargetPlayerVelocity = PlayerInfo.Velocity;
+			InstanceData.PredictedTargetLocation = PlayerInfo.PredictedLocation;
+			InstanceData.bTargetGrounded = PlayerInfo.bIsGrounded;
+		}
 	}
 
 	// update the distance
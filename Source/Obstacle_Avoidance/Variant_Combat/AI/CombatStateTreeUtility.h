@@ -339,6 +339,18 @@ struct FStateTreeGetPlayerInfoInstanceData
 	UPROPERTY(VisibleAnywhere)
 	FVector TargetPlayerLocation = FVector::ZeroVector;
 
+	/** Last known velocity for the target */
+	UPROPERTY(VisibleAnywhere)
+	FVector TargetPlayerVelocity = FVector::ZeroVector;
+
+	/** Predicted future location for the target */
+	UPROPERTY(VisibleAnywhere)
+	FVector PredictedTargetLocation = FVector::ZeroVector;
+
+	/** Is the target currently grounded? */
+	UPROPERTY(VisibleAnywhere)
+	bool bTargetGrounded = false;
+
 	/** Distance to the target */
 	UPROPERTY(VisibleAnywhere)
 	float DistanceToTarget = 0.0f;
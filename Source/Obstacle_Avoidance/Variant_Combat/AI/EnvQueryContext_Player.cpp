@@ -2,15 +2,23 @@
 
 
 #include "EnvQueryContext_Player.h"
-#include "Kismet/GameplayStatics.h"
+#include "OAPlayerInfoSubsystem.h"
 #include "EnvironmentQuery/EnvQueryTypes.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_Actor.h"
 #include "GameFramework/Pawn.h"
 
 void UEnvQueryContext_Player::ProvideContext(FEnvQueryInstance& QueryInstance, FEnvQueryContextData& ContextData) const
 {
-	// get the player pawn for the first local player
-	AActor* PlayerPawn = UGameplayStatics::GetPlayerPawn(QueryInstance.Owner.Get(), 0);
+	// get the player pawn for the first local player from the shared per-frame cache
+	UOAPlayerInfoSubsystem* PlayerInfoSubsystem = UOAPlayerInfoSubsystem::Get(QueryInstance.Owner.Get());
+
+	// the subsystem only exists in game worlds, EQS testing pawns in editor worlds get no context
+	if (!PlayerInfoSubsystem)
+	{
+		return;
+	}
+
+	AActor* PlayerPawn = PlayerInfoSubsystem->GetPlayerInfo().Pawn;
 	check(PlayerPawn);
 
 	// add the actor data to the context
@@ -13,6 +13,7 @@
 #include "CombatLifeBar.h"
 #include "Engine/DamageEvents.h"
 #include "TimerManager.h"
+#include "CombatRagdollSubsystem.h"
 #include "Engine/LocalPlayer.h"
 #include "CombatPlayerController.h"
 
@@ -407,8 +408,15 @@ void ACombatCharacter::HandleDeath()
 	// disable movement while we're dead
 	GetCharacterMovement()->DisableMovement();
 
-	// enable full ragdoll physics
-	GetMesh()->SetSimulatePhysics(true);
+	// enable full ragdoll physics, within the level's ragdoll budget
+	if (UCombatRagdollSubsystem* RagdollSubsystem = UCombatRagdollSubsystem::Get(this))
+	{
+		RagdollSubsystem->StartRagdoll(GetMesh());
+	}
+	else
+	{
+		GetMesh()->SetSimulatePhysics(true);
+	}
 
 	// hide the life bar
 	LifeBar->SetHiddenInGame(true);
@@ -14,6 +14,24 @@ class ACombatGameMode : public AGameModeBase
 {
 	GENERATED_BODY()
 	
+public:
+
+	/** Max number of death ragdolls that may simulate physics at once in this level. The oldest ragdolls are frozen first */
+	UPROPERTY(EditAnywhere, Category="Ragdoll Budget", meta = (ClampMin = 0, ClampMax = 100))
+	int32 MaxSimulatedRagdolls = 8;
+
+	/** Root body speed under which a death ragdoll is considered at rest */
+	UPROPERTY(EditAnywhere, Category="Ragdoll Budget", meta = (ClampMin = 0, ClampMax = 100, Units = "cm/s"))
+	float RagdollSettleSpeed = 5.0f;
+
+	/** Time a death ragdoll must stay at rest before it's frozen to a static pose */
+	UPROPERTY(EditAnywhere, Category="Ragdoll Budget", meta = (ClampMin = 0, ClampMax = 10, Units = "s"))
+	float RagdollSettleTime = 1.0f;
+
+	/** Max time a death ragdoll may simulate before it's frozen regardless of its speed */
+	UPROPERTY(EditAnywhere, Category="Ragdoll Budget", meta = (ClampMin = 0, ClampMax = 60, Units = "s"))
+	float RagdollMaxSimulationTime = 8.0f;
+
 public:
 
 	ACombatGameMode();
@@ -0,0 +1,162 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatRagdollSubsystem.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "CombatGameMode.h"
+
+DECLARE_CYCLE_STAT(TEXT("Ragdoll Budget Tick"), STAT_CombatRagdollTick, STATGROUP_CombatRagdoll);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Simulating Ragdolls"), STAT_CombatRagdollSimulating, STATGROUP_CombatRagdoll);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Simulating Ragdoll Bodies"), STAT_CombatRagdollBodies, STATGROUP_CombatRagdoll);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Frozen Ragdolls"), STAT_CombatRagdollFrozen, STATGROUP_CombatRagdoll);
+
+bool UCombatRagdollSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatRagdollSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// read the ragdoll budget for this level from the game mode
+	if (const ACombatGameMode* GameMode = Cast<ACombatGameMode>(InWorld.GetAuthGameMode()))
+	{
+		MaxSimulatedRagdolls = GameMode->MaxSimulatedRagdolls;
+		SettleSpeed = GameMode->RagdollSettleSpeed;
+		SettleTime = GameMode->RagdollSettleTime;
+		MaxSimulationTime = GameMode->RagdollMaxSimulationTime;
+	}
+}
+
+void UCombatRagdollSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_CombatRagdollTick);
+
+	if (SimulatingRagdolls.IsEmpty())
+	{
+		return;
+	}
+
+	const float CurrentTime = GetWorld()->GetTimeSeconds();
+
+	for (int32 i = SimulatingRagdolls.Num() - 1; i >= 0; --i)
+	{
+		FCombatRagdollEntry& Entry = SimulatingRagdolls[i];
+		USkeletalMeshComponent* Mesh = Entry.Mesh.Get();
+
+		// drop ragdolls that were destroyed or stopped simulating on their own
+		if (!IsValid(Mesh) || !Mesh->IsSimulatingPhysics())
+		{
+			SimulatingRagdolls.RemoveAt(i);
+			continue;
+		}
+
+		// is the root body at rest?
+		if (Mesh->GetPhysicsLinearVelocity().SizeSquared() < FMath::Square(SettleSpeed))
+		{
+			Entry.SettledTime += DeltaTime;
+		}
+		else
+		{
+			Entry.SettledTime = 0.0f;
+		}
+
+		// freeze ragdolls that have settled or simulated for too long
+		if (Entry.SettledTime >= SettleTime || CurrentTime - Entry.StartTime >= MaxSimulationTime)
+		{
+			FreezeRagdoll(Mesh);
+			SimulatingRagdolls.RemoveAt(i);
+		}
+	}
+
+	UpdateStats();
+}
+
+TStatId UCombatRagdollSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_CombatRagdollTick);
+}
+
+void UCombatRagdollSubsystem::StartRagdoll(USkeletalMeshComponent* Mesh)
+{
+	if (!IsValid(Mesh))
+	{
+		return;
+	}
+
+	// enable full ragdoll physics
+	Mesh->SetSimulatePhysics(true);
+
+	// track the ragdoll, newest last
+	FCombatRagdollEntry& Entry = SimulatingRagdolls.AddDefaulted_GetRef();
+	Entry.Mesh = Mesh;
+	Entry.StartTime = GetWorld()->GetTimeSeconds();
+
+	// make room for the new ragdoll if needed
+	EnforceBudget();
+
+	UpdateStats();
+}
+
+UCombatRagdollSubsystem* UCombatRagdollSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		return World->GetSubsystem<UCombatRagdollSubsystem>();
+	}
+
+	return nullptr;
+}
+
+void UCombatRagdollSubsystem::FreezeRagdoll(USkeletalMeshComponent* Mesh)
+{
+	// stop pose updates first so the mesh keeps the last simulated pose
+	Mesh->bNoSkeletonUpdate = true;
+	Mesh->SetComponentTickEnabled(false);
+
+	// put the bodies to sleep and take them out of the simulation
+	Mesh->PutAllRigidBodiesToSleep();
+	Mesh->SetSimulatePhysics(false);
+	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	++NumFrozenRagdolls;
+}
+
+void UCombatRagdollSubsystem::EnforceBudget()
+{
+	// freeze the oldest ragdolls first
+	while (SimulatingRagdolls.Num() > MaxSimulatedRagdolls)
+	{
+		if (USkeletalMeshComponent* Mesh = SimulatingRagdolls[0].Mesh.Get())
+		{
+			FreezeRagdoll(Mesh);
+		}
+
+		SimulatingRagdolls.RemoveAt(0);
+	}
+}
+
+void UCombatRagdollSubsystem::UpdateStats() const
+{
+#if STATS
+	int32 NumBodies = 0;
+
+	for (const FCombatRagdollEntry& Entry : SimulatingRagdolls)
+	{
+		if (const USkeletalMeshComponent* Mesh = Entry.Mesh.Get())
+		{
+			NumBodies += Mesh->Bodies.Num();
+		}
+	}
+
+	SET_DWORD_STAT(STAT_CombatRagdollSimulating, SimulatingRagdolls.Num());
+	SET_DWORD_STAT(STAT_CombatRagdollBodies, NumBodies);
+	SET_DWORD_STAT(STAT_CombatRagdollFrozen, NumFrozenRagdolls);
+#endif
+}
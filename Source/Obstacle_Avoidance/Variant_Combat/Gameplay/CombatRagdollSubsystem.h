@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Stats/Stats.h"
+#include "CombatRagdollSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+
+DECLARE_STATS_GROUP(TEXT("CombatRagdoll"), STATGROUP_CombatRagdoll, STATCAT_Advanced);
+
+/**
+ *  Tracking data for a single death ragdoll
+ */
+struct FCombatRagdollEntry
+{
+	/** Skeletal mesh simulating the ragdoll */
+	TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+
+	/** Game time the ragdoll started simulating */
+	float StartTime = 0.0f;
+
+	/** Time the ragdoll has spent below the settle speed */
+	float SettledTime = 0.0f;
+};
+
+/**
+ *  Keeps the number of simultaneously simulating death ragdolls within a budget.
+ *  Settled ragdolls are put to sleep and frozen to a static pose.
+ *  When a new ragdoll goes over the budget, the oldest simulating ragdoll is frozen.
+ *  Budget values are read from the level's ACombatGameMode on world begin play.
+ *  Use "stat CombatRagdoll" to view the physics cost.
+ */
+UCLASS()
+class UCombatRagdollSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Ragdolls currently simulating physics, oldest first */
+	TArray<FCombatRagdollEntry> SimulatingRagdolls;
+
+	/** Number of ragdolls frozen since the world started */
+	int32 NumFrozenRagdolls = 0;
+
+public:
+
+	/** Max number of death ragdolls allowed to simulate at once */
+	int32 MaxSimulatedRagdolls = 8;
+
+	/** Root body speed under which a ragdoll is considered at rest */
+	float SettleSpeed = 5.0f;
+
+	/** Time a ragdoll must stay at rest before it's frozen */
+	float SettleTime = 1.0f;
+
+	/** Max time a ragdoll may simulate before it's frozen regardless of its speed */
+	float MaxSimulationTime = 8.0f;
+
+public:
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Reads the per-level budget from the game mode */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** Checks simulating ragdolls for settling */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Returns the stat id for this tickable */
+	virtual TStatId GetStatId() const override;
+
+	/** Starts full ragdoll simulation on the mesh and tracks it against the budget */
+	void StartRagdoll(USkeletalMeshComponent* Mesh);
+
+	/** Returns the number of ragdolls currently simulating */
+	int32 GetNumSimulatingRagdolls() const { return SimulatingRagdolls.Num(); }
+
+	/** Convenience accessor for the subsystem owned by the given object's world */
+	static UCombatRagdollSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+
+	/** Puts the ragdoll to sleep and freezes it to its current pose */
+	void FreezeRagdoll(USkeletalMeshComponent* Mesh);
+
+	/** Freezes the oldest simulating ragdolls until we're within budget */
+	void EnforceBudget();
+
+	/** Updates the physics cost stats */
+	void UpdateStats() const;
+};
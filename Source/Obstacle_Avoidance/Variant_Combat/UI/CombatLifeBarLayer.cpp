@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatLifeBarLayer.h"
+#include "CombatLifeBarSubsystem.h"
+#include "Components/WidgetComponent.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Rendering/DrawElements.h"
+
+DECLARE_CYCLE_STAT(TEXT("Batched Life Bar Paint"), STAT_CombatLifeBarPaint, STATGROUP_CombatLifeBars);
+
+void UCombatLifeBarLayer::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	// the layer is purely visual
+	SetVisibility(ESlateVisibility::HitTestInvisible);
+}
+
+int32 UCombatLifeBarLayer::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	LayerId = Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	SCOPE_CYCLE_COUNTER(STAT_CombatLifeBarPaint);
+
+	const UCombatLifeBarSubsystem* LifeBarSubsystem = UCombatLifeBarSubsystem::Get(this);
+	APlayerController* PC = GetOwningPlayer();
+
+	if (!LifeBarSubsystem || !PC)
+	{
+		return LayerId;
+	}
+
+	const int32 BackgroundLayer = LayerId + 1;
+	const int32 FillLayer = LayerId + 2;
+
+	for (const FCombatLifeBarEntry& Entry : LifeBarSubsystem->GetLifeBars())
+	{
+		const UWidgetComponent* Component = Entry.Component.Get();
+
+		if (!Entry.bInRange || !Component)
+		{
+			continue;
+		}
+
+		// project the life bar anchor into the layer's space, skipping anything behind the camera
+		FVector2D ScreenPosition;
+
+		if (!UWidgetLayoutLibrary::ProjectWorldLocationToWidgetPosition(PC, Component->GetComponentLocation(), ScreenPosition, false))
+		{
+			continue;
+		}
+
+		// center the bar on the anchor
+		const FVector2D TopLeft = ScreenPosition - BarSize * 0.5f;
+
+		FSlateDrawElement::MakeBox(OutDrawElements, BackgroundLayer,
+			AllottedGeometry.ToPaintGeometry(BarSize, FSlateLayoutTransform(TopLeft)),
+			&BarBrush, ESlateDrawEffect::None, BackgroundColor * InWidgetStyle.GetColorAndOpacityTint());
+
+		const FVector2D FillSize(BarSize.X * FMath::Clamp(Entry.Percent, 0.0f, 1.0f), BarSize.Y);
+
+		FSlateDrawElement::MakeBox(OutDrawElements, FillLayer,
+			AllottedGeometry.ToPaintGeometry(FillSize, FSlateLayoutTransform(TopLeft)),
+			&BarBrush, ESlateDrawEffect::None, FillColor * InWidgetStyle.GetColorAndOpacityTint());
+	}
+
+	return FillLayer;
+}
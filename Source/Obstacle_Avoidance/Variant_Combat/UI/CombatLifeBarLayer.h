@@ -0,0 +1,46 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "Styling/SlateBrush.h"
+#include "CombatLifeBarLayer.generated.h"
+
+/**
+ *  Screen space layer that draws every in-range enemy life bar in a single paint pass.
+ *  Used by UCombatLifeBarSubsystem in batched mode instead of one widget component per enemy.
+ */
+UCLASS()
+class UCombatLifeBarLayer : public UUserWidget
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Brush used to draw the life bar background and fill */
+	UPROPERTY(EditAnywhere, Category="Life Bar")
+	FSlateBrush BarBrush;
+
+	/** Size of each life bar on screen */
+	UPROPERTY(EditAnywhere, Category="Life Bar")
+	FVector2D BarSize = FVector2D(80.0f, 8.0f);
+
+	/** Life bar background color */
+	UPROPERTY(EditAnywhere, Category="Life Bar")
+	FLinearColor BackgroundColor = FLinearColor(0.0f, 0.0f, 0.0f, 0.6f);
+
+	/** Life bar fill color */
+	UPROPERTY(EditAnywhere, Category="Life Bar")
+	FLinearColor FillColor = FLinearColor(0.8f, 0.05f, 0.05f, 1.0f);
+
+public:
+
+	/** Initialization */
+	virtual void NativeConstruct() override;
+
+protected:
+
+	/** Draws all in-range life bars */
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+};
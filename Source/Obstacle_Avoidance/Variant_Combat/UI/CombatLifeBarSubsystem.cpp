@@ -0,0 +1,217 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "CombatLifeBarSubsystem.h"
+#include "CombatLifeBarLayer.h"
+#include "Components/WidgetComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Life Bar Update"), STAT_CombatLifeBarUpdate, STATGROUP_CombatLifeBars);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Life Bars"), STAT_CombatLifeBarsRegistered, STATGROUP_CombatLifeBars);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Life Bars In Range"), STAT_CombatLifeBarsInRange, STATGROUP_CombatLifeBars);
+
+static TAutoConsoleVariable<bool> CVarCombatLifeBarBatched(
+	TEXT("Combat.LifeBar.Batched"),
+	false,
+	TEXT("If true, enemy life bars are drawn by a single screen space layer instead of one widget component each."));
+
+static TAutoConsoleVariable<float> CVarCombatLifeBarMaxDistance(
+	TEXT("Combat.LifeBar.MaxDistance"),
+	3000.0f,
+	TEXT("Enemy life bars farther than this distance from the camera are hidden, in cm."));
+
+static TAutoConsoleVariable<float> CVarCombatLifeBarRangeCheckInterval(
+	TEXT("Combat.LifeBar.RangeCheckInterval"),
+	0.2f,
+	TEXT("Time between enemy life bar distance checks, in seconds."));
+
+bool UCombatLifeBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatLifeBarSubsystem::Deinitialize()
+{
+	// remove the batched layer from the viewport
+	if (BatchedLayer)
+	{
+		BatchedLayer->RemoveFromParent();
+		BatchedLayer = nullptr;
+	}
+
+	LifeBars.Empty();
+
+	Super::Deinitialize();
+}
+
+void UCombatLifeBarSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_CombatLifeBarUpdate);
+
+	// drop life bars that were destroyed without unregistering
+	LifeBars.RemoveAllSwap([](const FCombatLifeBarEntry& Entry) { return !Entry.Component.IsValid(); });
+
+	// switch rendering modes if needed
+	const bool bWantsBatched = CVarCombatLifeBarBatched.GetValueOnGameThread();
+
+	if (bWantsBatched != bBatched)
+	{
+		SetBatched(bWantsBatched);
+	}
+
+	// throttle the distance checks
+	TimeSinceRangeCheck += DeltaTime;
+
+	if (TimeSinceRangeCheck < CVarCombatLifeBarRangeCheckInterval.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	TimeSinceRangeCheck = 0.0f;
+
+	// get the camera location for the first local player
+	const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+
+	if (!CameraManager)
+	{
+		return;
+	}
+
+	const FVector CameraLocation = CameraManager->GetCameraLocation();
+	const float MaxDistanceSquared = FMath::Square(CVarCombatLifeBarMaxDistance.GetValueOnGameThread());
+
+	int32 NumInRange = 0;
+
+	for (FCombatLifeBarEntry& Entry : LifeBars)
+	{
+		const bool bInRange = FVector::DistSquared(Entry.Component->GetComponentLocation(), CameraLocation) < MaxDistanceSquared;
+
+		// only touch the component if its range state changed
+		if (bInRange != Entry.bInRange)
+		{
+			Entry.bInRange = bInRange;
+			UpdateComponentVisibility(Entry);
+		}
+
+		NumInRange += bInRange ? 1 : 0;
+	}
+
+	SET_DWORD_STAT(STAT_CombatLifeBarsRegistered, LifeBars.Num());
+	SET_DWORD_STAT(STAT_CombatLifeBarsInRange, NumInRange);
+}
+
+TStatId UCombatLifeBarSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_CombatLifeBarUpdate);
+}
+
+void UCombatLifeBarSubsystem::RegisterLifeBar(UWidgetComponent* Component, float Percent)
+{
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	// only redraw the widget when its values change
+	Component->SetManuallyRedraw(true);
+	Component->RequestRedraw();
+
+	FCombatLifeBarEntry& Entry = LifeBars.AddDefaulted_GetRef();
+	Entry.Component = Component;
+	Entry.Percent = Percent;
+
+	UpdateComponentVisibility(Entry);
+}
+
+void UCombatLifeBarSubsystem::UnregisterLifeBar(UWidgetComponent* Component)
+{
+	LifeBars.RemoveAllSwap([Component](const FCombatLifeBarEntry& Entry) { return Entry.Component.Get() == Component; });
+}
+
+void UCombatLifeBarSubsystem::SetLifePercentage(UWidgetComponent* Component, float Percent)
+{
+	for (FCombatLifeBarEntry& Entry : LifeBars)
+	{
+		if (Entry.Component.Get() == Component)
+		{
+			Entry.Percent = Percent;
+
+			// redraw the widget component to pick up the new value
+			if (!bBatched)
+			{
+				Component->RequestRedraw();
+			}
+
+			return;
+		}
+	}
+}
+
+UCombatLifeBarSubsystem* UCombatLifeBarSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr)
+	{
+		return World->GetSubsystem<UCombatLifeBarSubsystem>();
+	}
+
+	return nullptr;
+}
+
+void UCombatLifeBarSubsystem::SetBatched(bool bNewBatched)
+{
+	if (bNewBatched)
+	{
+		// the batched layer needs a local player to draw for
+		APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
+
+		if (!PC || !PC->IsLocalController())
+		{
+			return;
+		}
+
+		if (!BatchedLayer)
+		{
+			BatchedLayer = CreateWidget<UCombatLifeBarLayer>(PC, UCombatLifeBarLayer::StaticClass());
+		}
+
+		BatchedLayer->AddToPlayerScreen();
+	}
+	else if (BatchedLayer)
+	{
+		BatchedLayer->RemoveFromParent();
+	}
+
+	bBatched = bNewBatched;
+
+	// show or hide the individual widget components
+	for (const FCombatLifeBarEntry& Entry : LifeBars)
+	{
+		if (Entry.Component.IsValid())
+		{
+			UpdateComponentVisibility(Entry);
+
+			// catch up with any changes we skipped while batched
+			if (!bBatched)
+			{
+				Entry.Component->RequestRedraw();
+			}
+		}
+	}
+}
+
+void UCombatLifeBarSubsystem::UpdateComponentVisibility(const FCombatLifeBarEntry& Entry) const
+{
+	UWidgetComponent* Component = Entry.Component.Get();
+	const bool bVisible = !bBatched && Entry.bInRange;
+
+	// hidden widget components don't need to tick
+	Component->SetVisibility(bVisible);
+	Component->SetComponentTickEnabled(bVisible);
+}
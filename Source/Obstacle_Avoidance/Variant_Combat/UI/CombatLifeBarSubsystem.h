@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Stats/Stats.h"
+#include "CombatLifeBarSubsystem.generated.h"
+
+class UWidgetComponent;
+class UCombatLifeBarLayer;
+
+DECLARE_STATS_GROUP(TEXT("CombatLifeBars"), STATGROUP_CombatLifeBars, STATCAT_Advanced);
+
+/**
+ *  Tracking data for a single enemy life bar
+ */
+struct FCombatLifeBarEntry
+{
+	/** World space widget component displaying the life bar */
+	TWeakObjectPtr<UWidgetComponent> Component;
+
+	/** Last reported 0-1 life percentage */
+	float Percent = 1.0f;
+
+	/** True if the life bar is within the max visible distance */
+	bool bInRange = true;
+};
+
+/**
+ *  Manages enemy life bars.
+ *  Hides life bars beyond a max distance from the camera and, in batched mode,
+ *  draws all visible life bars in a single screen space layer instead of one widget component each.
+ *  Life bar widget components are only redrawn when their values change.
+ *  Use "stat CombatLifeBars" together with "stat Slate" to measure the UI cost.
+ */
+UCLASS()
+class UCombatLifeBarSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Registered life bars */
+	TArray<FCombatLifeBarEntry> LifeBars;
+
+	/** Screen space layer used in batched mode */
+	UPROPERTY()
+	TObjectPtr<UCombatLifeBarLayer> BatchedLayer;
+
+	/** True if we're currently drawing through the batched layer */
+	bool bBatched = false;
+
+	/** Time since the last distance check */
+	float TimeSinceRangeCheck = 0.0f;
+
+public:
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Cleans up the batched layer */
+	virtual void Deinitialize() override;
+
+	/** Updates life bar visibility and the rendering mode */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Returns the stat id for this tickable */
+	virtual TStatId GetStatId() const override;
+
+	/** Starts managing the provided life bar widget component */
+	void RegisterLifeBar(UWidgetComponent* Component, float Percent);
+
+	/** Stops managing the provided life bar widget component */
+	void UnregisterLifeBar(UWidgetComponent* Component);
+
+	/** Updates the life percentage for a registered life bar after a damage or heal event */
+	void SetLifePercentage(UWidgetComponent* Component, float Percent);
+
+	/** Returns all registered life bars */
+	const TArray<FCombatLifeBarEntry>& GetLifeBars() const { return LifeBars; }
+
+	/** Convenience accessor for the subsystem owned by the given object's world */
+	static UCombatLifeBarSubsystem* Get(const UObject* WorldContextObject);
+
+protected:
+
+	/** Switches between per-component and batched rendering */
+	void SetBatched(bool bNewBatched);
+
+	/** Shows or hides a life bar widget component based on the rendering mode and its range */
+	void UpdateComponentVisibility(const FCombatLifeBarEntry& Entry) const;
+};
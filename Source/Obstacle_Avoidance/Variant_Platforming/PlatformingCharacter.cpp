@@ -13,6 +13,7 @@
 #include "EnhancedInputComponent.h"
 #include "TimerManager.h"
 #include "Engine/LocalPlayer.h"
+#include "OAWallContactComponent.h"
 
 APlatformingCharacter::APlatformingCharacter()
 {
@@ -76,6 +77,9 @@ APlatformingCharacter::APlatformingCharacter()
 	FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
 	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
 	FollowCamera->bUsePawnControlRotation = false;
+
+	// create the wall contact cache
+	WallContact = CreateDefaultSubobject<UOAWallContactComponent>(TEXT("WallContact"));
 }
 
 void APlatformingCharacter::Move(const FInputActionValue& Value)
@@ -114,17 +118,10 @@ void APlatformingCharacter::MultiJump()
 		// have we already wall jumped?
 		if (!bHasWallJumped)
 		{
-			// run a sphere sweep to check if we're in front of a wall
+			// check if we're in front of a wall, reusing the last wall we ran into if possible
 			FHitResult OutHit;
 
-			const FVector TraceStart = GetActorLocation();
-			const FVector TraceEnd = TraceStart + (GetActorForwardVector() * WallJumpTraceDistance);
-			const FCollisionShape TraceShape = FCollisionShape::MakeSphere(WallJumpTraceRadius);
-
-			FCollisionQueryParams QueryParams;
-			QueryParams.AddIgnoredActor(this);
-
-			if (GetWorld()->SweepSingleByChannel(OutHit, TraceStart, TraceEnd, FQuat(), ECollisionChannel::ECC_Visibility, TraceShape, QueryParams))
+			if (WallContact->FindWall(GetActorForwardVector(), WallJumpTraceDistance, WallJumpTraceRadius, OutHit))
 			{
 				// rotate the character to face away from the wall, so we're correctly oriented for the next wall jump
 				FRotator WallOrientation = OutHit.ImpactNormal.ToOrientationRotator();
@@ -138,6 +135,9 @@ void APlatformingCharacter::MultiJump()
 
 				LaunchCharacter(WallJumpImpulse, true, true);
 
+				// we're leaving this wall, so don't reuse it for the next wall jump
+				WallContact->ClearContact();
+
 				// enable the jump trail
 				SetJumpTrailState(true);
 
@@ -357,6 +357,9 @@ void APlatformingCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode
 {
 	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
 
+	// drop stale wall contacts
+	WallContact->NotifyMovementModeChanged(GetCharacterMovement()->MovementMode);
+
 	// are we falling?
 	if (GetCharacterMovement()->MovementMode == EMovementMode::MOVE_Falling)
 	{
@@ -5,12 +5,18 @@
 #include "Engine/World.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "TimerManager.h"
+#include "SkeletalMeshComponentBudgeted.h"
+#include "OAAnimBudgetSubsystem.h"
 
-ASideScrollingNPC::ASideScrollingNPC()
+ASideScrollingNPC::ASideScrollingNPC(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USkeletalMeshComponentBudgeted>(ACharacter::MeshComponentName))
 {
  	PrimaryActorTick.bCanEverTick = true;
 
 	GetCharacterMovement()->MaxWalkSpeed = 150.0f;
+
+	// run the mesh through the animation budget allocator
+	UOAAnimBudgetSubsystem::ConfigureBudgetedMesh(GetMesh());
 }
 
 void ASideScrollingNPC::EndPlay(EEndPlayReason::Type EndPlayReason)
@@ -5,20 +5,30 @@
 #include "StateTreeExecutionContext.h"
 #include "StateTreeExecutionTypes.h"
 #include "AIController.h"
-#include "Kismet/GameplayStatics.h"
+#include "OAPlayerInfoSubsystem.h"
 
 EStateTreeRunStatus FStateTreeGetPlayerTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
 {
 	// get the instance data
 	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
 
+	// read the player info shared by all agents this frame
+	UOAPlayerInfoSubsystem* PlayerInfoSubsystem = UOAPlayerInfoSubsystem::Get(InstanceData.Controller.Get());
+
+	if (!PlayerInfoSubsystem)
+	{
+		return EStateTreeRunStatus::Running;
+	}
+
+	const FOAPlayerInfo& PlayerInfo = PlayerInfoSubsystem->GetPlayerInfo();
+
 	// set the player pawn as the target
-	InstanceData.TargetPlayer = UGameplayStatics::GetPlayerPawn(InstanceData.Controller.Get(), 0);
+	InstanceData.TargetPlayer = PlayerInfo.Pawn;
 
 	// are the NPC and target valid?
 	if (IsValid(InstanceData.TargetPlayer) && IsValid(InstanceData.NPC))
 	{
-		InstanceData.bValidTarget = FVector::Distance(InstanceData.NPC->GetActorLocation(), InstanceData.TargetPlayer->GetActorLocation()) < InstanceData.RangeMax;
+		InstanceData.bValidTarget = FVector::DistSquared(InstanceData.NPC->GetActorLocation(), PlayerInfo.Location) < FMath::Square(InstanceData.RangeMax);
 	}
 
 	return EStateTreeRunStatus::Running;
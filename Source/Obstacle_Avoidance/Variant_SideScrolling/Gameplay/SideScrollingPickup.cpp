@@ -7,6 +7,7 @@
 #include "Components/SphereComponent.h"
 #include "Components/SceneComponent.h"
 #include "Engine/World.h"
+#include "SideScrollingPickupSubsystem.h"
 
 ASideScrollingPickup::ASideScrollingPickup()
 {
@@ -30,6 +31,38 @@ ASideScrollingPickup::ASideScrollingPickup()
 	OnActorBeginOverlap.AddDynamic(this, &ASideScrollingPickup::BeginOverlap);
 }
 
+void ASideScrollingPickup::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// should this pickup be rendered and collected through the pickup subsystem?
+	if (InstancedMesh)
+	{
+		if (USideScrollingPickupSubsystem* Pickups = GetWorld()->GetSubsystem<USideScrollingPickupSubsystem>())
+		{
+			// the subsystem draws and collects the pickup, so the actor itself goes dormant
+			SetActorHiddenInGame(true);
+			SetActorEnableCollision(false);
+
+			Pickups->RegisterPickup(this);
+		}
+	}
+}
+
+void ASideScrollingPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// collected pickups destroyed by their BP handler keep their instance so they can respawn
+	if (InstancedMesh && EndPlayReason == EEndPlayReason::RemovedFromWorld)
+	{
+		if (USideScrollingPickupSubsystem* Pickups = GetWorld()->GetSubsystem<USideScrollingPickupSubsystem>())
+		{
+			Pickups->UnregisterPickup(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ASideScrollingPickup::BeginOverlap(AActor* OverlappedActor, AActor* OtherActor)
 {
 	// have we collided against a character?
@@ -38,18 +71,28 @@ void ASideScrollingPickup::BeginOverlap(AActor* OverlappedActor, AActor* OtherAc
 		// is this the player character?
 		if (OverlappedCharacter->IsPlayerControlled())
 		{
-			// get the game mode
-			if (ASideScrollingGameMode* GM = Cast<ASideScrollingGameMode>(GetWorld()->GetAuthGameMode()))
-			{
-				// tell the game mode to process a pickup
-				GM->ProcessPickup();
-
-				// disable collision so we don't get picked up again
-				SetActorEnableCollision(false);
-
-				// Call the BP handler. It will be responsible for destroying the pickup
-				BP_OnPickedUp();
-			}
+			// disable collision so we don't get picked up again
+			SetActorEnableCollision(false);
+
+			Collect();
 		}
 	}
-}
\ No newline at end of file
+}
+
+void ASideScrollingPickup::Collect()
+{
+	// get the game mode
+	if (ASideScrollingGameMode* GM = Cast<ASideScrollingGameMode>(GetWorld()->GetAuthGameMode()))
+	{
+		// tell the game mode to process a pickup
+		GM->ProcessPickup();
+
+		// Call the BP handler. It will be responsible for destroying the pickup
+		BP_OnPickedUp();
+	}
+}
+
+float ASideScrollingPickup::GetPickupRadius() const
+{
+	return Sphere->GetScaledSphereRadius();
+}
@@ -7,10 +7,13 @@
 #include "SideScrollingPickup.generated.h"
 
 class USphereComponent;
+class UStaticMesh;
 
 /**
  *  A simple side scrolling game pickup
  *  Increments a counter on the GameMode
+ *  If an instanced mesh is set, the pickup is handed over to USideScrollingPickupSubsystem,
+ *  which renders it through a shared ISM and resolves collection without overlap events
  */
 UCLASS(abstract)
 class ASideScrollingPickup : public AActor
@@ -21,13 +24,48 @@ class ASideScrollingPickup : public AActor
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
 	USphereComponent* Sphere;
 
+protected:
+
+	/** If set, this pickup is rendered through an instanced mesh shared by all pickups using the same mesh */
+	UPROPERTY(EditAnywhere, Category="Pickup|Instancing")
+	TObjectPtr<UStaticMesh> InstancedMesh;
+
+	/** Relative transform of the instanced mesh */
+	UPROPERTY(EditAnywhere, Category="Pickup|Instancing")
+	FTransform InstancedMeshTransform;
+
+	/** Time after collection before an instanced pickup respawns. Zero or less never respawns */
+	UPROPERTY(EditAnywhere, Category="Pickup|Instancing", meta = (Units = "s"))
+	float RespawnTime = 0.0f;
+
 public:
 
 	/** Constructor */
 	ASideScrollingPickup();
 
+	/** Counts the pickup on the game mode and calls the BP pickup handler */
+	void Collect();
+
+	/** Returns the instanced mesh, if any */
+	UStaticMesh* GetInstancedMesh() const { return InstancedMesh; }
+
+	/** Returns the world transform for the instanced mesh */
+	FTransform GetInstancedMeshWorldTransform() const { return InstancedMeshTransform * GetActorTransform(); }
+
+	/** Returns the pickup radius */
+	float GetPickupRadius() const;
+
+	/** Returns the respawn time for instanced pickups */
+	float GetRespawnTime() const { return RespawnTime; }
+
 protected:
 
+	/** Hands instanced pickups over to the pickup subsystem */
+	virtual void BeginPlay() override;
+
+	/** Releases the instance of pickups removed with a streamed out level */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/** Handles pickup collision */
 	UFUNCTION()
 	void BeginOverlap(AActor* OverlappedActor, AActor* OtherActor);
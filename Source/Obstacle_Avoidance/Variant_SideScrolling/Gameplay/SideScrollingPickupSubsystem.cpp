@@ -0,0 +1,354 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingPickupSubsystem.h"
+#include "SideScrollingPickup.h"
+#include "SideScrollingGameMode.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Pickup Collection"), STAT_SideScrollingPickupTick, STATGROUP_SideScrollingPickups);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Pickups"), STAT_SideScrollingPickupsRegistered, STATGROUP_SideScrollingPickups);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Respawns"), STAT_SideScrollingPickupsPending, STATGROUP_SideScrollingPickups);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Instanced Meshes"), STAT_SideScrollingPickupMeshes, STATGROUP_SideScrollingPickups);
+
+bool USideScrollingPickupSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USideScrollingPickupSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	Cells.Empty();
+	PendingRespawns.Empty();
+	InstancedMeshes.Empty();
+	InstanceHost = nullptr;
+
+	Super::Deinitialize();
+}
+
+void USideScrollingPickupSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_SideScrollingPickupTick);
+
+	if (Entries.IsEmpty())
+	{
+		return;
+	}
+
+	TSet<UInstancedStaticMeshComponent*> DirtyMeshes;
+
+	RespawnPickups(DirtyMeshes);
+
+	// check every player character against the pickups around it
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		ACharacter* PlayerCharacter = PC ? Cast<ACharacter>(PC->GetPawn()) : nullptr;
+
+		if (!PlayerCharacter)
+		{
+			continue;
+		}
+
+		CollectPickups(PlayerCharacter, DirtyMeshes);
+	}
+
+	// push all instance changes to the renderer at once
+	for (UInstancedStaticMeshComponent* Mesh : DirtyMeshes)
+	{
+		Mesh->MarkRenderStateDirty();
+	}
+
+	SET_DWORD_STAT(STAT_SideScrollingPickupsRegistered, Entries.Num());
+	SET_DWORD_STAT(STAT_SideScrollingPickupsPending, PendingRespawns.Num());
+	SET_DWORD_STAT(STAT_SideScrollingPickupMeshes, InstancedMeshes.Num());
+}
+
+TStatId USideScrollingPickupSubsystem::GetStatId() const
+{
+	return GET_STATID(STAT_SideScrollingPickupTick);
+}
+
+void USideScrollingPickupSubsystem::RegisterPickup(ASideScrollingPickup* Pickup)
+{
+	if (!IsValid(Pickup) || !Pickup->GetInstancedMesh())
+	{
+		return;
+	}
+
+	UInstancedStaticMeshComponent* Mesh = GetOrCreateInstancedMesh(Pickup->GetInstancedMesh());
+
+	if (!Mesh)
+	{
+		return;
+	}
+
+	const int32 EntryIndex = Entries.Num();
+
+	FSideScrollingPickupEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Pickup = Pickup;
+	Entry.PickupClass = Pickup->GetClass();
+	Entry.Mesh = Mesh;
+	Entry.InstanceTransform = Pickup->GetInstancedMeshWorldTransform();
+	Entry.Location = Pickup->GetActorLocation();
+	Entry.Radius = Pickup->GetPickupRadius();
+	Entry.RespawnTime = Pickup->GetRespawnTime();
+	Entry.InstanceIndex = Mesh->AddInstance(Entry.InstanceTransform, true);
+	Entry.Cell = GetCell(Entry.Location.X);
+
+	Cells.FindOrAdd(Entry.Cell).Add(EntryIndex);
+
+	MaxPickupRadius = FMath::Max(MaxPickupRadius, Entry.Radius);
+}
+
+void USideScrollingPickupSubsystem::UnregisterPickup(ASideScrollingPickup* Pickup)
+{
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		FSideScrollingPickupEntry& Entry = Entries[i];
+
+		if (Entry.Pickup.Get() != Pickup)
+		{
+			continue;
+		}
+
+		// hide the instance instead of removing it so the other instance indices stay valid
+		if (!Entry.bCollected)
+		{
+			TSet<UInstancedStaticMeshComponent*> DirtyMeshes;
+			SetInstanceVisible(Entry, false, DirtyMeshes);
+
+			for (UInstancedStaticMeshComponent* Mesh : DirtyMeshes)
+			{
+				Mesh->MarkRenderStateDirty();
+			}
+
+			if (TArray<int32>* CellEntries = Cells.Find(Entry.Cell))
+			{
+				CellEntries->RemoveSwap(i);
+			}
+		}
+
+		// keep the entry slot so indices held by the grid stay valid, but never respawn it
+		PendingRespawns.RemoveSwap(i);
+		Entry.Pickup = nullptr;
+		Entry.RespawnTime = 0.0f;
+		Entry.bCollected = true;
+		return;
+	}
+}
+
+UInstancedStaticMeshComponent* USideScrollingPickupSubsystem::GetOrCreateInstancedMesh(UStaticMesh* Mesh)
+{
+	if (TObjectPtr<UInstancedStaticMeshComponent>* Existing = InstancedMeshes.Find(Mesh))
+	{
+		return *Existing;
+	}
+
+	// spawn a single actor to own all the instanced mesh components
+	if (!InstanceHost)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+
+		InstanceHost = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+
+		if (!InstanceHost)
+		{
+			return nullptr;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(InstanceHost, TEXT("Root"));
+		InstanceHost->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	// instances are placed in world space and collected through distance checks, so they need no collision
+	UInstancedStaticMeshComponent* InstancedMesh = NewObject<UInstancedStaticMeshComponent>(InstanceHost);
+	InstancedMesh->SetStaticMesh(Mesh);
+	InstancedMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	InstancedMesh->SetCanEverAffectNavigation(false);
+	InstancedMesh->SetupAttachment(InstanceHost->GetRootComponent());
+	InstancedMesh->RegisterComponent();
+	InstanceHost->AddInstanceComponent(InstancedMesh);
+
+	InstancedMeshes.Add(Mesh, InstancedMesh);
+
+	return InstancedMesh;
+}
+
+void USideScrollingPickupSubsystem::CollectPickups(ACharacter* PlayerCharacter, TSet<UInstancedStaticMeshComponent*>& DirtyMeshes)
+{
+	const UCapsuleComponent* Capsule = PlayerCharacter->GetCapsuleComponent();
+	const FVector CapsuleLocation = Capsule->GetComponentLocation();
+	const float CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+	const float CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+
+	const float QueryExtent = CapsuleRadius + MaxPickupRadius;
+	const int32 MinCell = GetCell(CapsuleLocation.X - QueryExtent);
+	const int32 MaxCell = GetCell(CapsuleLocation.X + QueryExtent);
+
+	// distance from the capsule center to the centers of its end spheres
+	const float SegmentHalfLength = FMath::Max(0.0f, CapsuleHalfHeight - CapsuleRadius);
+
+	ASideScrollingGameMode* GM = nullptr;
+
+	// listeners may register or unregister pickups, so only tell them once the grid isn't being walked
+	TArray<TPair<TSubclassOf<ASideScrollingPickup>, FTransform>, TInlineAllocator<4>> Collected;
+
+	for (int32 Cell = MinCell; Cell <= MaxCell; ++Cell)
+	{
+		TArray<int32>* CellEntries = Cells.Find(Cell);
+
+		if (!CellEntries)
+		{
+			continue;
+		}
+
+		for (int32 i = CellEntries->Num() - 1; i >= 0; --i)
+		{
+			const int32 EntryIndex = (*CellEntries)[i];
+			FSideScrollingPickupEntry& Entry = Entries[EntryIndex];
+
+			// find the closest point on the capsule's segment to the pickup
+			FVector ClosestPoint = CapsuleLocation;
+			ClosestPoint.Z += FMath::Clamp(Entry.Location.Z - CapsuleLocation.Z, -SegmentHalfLength, SegmentHalfLength);
+
+			// do the pickup sphere and the capsule touch?
+			if (FVector::DistSquared(ClosestPoint, Entry.Location) > FMath::Square(Entry.Radius + CapsuleRadius))
+			{
+				continue;
+			}
+
+			// take the pickup out of the grid until it respawns
+			CellEntries->RemoveAtSwap(i);
+			Entry.bCollected = true;
+			SetInstanceVisible(Entry, false, DirtyMeshes);
+
+			if (Entry.RespawnTime > 0.0f)
+			{
+				Entry.RespawnAt = GetWorld()->GetTimeSeconds() + Entry.RespawnTime;
+				PendingRespawns.Add(EntryIndex);
+			}
+
+			// let the pickup count itself and run its BP handler
+			if (ASideScrollingPickup* Pickup = Entry.Pickup.Get())
+			{
+				Pickup->Collect();
+			}
+			else
+			{
+				// the BP handler destroyed the actor on an earlier collection, so count the pickup ourselves
+				if (!GM)
+				{
+					GM = Cast<ASideScrollingGameMode>(GetWorld()->GetAuthGameMode());
+				}
+
+				if (GM)
+				{
+					GM->ProcessPickup();
+				}
+			}
+
+			// effects play where the instance was drawn, the actor may be long gone
+			if (OnPickupCollected.IsBound())
+			{
+				Collected.Emplace(Entry.PickupClass, Entry.InstanceTransform);
+			}
+		}
+	}
+
+	for (const TPair<TSubclassOf<ASideScrollingPickup>, FTransform>& Pickup : Collected)
+	{
+		OnPickupCollected.Broadcast(Pickup.Key, Pickup.Value, PlayerCharacter);
+	}
+}
+
+void USideScrollingPickupSubsystem::RespawnPickups(TSet<UInstancedStaticMeshComponent*>& DirtyMeshes)
+{
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	for (int32 i = PendingRespawns.Num() - 1; i >= 0; --i)
+	{
+		const int32 EntryIndex = PendingRespawns[i];
+		FSideScrollingPickupEntry& Entry = Entries[EntryIndex];
+
+		if (CurrentTime < Entry.RespawnAt)
+		{
+			continue;
+		}
+
+		// put the pickup back in the grid and show it again
+		PendingRespawns.RemoveAtSwap(i);
+		Entry.bCollected = false;
+		Cells.FindOrAdd(Entry.Cell).Add(EntryIndex);
+		SetInstanceVisible(Entry, true, DirtyMeshes);
+	}
+}
+
+void USideScrollingPickupSubsystem::SetInstanceVisible(FSideScrollingPickupEntry& Entry, bool bVisible, TSet<UInstancedStaticMeshComponent*>& DirtyMeshes)
+{
+	UInstancedStaticMeshComponent* Mesh = Entry.Mesh.Get();
+
+	if (!Mesh || Entry.InstanceIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// hidden instances are scaled to zero so instance indices never shift
+	FTransform Transform = Entry.InstanceTransform;
+
+	if (!bVisible)
+	{
+		Transform.SetScale3D(FVector::ZeroVector);
+	}
+
+	Mesh->UpdateInstanceTransform(Entry.InstanceIndex, Transform, true, false, true);
+	DirtyMeshes.Add(Mesh);
+}
+
+////////////////////////////////////////////////////////////////////
+
+/** Fills the level with copies of the first pickup to measure the instanced pickup path at scale */
+static FAutoConsoleCommandWithWorldAndArgs CVarSideScrollingSpawnPickups(
+	TEXT("SideScrolling.Benchmark.SpawnPickups"),
+	TEXT("Spawns a grid of copies of the first pickup in the level. Usage: SideScrolling.Benchmark.SpawnPickups [Count=500] [Spacing=150] [Rows=5]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 500;
+		const float Spacing = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 150.0f;
+		const int32 Rows = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 5;
+
+		for (TActorIterator<ASideScrollingPickup> It(World); It; ++It)
+		{
+			const FTransform Origin = It->GetActorTransform();
+
+			// lay the pickups out along the side scrolling plane
+			for (int32 i = 1; i <= Count; ++i)
+			{
+				FTransform SpawnTransform = Origin;
+				SpawnTransform.AddToTranslation(FVector((i / Rows) * Spacing, 0.0f, (i % Rows) * Spacing));
+
+				World->SpawnActor<ASideScrollingPickup>(It->GetClass(), SpawnTransform);
+			}
+
+			break;
+		}
+	})
+);
@@ -0,0 +1,143 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Stats/Stats.h"
+#include "SideScrollingPickupSubsystem.generated.h"
+
+class ASideScrollingPickup;
+class APawn;
+class ACharacter;
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+
+DECLARE_STATS_GROUP(TEXT("SideScrollingPickups"), STATGROUP_SideScrollingPickups, STATCAT_Advanced);
+
+/** Called when an instanced pickup is collected, with the pickup's class, its instance transform and the collecting pawn */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FSideScrollingPickupCollectedDelegate, TSubclassOf<ASideScrollingPickup>, PickupClass, const FTransform&, Transform, APawn*, CollectingPawn);
+
+/**
+ *  Tracking data for a single instanced pickup
+ */
+struct FSideScrollingPickupEntry
+{
+	/** Pickup actor this entry was registered from. May be destroyed by its BP after collection */
+	TWeakObjectPtr<ASideScrollingPickup> Pickup;
+
+	/** Class of the pickup actor, reported to OnPickupCollected listeners */
+	TSubclassOf<ASideScrollingPickup> PickupClass;
+
+	/** Instanced mesh component drawing this pickup */
+	TWeakObjectPtr<UInstancedStaticMeshComponent> Mesh;
+
+	/** World transform of the mesh instance */
+	FTransform InstanceTransform;
+
+	/** World location of the pickup sphere */
+	FVector Location = FVector::ZeroVector;
+
+	/** Pickup sphere radius */
+	float Radius = 0.0f;
+
+	/** Time after collection before the pickup respawns. Zero or less never respawns */
+	float RespawnTime = 0.0f;
+
+	/** Game time at which a collected pickup respawns */
+	double RespawnAt = 0.0;
+
+	/** Index of the mesh instance in the instanced mesh component */
+	int32 InstanceIndex = INDEX_NONE;
+
+	/** Grid cell along the X axis */
+	int32 Cell = 0;
+
+	/** True while the pickup is collected and waiting to respawn, or gone for good */
+	bool bCollected = false;
+};
+
+/**
+ *  Manages instanced side scrolling pickups.
+ *  All pickups sharing a mesh are drawn through a single instanced static mesh component.
+ *  Collection is resolved with a distance check between the player characters and
+ *  the pickups in nearby grid cells, so pickups need no overlap events.
+ *  Collected pickups are hidden and respawned by updating their instance, without spawning or destroying actors.
+ *  Every collection is broadcast through OnPickupCollected, so effects keep playing for respawned pickups
+ *  whose actor was destroyed by its BP handler.
+ *  Use "stat SideScrollingPickups" to view the collection cost.
+ */
+UCLASS()
+class USideScrollingPickupSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Actor owning the instanced mesh components */
+	UPROPERTY()
+	TObjectPtr<AActor> InstanceHost;
+
+	/** Instanced mesh component for each pickup mesh */
+	UPROPERTY()
+	TMap<TObjectPtr<UStaticMesh>, TObjectPtr<UInstancedStaticMeshComponent>> InstancedMeshes;
+
+	/** Registered pickups */
+	TArray<FSideScrollingPickupEntry> Entries;
+
+	/** Indices of active pickups, bucketed by grid cell along the X axis */
+	TMap<int32, TArray<int32>> Cells;
+
+	/** Indices of collected pickups waiting to respawn */
+	TArray<int32> PendingRespawns;
+
+	/** Largest registered pickup radius, used to size grid queries */
+	float MaxPickupRadius = 0.0f;
+
+	/** Size of each grid cell along the X axis */
+	static constexpr float CellSize = 500.0f;
+
+public:
+
+	/** Called for every pickup collection, including respawned pickups whose actor is gone */
+	UPROPERTY(BlueprintAssignable, Category="Pickup")
+	FSideScrollingPickupCollectedDelegate OnPickupCollected;
+
+	/** Only create this subsystem for game and PIE worlds */
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Releases the instanced mesh components */
+	virtual void Deinitialize() override;
+
+	/** Resolves pickup collection and respawns */
+	virtual void Tick(float DeltaTime) override;
+
+	/** Returns the stat id for this tickable */
+	virtual TStatId GetStatId() const override;
+
+	/** Adds an instance for the pickup and starts handling its collection */
+	void RegisterPickup(ASideScrollingPickup* Pickup);
+
+	/** Removes the pickup's instance and stops handling it */
+	void UnregisterPickup(ASideScrollingPickup* Pickup);
+
+	/** Returns the number of registered pickups */
+	int32 GetNumPickups() const { return Entries.Num(); }
+
+protected:
+
+	/** Returns the instanced mesh component for the provided mesh, creating it if needed */
+	UInstancedStaticMeshComponent* GetOrCreateInstancedMesh(UStaticMesh* Mesh);
+
+	/** Collects any active pickups touching the provided character's capsule */
+	void CollectPickups(ACharacter* PlayerCharacter, TSet<UInstancedStaticMeshComponent*>& DirtyMeshes);
+
+	/** Respawns collected pickups whose respawn time has passed */
+	void RespawnPickups(TSet<UInstancedStaticMeshComponent*>& DirtyMeshes);
+
+	/** Shows or hides the mesh instance for an entry */
+	void SetInstanceVisible(FSideScrollingPickupEntry& Entry, bool bVisible, TSet<UInstancedStaticMeshComponent*>& DirtyMeshes);
+
+	/** Returns the grid cell for the provided X coordinate */
+	static int32 GetCell(float X) { return FMath::FloorToInt32(X / CellSize); }
+};
@@ -4,12 +4,11 @@
 #include "SideScrollingSoftPlatform.h"
 #include "Components/SceneComponent.h"
 #include "Components/StaticMeshComponent.h"
-#include "Components/BoxComponent.h"
-#include "SideScrollingCharacter.h"
+#include "SideScrollingSoftPlatformSubsystem.h"
 
 ASideScrollingSoftPlatform::ASideScrollingSoftPlatform()
 {
- 	PrimaryActorTick.bCanEverTick = true;
+ 	PrimaryActorTick.bCanEverTick = false;
 
 	// create the root component
 	RootComponent = Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
@@ -21,39 +20,58 @@ ASideScrollingSoftPlatform::ASideScrollingSoftPlatform()
 	Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 	Mesh->SetCollisionObjectType(ECC_WorldStatic);
 	Mesh->SetCollisionResponseToAllChannels(ECR_Block);
+}
 
-	// create the collision check box
-	CollisionCheckBox = CreateDefaultSubobject<UBoxComponent>(TEXT("Collision Check Box"));
-	CollisionCheckBox->SetupAttachment(Mesh);
+void ASideScrollingSoftPlatform::BeginPlay()
+{
+	Super::BeginPlay();
 
-	CollisionCheckBox->SetRelativeLocation(FVector(0.0f, 0.0f, -40.0f));
-	CollisionCheckBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	CollisionCheckBox->SetCollisionObjectType(ECC_WorldDynamic);
-	CollisionCheckBox->SetCollisionResponseToAllChannels(ECR_Ignore);
-	CollisionCheckBox->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	// cache the top plane
+	CachedBounds = Mesh->Bounds.GetBox();
 
-	// subscribe to the overlap events
-	CollisionCheckBox->OnComponentBeginOverlap.AddDynamic(this, &ASideScrollingSoftPlatform::OnSoftCollisionOverlap);
+	// register with the one-way platform resolver
+	if (USideScrollingSoftPlatformSubsystem* SoftPlatforms = GetWorld()->GetSubsystem<USideScrollingSoftPlatformSubsystem>())
+	{
+		SoftPlatforms->RegisterPlatform(this);
+	}
+
+	// platforms that move, on their own or attached to a mover, keep their top plane and cells up to date
+	if (Mesh->Mobility != EComponentMobility::Static)
+	{
+		Mesh->TransformUpdated.AddWeakLambda(this, [this](USceneComponent*, EUpdateTransformFlags, ETeleportType)
+		{
+			RefreshTopPlane();
+		});
+	}
 }
 
-void ASideScrollingSoftPlatform::OnSoftCollisionOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void ASideScrollingSoftPlatform::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
-	// have we overlapped a character?
-	if (ASideScrollingCharacter* Char = Cast<ASideScrollingCharacter>(OtherActor))
+	Mesh->TransformUpdated.RemoveAll(this);
+
+	// unregister from the one-way platform resolver
+	if (USideScrollingSoftPlatformSubsystem* SoftPlatforms = GetWorld()->GetSubsystem<USideScrollingSoftPlatformSubsystem>())
 	{
-		// disable the soft collision channel
-		Char->SetSoftCollision(true);
+		SoftPlatforms->UnregisterPlatform(this);
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
-void ASideScrollingSoftPlatform::NotifyActorEndOverlap(AActor* OtherActor)
+void ASideScrollingSoftPlatform::RefreshTopPlane()
 {
-	Super::NotifyActorEndOverlap(OtherActor);
+	// move the platform to its new grid cells
+	USideScrollingSoftPlatformSubsystem* SoftPlatforms = GetWorld()->GetSubsystem<USideScrollingSoftPlatformSubsystem>();
+
+	if (SoftPlatforms)
+	{
+		SoftPlatforms->UnregisterPlatform(this);
+	}
+
+	CachedBounds = Mesh->Bounds.GetBox();
 
-	// have we overlapped a character?
-	if (ASideScrollingCharacter* Char = Cast<ASideScrollingCharacter>(OtherActor))
+	if (SoftPlatforms)
 	{
-		// enable the soft collision channel
-		Char->SetSoftCollision(false);
+		SoftPlatforms->RegisterPlatform(this);
 	}
 }
@@ -8,10 +8,10 @@
 
 class USceneComponent;
 class UStaticMeshComponent;
-class UBoxComponent;
 
 /**
  *  A side scrolling game platform that the character can jump or drop through.
+ *  Collision is resolved one-way by the character's movement component using the platform's cached top plane.
  */
 UCLASS(abstract)
 class ASideScrollingSoftPlatform : public AActor
@@ -26,9 +26,10 @@ class ASideScrollingSoftPlatform : public AActor
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
 	UStaticMeshComponent* Mesh;
 
-	/** Collision volume that toggles soft collision on the character when they're below the platform. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
-	UBoxComponent* CollisionCheckBox;
+protected:
+
+	/** Cached world space bounds of the platform mesh */
+	FBox CachedBounds = FBox(ForceInit);
 
 public:	
 	
@@ -37,10 +38,24 @@ public:
 
 protected:
 
-	/** Handles soft collision check box overlaps */
-	UFUNCTION()
-	void OnSoftCollisionOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
+	/** Caches the top plane, registers with the soft platform subsystem and starts following the mesh if it can move */
+	virtual void BeginPlay() override;
+
+	/** Stops following the mesh and unregisters from the soft platform subsystem */
+	virtual void EndPlay(EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	/** Recomputes the cached bounds and grid cells. Called automatically when a movable platform mesh moves */
+	UFUNCTION(BlueprintCallable, Category="Soft Platform")
+	void RefreshTopPlane();
+
+	/** Returns the cached world space bounds of the platform */
+	const FBox& GetCachedBounds() const { return CachedBounds; }
+
+	/** Returns the cached height of the platform's top plane */
+	float GetTopZ() const { return CachedBounds.Max.Z; }
 
-	/** Restores soft collision state when overlap ends */
-	virtual void NotifyActorEndOverlap(AActor* OtherActor) override;
+	/** Returns the platform mesh */
+	UStaticMeshComponent* GetMesh() const { return Mesh; }
 };
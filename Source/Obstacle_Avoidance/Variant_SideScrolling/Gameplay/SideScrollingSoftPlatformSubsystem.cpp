@@ -0,0 +1,102 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingSoftPlatformSubsystem.h"
+#include "SideScrollingSoftPlatform.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+
+void USideScrollingSoftPlatformSubsystem::RegisterPlatform(ASideScrollingSoftPlatform* Platform)
+{
+	int32 MinCell, MaxCell;
+	GetCellRange(Platform->GetCachedBounds(), MinCell, MaxCell);
+
+	// add the platform to every cell it covers
+	for (int32 Cell = MinCell; Cell <= MaxCell; ++Cell)
+	{
+		Cells.FindOrAdd(Cell).AddUnique(Platform);
+	}
+}
+
+void USideScrollingSoftPlatformSubsystem::UnregisterPlatform(ASideScrollingSoftPlatform* Platform)
+{
+	int32 MinCell, MaxCell;
+	GetCellRange(Platform->GetCachedBounds(), MinCell, MaxCell);
+
+	for (int32 Cell = MinCell; Cell <= MaxCell; ++Cell)
+	{
+		if (TArray<TWeakObjectPtr<ASideScrollingSoftPlatform>>* CellPlatforms = Cells.Find(Cell))
+		{
+			CellPlatforms->RemoveSwap(Platform);
+
+			if (CellPlatforms->IsEmpty())
+			{
+				Cells.Remove(Cell);
+			}
+		}
+	}
+}
+
+void USideScrollingSoftPlatformSubsystem::FindPlatforms(const FBox& QueryBox, TArray<ASideScrollingSoftPlatform*>& OutPlatforms) const
+{
+	int32 MinCell, MaxCell;
+	GetCellRange(QueryBox, MinCell, MaxCell);
+
+	for (int32 Cell = MinCell; Cell <= MaxCell; ++Cell)
+	{
+		if (const TArray<TWeakObjectPtr<ASideScrollingSoftPlatform>>* CellPlatforms = Cells.Find(Cell))
+		{
+			for (const TWeakObjectPtr<ASideScrollingSoftPlatform>& WeakPlatform : *CellPlatforms)
+			{
+				ASideScrollingSoftPlatform* Platform = WeakPlatform.Get();
+
+				if (Platform && Platform->GetCachedBounds().Intersect(QueryBox))
+				{
+					OutPlatforms.AddUnique(Platform);
+				}
+			}
+		}
+	}
+}
+
+void USideScrollingSoftPlatformSubsystem::GetCellRange(const FBox& Bounds, int32& OutMinCell, int32& OutMaxCell)
+{
+	OutMinCell = FMath::FloorToInt32(Bounds.Min.X / CellSize);
+	OutMaxCell = FMath::FloorToInt32(Bounds.Max.X / CellSize);
+}
+
+////////////////////////////////////////////////////////////////////
+
+/** Fills the level with copies of the first soft platform to validate the one-way platform resolver at scale */
+static FAutoConsoleCommandWithWorldAndArgs CVarSideScrollingSpawnSoftPlatforms(
+	TEXT("SideScrolling.Benchmark.SpawnSoftPlatforms"),
+	TEXT("Spawns a staircase of copies of the first soft platform in the level. Usage: SideScrolling.Benchmark.SpawnSoftPlatforms [Count=300] [StepX=400] [StepZ=150]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 300;
+		const float StepX = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 400.0f;
+		const float StepZ = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 150.0f;
+
+		for (TActorIterator<ASideScrollingSoftPlatform> It(World); It; ++It)
+		{
+			const FTransform Origin = It->GetActorTransform();
+
+			// alternate between two heights so the character has to jump up and drop down through them
+			for (int32 i = 1; i <= Count; ++i)
+			{
+				FTransform SpawnTransform = Origin;
+				SpawnTransform.AddToTranslation(FVector(i * StepX, 0.0f, (i % 2) * StepZ));
+
+				World->SpawnActor<ASideScrollingSoftPlatform>(It->GetClass(), SpawnTransform);
+			}
+
+			break;
+		}
+	})
+);
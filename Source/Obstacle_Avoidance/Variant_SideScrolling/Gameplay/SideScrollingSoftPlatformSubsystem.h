@@ -0,0 +1,44 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SideScrollingSoftPlatformSubsystem.generated.h"
+
+class ASideScrollingSoftPlatform;
+
+/**
+ *  Registry of soft platforms in the world.
+ *  Platforms are bucketed in a grid along the side scrolling axis so
+ *  character movement components can quickly find the ones around them.
+ */
+UCLASS()
+class USideScrollingSoftPlatformSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Registered platforms, bucketed by grid cell along the X axis */
+	TMap<int32, TArray<TWeakObjectPtr<ASideScrollingSoftPlatform>>> Cells;
+
+	/** Size of each grid cell along the X axis */
+	static constexpr float CellSize = 500.0f;
+
+public:
+
+	/** Adds a platform to the grid using its cached bounds */
+	void RegisterPlatform(ASideScrollingSoftPlatform* Platform);
+
+	/** Removes a platform from the grid */
+	void UnregisterPlatform(ASideScrollingSoftPlatform* Platform);
+
+	/** Finds all platforms whose cached bounds intersect the provided box */
+	void FindPlatforms(const FBox& QueryBox, TArray<ASideScrollingSoftPlatform*>& OutPlatforms) const;
+
+protected:
+
+	/** Returns the range of grid cells covered by the provided bounds */
+	static void GetCellRange(const FBox& Bounds, int32& OutMinCell, int32& OutMaxCell);
+};
@@ -3,6 +3,8 @@
 
 #include "SideScrollingCameraManager.h"
 #include "GameFramework/Pawn.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/HitResult.h"
 #include "CollisionQueryParams.h"
 #include "Engine/World.h"
@@ -57,16 +59,8 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 
 		} else {
 
-			// run a trace below the character to determine if we need to do a height update
-			FHitResult OutHit;
-
-			const FVector End = CurrentActorLocation + FVector(0.0f, 0.0f, -1000.0f);
-
-			FCollisionQueryParams QueryParams;
-			QueryParams.AddIgnoredActor(TargetPawn);
-
 			// only update height if we're not about to hit ground
-			bZUpdate = !GetWorld()->LineTraceSingleByChannel(OutHit, CurrentActorLocation, End, ECC_Visibility, QueryParams);
+			bZUpdate = !IsGroundBelowTarget(TargetPawn, CurrentActorLocation);
 
 		}
 
@@ -102,4 +96,47 @@ void ASideScrollingCameraManager::UpdateViewTarget(FTViewTarget& OutVT, float De
 
 		OutVT.POV.Location = FMath::VInterpTo(CurrentCameraLocation, TargetCameraLocation, DeltaTime, 2.0f);
 	}
-}
\ No newline at end of file
+}
+
+bool ASideScrollingCameraManager::IsGroundBelowTarget(APawn* TargetPawn, const FVector& TargetLocation)
+{
+	// a walking character already knows about the floor under it
+	if (const ACharacter* TargetCharacter = Cast<ACharacter>(TargetPawn))
+	{
+		const UCharacterMovementComponent* CharacterMovement = TargetCharacter->GetCharacterMovement();
+
+		if (CharacterMovement && CharacterMovement->IsMovingOnGround() && CharacterMovement->CurrentFloor.IsWalkableFloor())
+		{
+			return true;
+		}
+	}
+
+	const double CurrentTime = GetWorld()->GetTimeSeconds();
+
+	// reuse the last probe hit if the target hasn't moved away from it and it's still within range
+	if (bGroundProbeHit
+		&& CurrentTime - GroundProbeTime <= GroundProbeMaxAge
+		&& FVector::DistSquared2D(TargetLocation, GroundProbeLocation) <= FMath::Square(GroundProbeReuseDistance)
+		&& TargetLocation.Z >= GroundProbeHitZ
+		&& TargetLocation.Z - GroundProbeHitZ <= GroundProbeDistance)
+	{
+		return true;
+	}
+
+	// run a trace below the character
+	FHitResult OutHit;
+
+	const FVector End = TargetLocation + FVector(0.0f, 0.0f, -GroundProbeDistance);
+
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(TargetPawn);
+
+	bGroundProbeHit = GetWorld()->LineTraceSingleByChannel(OutHit, TargetLocation, End, ECC_Visibility, QueryParams);
+
+	// cache the probe so it can be reused over the next frames
+	GroundProbeLocation = TargetLocation;
+	GroundProbeHitZ = OutHit.ImpactPoint.Z;
+	GroundProbeTime = CurrentTime;
+
+	return bGroundProbeHit;
+}
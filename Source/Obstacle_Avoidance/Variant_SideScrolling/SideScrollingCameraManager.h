@@ -37,6 +37,14 @@ public:
 	UPROPERTY(EditAnywhere, Category="Side Scrolling Camera", meta=(ClampMin=-100000, ClampMax=100000, Units="cm"))
 	float CameraXMaxBounds = 10000.0f;
 
+	/** Max horizontal distance the target can move before a cached ground probe hit is discarded */
+	UPROPERTY(EditAnywhere, Category="Side Scrolling Camera|Ground Probe", meta=(ClampMin=0, ClampMax=1000, Units="cm"))
+	float GroundProbeReuseDistance = 25.0f;
+
+	/** Max age of a cached ground probe hit before it's discarded */
+	UPROPERTY(EditAnywhere, Category="Side Scrolling Camera|Ground Probe", meta=(ClampMin=0, ClampMax=5, Units="s"))
+	float GroundProbeMaxAge = 0.25f;
+
 protected:
 
 	/** Last cached camera vertical location. The camera only adjusts its height if necessary. */
@@ -44,4 +52,22 @@ protected:
 
 	/** First-time update camera setup flag */
 	bool bSetup = true;
+
+	/** If true, the last ground probe hit something and the cached values below are valid */
+	bool bGroundProbeHit = false;
+
+	/** Target location the last ground probe was run from */
+	FVector GroundProbeLocation = FVector::ZeroVector;
+
+	/** Height of the ground found by the last ground probe */
+	float GroundProbeHitZ = 0.0f;
+
+	/** World time of the last ground probe */
+	double GroundProbeTime = 0.0;
+
+	/** Max distance below the target to look for ground */
+	static constexpr float GroundProbeDistance = 1000.0f;
+
+	/** Returns true if there's ground below the target within the probe distance. Uses the character's floor or a cached probe before tracing */
+	bool IsGroundBelowTarget(APawn* TargetPawn, const FVector& TargetLocation);
 };
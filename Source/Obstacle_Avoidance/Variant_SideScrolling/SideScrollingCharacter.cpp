@@ -2,7 +2,7 @@
 
 
 #include "SideScrollingCharacter.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "SideScrollingCharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Components/InputComponent.h"
@@ -13,8 +13,10 @@
 #include "SideScrollingInteractable.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "TimerManager.h"
+#include "OAWallContactComponent.h"
 
-ASideScrollingCharacter::ASideScrollingCharacter()
+ASideScrollingCharacter::ASideScrollingCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USideScrollingCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 
@@ -57,6 +59,9 @@ ASideScrollingCharacter::ASideScrollingCharacter()
 
 	// enable double jump and coyote time
 	JumpMaxCount = 3;
+
+	// create the wall contact cache
+	WallContact = CreateDefaultSubobject<UOAWallContactComponent>(TEXT("WallContact"));
 }
 
 void ASideScrollingCharacter::EndPlay(EEndPlayReason::Type EndPlayReason)
@@ -125,6 +130,9 @@ void ASideScrollingCharacter::OnMovementModeChanged(EMovementMode PrevMovementMo
 {
 	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
 
+	// drop stale wall contacts
+	WallContact->NotifyMovementModeChanged(GetCharacterMovement()->MovementMode);
+
 	// are we falling?
 	if (GetCharacterMovement()->MovementMode == EMovementMode::MOVE_Falling)
 	{
@@ -237,18 +245,12 @@ void ASideScrollingCharacter::MultiJump()
 	// if we have a horizontal input, try for wall jump first
 	if (!bHasWallJumped && !FMath::IsNearlyZero(ActionValueY))
 	{
-		// trace ahead of the character for walls
+		// look ahead of the character for walls, reusing the last wall we ran into if possible
 		FHitResult OutHit;
 
-		const FVector Start = GetActorLocation();
-		const FVector End = Start + (FVector(ActionValueY > 0.0f ? 1.0f : -1.0f, 0.0f, 0.0f) * WallJumpTraceDistance);
-
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(this);
+		const FVector WallDirection = FVector(ActionValueY > 0.0f ? 1.0f : -1.0f, 0.0f, 0.0f);
 
-		GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, ECC_Visibility, QueryParams);
-
-		if (OutHit.bBlockingHit)
+		if (WallContact->FindWall(WallDirection, WallJumpTraceDistance, 0.0f, OutHit))
 		{
 			// rotate to the bounce direction
 			const FRotator BounceRot = UKismetMathLibrary::MakeRotFromX(OutHit.ImpactNormal);
@@ -261,6 +263,9 @@ void ASideScrollingCharacter::MultiJump()
 			// launch the character away from the wall
 			LaunchCharacter(WallJumpImpulse, true, true);
 
+			// we're leaving this wall, so don't reuse it for the next wall jump
+			WallContact->ClearContact();
+
 			// enable wall jump lockout for a bit
 			bHasWallJumped = true;
 
@@ -305,25 +310,10 @@ void ASideScrollingCharacter::CheckForSoftCollision()
 	// reset the drop value
 	DropValue = 0.0f;
 
-	// trace down 
-	FHitResult OutHit;
-
-	const FVector Start = GetActorLocation();
-	const FVector End = Start + (FVector::DownVector * SoftCollisionTraceDistance);
-
-	FCollisionObjectQueryParams ObjectParams;
-	ObjectParams.AddObjectTypesToQuery(SoftCollisionObjectType);
-
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
-	GetWorld()->LineTraceSingleByObjectType(OutHit, Start, End, ObjectParams, QueryParams);
-
-	// did we hit a soft floor?
-	if (OutHit.GetActor())
+	// let the movement component drop us through the soft platform below, if there is one
+	if (USideScrollingCharacterMovementComponent* SideScrollingMovement = Cast<USideScrollingCharacterMovementComponent>(GetCharacterMovement()))
 	{
-		// drop through the floor
-		SetSoftCollision(true);
+		SideScrollingMovement->DropThroughSoftPlatform(SoftCollisionTraceDistance);
 	}
 }
 
@@ -333,12 +323,6 @@ void ASideScrollingCharacter::ResetWallJump()
 	bHasWallJumped = false;
 }
 
-void ASideScrollingCharacter::SetSoftCollision(bool bEnabled)
-{
-	// enable or disable collision response to the soft collision channel
-	GetCapsuleComponent()->SetCollisionResponseToChannel(SoftCollisionObjectType, bEnabled ? ECR_Ignore : ECR_Block);
-}
-
 bool ASideScrollingCharacter::HasDoubleJumped() const
 {
 	return bHasDoubleJumped;
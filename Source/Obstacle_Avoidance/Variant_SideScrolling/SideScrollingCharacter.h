@@ -7,6 +7,7 @@
 #include "SideScrollingCharacter.generated.h"
 
 class UCameraComponent;
+class UOAWallContactComponent;
 class UInputAction;
 struct FInputActionValue;
 
@@ -22,6 +23,10 @@ class ASideScrollingCharacter : public ACharacter
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Camera", meta = (AllowPrivateAccess = "true"))
 	UCameraComponent* Camera;
 
+	/** Wall contact cache for wall jumps */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category ="Components", meta = (AllowPrivateAccess = "true"))
+	UOAWallContactComponent* WallContact;
+
 protected:
 
 	/** Move Input Action */
@@ -64,11 +69,7 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Side Scrolling|Wall Jump")
 	float WallJumpVerticalMultiplier = 1.4f;
 
-	/** Collision object type to use for soft collision traces (dropping down floors) */
-	UPROPERTY(EditAnywhere, Category="Side Scrolling|Soft Platforms")
-	TEnumAsByte<ECollisionChannel> SoftCollisionObjectType;
-
-	/** Distance to trace down during soft collision checks */
+	/** Max distance below the character to look for a soft platform to drop through */
 	UPROPERTY(EditAnywhere, Category="Side Scrolling|Soft Platforms")
 	float SoftCollisionTraceDistance = 1000.0f;
 
@@ -100,7 +101,7 @@ protected:
 public:
 	
 	/** Constructor */
-	ASideScrollingCharacter();
+	ASideScrollingCharacter(const FObjectInitializer& ObjectInitializer);
 
 protected:
 
@@ -157,17 +158,12 @@ protected:
 	/** Handles advanced jump logic */
 	void MultiJump();
 
-	/** Checks for soft collision with platforms */
+	/** Drops through the soft platform below the character */
 	void CheckForSoftCollision();
 
 	/** Resets wall jump lockout. Called from timer after a wall jump */
 	void ResetWallJump();
 
-public:
-
-	/** Sets the soft collision response. True passes, False blocks */
-	void SetSoftCollision(bool bEnabled);
-
 public:
 
 	/** Returns true if the character has just double jumped */
@@ -0,0 +1,153 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+
+#include "SideScrollingCharacterMovementComponent.h"
+#include "SideScrollingSoftPlatform.h"
+#include "SideScrollingSoftPlatformSubsystem.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+
+bool USideScrollingCharacterMovementComponent::DropThroughSoftPlatform(float MaxDistance)
+{
+	// are we standing on a soft platform?
+	ASideScrollingSoftPlatform* Platform = IsMovingOnGround() ? Cast<ASideScrollingSoftPlatform>(CurrentFloor.HitResult.GetActor()) : nullptr;
+
+	// otherwise, look for the closest soft platform below us
+	if (!Platform)
+	{
+		const USideScrollingSoftPlatformSubsystem* SoftPlatforms = GetWorld()->GetSubsystem<USideScrollingSoftPlatformSubsystem>();
+
+		if (!SoftPlatforms)
+		{
+			return false;
+		}
+
+		const FBox CapsuleBounds = GetCapsuleBounds();
+		const float CapsuleBottomZ = CapsuleBounds.Min.Z;
+
+		FBox QueryBox = CapsuleBounds;
+		QueryBox.Min.Z -= MaxDistance;
+
+		TArray<ASideScrollingSoftPlatform*> Candidates;
+		SoftPlatforms->FindPlatforms(QueryBox, Candidates);
+
+		for (ASideScrollingSoftPlatform* Candidate : Candidates)
+		{
+			// pick the highest platform that's below our feet
+			if (Candidate->GetTopZ() <= CapsuleBottomZ + SoftPlatformTopTolerance && (!Platform || Candidate->GetTopZ() > Platform->GetTopZ()))
+			{
+				Platform = Candidate;
+			}
+		}
+	}
+
+	// drop through the platform until we're below it
+	DropPlatform = Platform;
+
+	return Platform != nullptr;
+}
+
+void USideScrollingCharacterMovementComponent::PerformMovement(float DeltaTime)
+{
+	UpdateSoftPlatforms(DeltaTime);
+
+	Super::PerformMovement(DeltaTime);
+}
+
+void USideScrollingCharacterMovementComponent::UpdateSoftPlatforms(float DeltaTime)
+{
+	const USideScrollingSoftPlatformSubsystem* SoftPlatforms = GetWorld()->GetSubsystem<USideScrollingSoftPlatformSubsystem>();
+
+	if (!SoftPlatforms || !UpdatedPrimitive)
+	{
+		return;
+	}
+
+	const FBox CapsuleBounds = GetCapsuleBounds();
+	const float CapsuleBottomZ = CapsuleBounds.Min.Z;
+
+	// look for platforms within reach of this move
+	const FBox QueryBox = CapsuleBounds.ExpandBy(Velocity.GetAbs() * DeltaTime + FVector(SoftPlatformQueryMargin));
+
+	TArray<ASideScrollingSoftPlatform*> NearbyPlatforms;
+	SoftPlatforms->FindPlatforms(QueryBox, NearbyPlatforms);
+
+	// stop dropping once we've cleared the platform or left it behind
+	if (ASideScrollingSoftPlatform* Platform = DropPlatform.Get())
+	{
+		if (CapsuleBounds.Max.Z < Platform->GetCachedBounds().Min.Z || !NearbyPlatforms.Contains(Platform))
+		{
+			DropPlatform.Reset();
+		}
+	}
+	else
+	{
+		DropPlatform.Reset();
+	}
+
+	// restore platforms we're no longer near
+	for (int32 i = IgnoredPlatforms.Num() - 1; i >= 0; --i)
+	{
+		ASideScrollingSoftPlatform* Platform = IgnoredPlatforms[i].Get();
+
+		if (!Platform || !NearbyPlatforms.Contains(Platform))
+		{
+			if (Platform)
+			{
+				UpdatedPrimitive->IgnoreComponentWhenMoving(Platform->GetMesh(), false);
+			}
+
+			IgnoredPlatforms.RemoveAtSwap(i);
+		}
+	}
+
+	// accept or reject each nearby platform
+	for (ASideScrollingSoftPlatform* Platform : NearbyPlatforms)
+	{
+		const bool bBlock = ShouldBlockSoftPlatform(Platform, CapsuleBottomZ);
+		const bool bIgnored = IgnoredPlatforms.Contains(Platform);
+
+		if (bBlock && bIgnored)
+		{
+			UpdatedPrimitive->IgnoreComponentWhenMoving(Platform->GetMesh(), false);
+			IgnoredPlatforms.RemoveSwap(Platform);
+		}
+		else if (!bBlock && !bIgnored)
+		{
+			UpdatedPrimitive->IgnoreComponentWhenMoving(Platform->GetMesh(), true);
+			IgnoredPlatforms.Add(Platform);
+		}
+	}
+}
+
+bool USideScrollingCharacterMovementComponent::ShouldBlockSoftPlatform(const ASideScrollingSoftPlatform* Platform, float CapsuleBottomZ) const
+{
+	// never block the platform we're dropping through
+	if (DropPlatform.Get() == Platform)
+	{
+		return false;
+	}
+
+	const float TopZ = Platform->GetTopZ();
+
+	// when moving up, only block once we're fully above the platform
+	if (Velocity.Z > 0.0f)
+	{
+		return CapsuleBottomZ >= TopZ;
+	}
+
+	// when resting or falling, block if we're on or above the top plane
+	return CapsuleBottomZ >= TopZ - SoftPlatformTopTolerance;
+}
+
+FBox USideScrollingCharacterMovementComponent::GetCapsuleBounds() const
+{
+	float Radius, HalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(Radius, HalfHeight);
+
+	const FVector Location = UpdatedComponent->GetComponentLocation();
+
+	return FBox(Location - FVector(Radius, Radius, HalfHeight), Location + FVector(Radius, Radius, HalfHeight));
+}
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SideScrollingCharacterMovementComponent.generated.h"
+
+class ASideScrollingSoftPlatform;
+
+/**
+ *  Character movement component with one-way soft platform resolution.
+ *  Before each move, nearby soft platforms are accepted or rejected as blocking contacts
+ *  based on the character's velocity and the platform's cached top plane.
+ *  Rejected platforms are added to the capsule's move ignore list, so the capsule's collision filter never changes.
+ */
+UCLASS()
+class USideScrollingCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	/** Distance below a platform's top plane at which the character is still considered to be on top of it */
+	UPROPERTY(EditAnywhere, Category="Soft Platforms", meta = (ClampMin = 0, ClampMax = 100, Units = "cm"))
+	float SoftPlatformTopTolerance = 5.0f;
+
+	/** Extra distance around the capsule to look for soft platforms */
+	UPROPERTY(EditAnywhere, Category="Soft Platforms", meta = (ClampMin = 0, ClampMax = 1000, Units = "cm"))
+	float SoftPlatformQueryMargin = 50.0f;
+
+	/** Platforms currently rejected as blocking contacts */
+	TArray<TWeakObjectPtr<ASideScrollingSoftPlatform>> IgnoredPlatforms;
+
+	/** Platform the character is currently dropping through, if any */
+	TWeakObjectPtr<ASideScrollingSoftPlatform> DropPlatform;
+
+public:
+
+	/** Drops through the soft platform below the character, if one is found within the max distance */
+	bool DropThroughSoftPlatform(float MaxDistance);
+
+protected:
+
+	/** Resolves soft platforms before moving */
+	virtual void PerformMovement(float DeltaTime) override;
+
+	/** Accepts or rejects nearby soft platforms as blocking contacts for the upcoming move */
+	void UpdateSoftPlatforms(float DeltaTime);
+
+	/** Returns true if the soft platform should block the character this move */
+	bool ShouldBlockSoftPlatform(const ASideScrollingSoftPlatform* Platform, float CapsuleBottomZ) const;
+
+	/** Returns the capsule's world space bounds */
+	FBox GetCapsuleBounds() const;
+};